@@ -4,6 +4,8 @@
 # SPDX-License-Identifier: MIT
 #
 
+set(CASSIAN_CMAKE_DIR ${CMAKE_CURRENT_LIST_DIR})
+
 function(cassian_install_target name)
   include(GNUInstallDirs)
   install(
@@ -46,3 +48,76 @@ function(cassian_target_add_kernels name)
             DESTINATION ${CMAKE_INSTALL_DATADIR}/cassian/${kernel_path})
   endforeach()
 endfunction()
+
+# Compiles kernels to native binaries for CASSIAN_PRECOMPILE_DEVICES with each
+# set of BUILD_OPTIONS, or without build options if BUILD_OPTIONS is omitted.
+# Build options must match the ones passed to create_kernel, otherwise kernels
+# are compiled at run time as usual. Options are compared as a list, so
+# spacing and quoting of options without whitespace do not matter, see
+# normalize_build_options. CASSIAN_PRECOMPILE_DEVICES entries must be
+# decimal IP versions, e.g. 50331648, as binaries are looked up by the IP
+# version reported by the device. Other ocloc device names never match.
+#
+# cassian_target_precompile_kernels(<target> KERNELS <kernel>...
+#                                   [BUILD_OPTIONS <build options>...])
+function(cassian_target_precompile_kernels name)
+  if(NOT CASSIAN_PRECOMPILE_KERNELS)
+    return()
+  endif()
+
+  cmake_parse_arguments(PRECOMPILE "" "" "KERNELS;BUILD_OPTIONS" ${ARGN})
+  list(LENGTH PRECOMPILE_BUILD_OPTIONS build_options_count)
+  if(build_options_count EQUAL 0)
+    set(build_options_count 1)
+  endif()
+  math(EXPR last_build_options "${build_options_count} - 1")
+
+  set(bundle_dir "${CMAKE_CURRENT_BINARY_DIR}/precompiled_kernels/${name}")
+  set(index "")
+  set(outputs "")
+  set(kernel_id 0)
+  foreach(kernel ${PRECOMPILE_KERNELS})
+    set(kernel_file "${CMAKE_CURRENT_SOURCE_DIR}/${kernel}")
+    set(source "sources/${kernel_id}")
+    add_custom_command(
+      OUTPUT "${bundle_dir}/${source}"
+      COMMAND ${CMAKE_COMMAND} -E copy "${kernel_file}"
+              "${bundle_dir}/${source}"
+      DEPENDS "${kernel_file}"
+      VERBATIM)
+    list(APPEND outputs "${bundle_dir}/${source}")
+
+    foreach(build_options_id RANGE ${last_build_options})
+      set(build_options "")
+      if(PRECOMPILE_BUILD_OPTIONS)
+        list(GET PRECOMPILE_BUILD_OPTIONS ${build_options_id} build_options)
+      endif()
+      foreach(device ${CASSIAN_PRECOMPILE_DEVICES})
+        set(binary "${device}/${kernel_id}_${build_options_id}.bin")
+        add_custom_command(
+          OUTPUT "${bundle_dir}/${binary}"
+          COMMAND
+            ${CMAKE_COMMAND} "-DOCLOC=${OCLOC_EXECUTABLE}"
+            "-DSOURCE=${kernel_file}" "-DDEVICE=${device}"
+            "-DBUILD_OPTIONS=${build_options}"
+            "-DOUTPUT=${bundle_dir}/${binary}" -P
+            "${CASSIAN_CMAKE_DIR}/precompile_kernel.cmake"
+          DEPENDS "${kernel_file}"
+          COMMENT "Precompiling ${kernel} for ${device}"
+          VERBATIM)
+        list(APPEND outputs "${bundle_dir}/${binary}")
+        string(APPEND index
+               "${device}\t${source}\t${binary}\t${build_options}\n")
+      endforeach()
+    endforeach()
+    math(EXPR kernel_id "${kernel_id} + 1")
+  endforeach()
+
+  file(WRITE "${bundle_dir}/index.txt" "${index}")
+  add_custom_target(${name}_precompiled_kernels ALL DEPENDS ${outputs})
+  add_dependencies(${name} ${name}_precompiled_kernels)
+
+  include(GNUInstallDirs)
+  install(DIRECTORY "${bundle_dir}"
+          DESTINATION ${CMAKE_INSTALL_DATADIR}/cassian/precompiled_kernels)
+endfunction()
@@ -51,8 +51,45 @@ if(BUILD_L0)
       list(APPEND LevelZero_INCLUDE_DIRS ${OpenCL_INCLUDE_DIRS})
     endif()
   endif()
-  if(UNIX)
-    set(THREADS_PREFER_PTHREAD_FLAG ON)
-    find_package(Threads REQUIRED)
+endif()
+
+option(USE_MPFR "Use MPFR for high precision math function references" OFF)
+if(USE_MPFR)
+  find_path(MPFR_INCLUDE_DIR NAMES mpfr.h)
+  find_library(MPFR_LIBRARY NAMES mpfr)
+  find_library(GMP_LIBRARY NAMES gmp)
+
+  include(FindPackageHandleStandardArgs)
+  find_package_handle_standard_args(
+    MPFR REQUIRED_VARS MPFR_INCLUDE_DIR MPFR_LIBRARY GMP_LIBRARY)
+  mark_as_advanced(MPFR_INCLUDE_DIR MPFR_LIBRARY GMP_LIBRARY)
+  if(NOT MPFR_FOUND)
+    message(FATAL_ERROR "MPFR is required when USE_MPFR is enabled")
+  endif()
+endif()
+
+if(UNIX)
+  set(THREADS_PREFER_PTHREAD_FLAG ON)
+  find_package(Threads REQUIRED)
+endif()
+
+option(CASSIAN_PRECOMPILE_KERNELS "Precompile kernels to native binaries" OFF)
+set(CASSIAN_PRECOMPILE_DEVICES
+    ""
+    CACHE STRING "Decimal IP versions of devices to precompile kernels for")
+if(CASSIAN_PRECOMPILE_KERNELS)
+  find_program(OCLOC_EXECUTABLE ocloc)
+  if(NOT OCLOC_EXECUTABLE)
+    message(FATAL_ERROR "ocloc is required to precompile kernels")
+  endif()
+  if(NOT CASSIAN_PRECOMPILE_DEVICES)
+    message(FATAL_ERROR "CASSIAN_PRECOMPILE_DEVICES must not be empty")
   endif()
+  foreach(device ${CASSIAN_PRECOMPILE_DEVICES})
+    if(NOT device MATCHES "^[0-9]+$")
+      message(
+        FATAL_ERROR
+          "CASSIAN_PRECOMPILE_DEVICES must list decimal IP versions: ${device}")
+    endif()
+  endforeach()
 endif()
@@ -0,0 +1,31 @@
+#
+# Copyright (C) 2026 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+#
+
+# Compiles a single kernel with ocloc, invoked by
+# cassian_target_precompile_kernels. Failures are not fatal, an empty binary is
+# written instead and the kernel is compiled at run time.
+
+get_filename_component(output_dir "${OUTPUT}" DIRECTORY)
+get_filename_component(output_name "${OUTPUT}" NAME_WE)
+file(MAKE_DIRECTORY "${output_dir}")
+
+set(options "")
+if(NOT BUILD_OPTIONS STREQUAL "")
+  set(options -options "${BUILD_OPTIONS}")
+endif()
+
+execute_process(
+  COMMAND
+    "${OCLOC}" compile -file "${SOURCE}" -device "${DEVICE}" ${options} -output
+    "${output_name}" -output_no_suffix -out_dir "${output_dir}" -q
+  RESULT_VARIABLE result
+  OUTPUT_VARIABLE log
+  ERROR_VARIABLE log)
+
+if(NOT result EQUAL 0 OR NOT EXISTS "${OUTPUT}")
+  message(WARNING "Failed to precompile ${SOURCE} for ${DEVICE}:\n${log}")
+  file(WRITE "${OUTPUT}" "")
+endif()
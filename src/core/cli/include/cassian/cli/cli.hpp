@@ -8,6 +8,8 @@
 #ifndef CASSIAN_CLI_CLI_HPP
 #define CASSIAN_CLI_CLI_HPP
 
+#include <cstddef>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 
@@ -53,12 +55,47 @@ public:
    */
   template <typename T> T get(const std::string &name) const;
 
+  /**
+   * Returned value of an argument as an unsigned integer.
+   *
+   * @param[in] name argument name.
+   * @param[in] min_value smallest accepted value.
+   * @returns argument value.
+   * @throws cassian::CommandLineParserException Thrown if argument value is not
+   * an unsigned integer greater or equal to `min_value`.
+   */
+  size_t get_unsigned(const std::string &name, size_t min_value = 0) const;
+
+  /**
+   * Returned value of an argument as a boolean.
+   *
+   * @param[in] name argument name.
+   * @returns true if argument value is "true", false if it is "false".
+   * @throws cassian::CommandLineParserException Thrown if argument value is
+   * neither "true" nor "false".
+   */
+  bool get_bool(const std::string &name) const;
+
+  /**
+   * Get all arguments.
+   *
+   * @returns values of all added arguments by argument name.
+   */
+  const std::unordered_map<std::string, std::string> &get_arguments() const;
+
 private:
   std::unordered_map<std::string, std::string> arguments_;
 
   bool list_requested_ = false;
 };
 
+/**
+ * Exception class used when a command line argument has an invalid value.
+ */
+class CommandLineParserException : public std::runtime_error {
+  using std::runtime_error::runtime_error;
+};
+
 template <typename T> T CommandLineParser::get(const std::string &name) const {
   return T(arguments_.at(name));
 }
@@ -6,7 +6,11 @@
  */
 
 #include <cassian/cli/cli.hpp>
+#include <charconv>
+#include <cstddef>
 #include <string>
+#include <system_error>
+#include <unordered_map>
 #include <utility>
 
 namespace cassian {
@@ -45,6 +49,38 @@ void CommandLineParser::parse(int *argc, char **argv) {
   }
 }
 
+size_t CommandLineParser::get_unsigned(const std::string &name,
+                                       size_t min_value) const {
+  const std::string &value = arguments_.at(name);
+  const char *end = value.data() + value.size();
+  size_t result = 0;
+  const auto [ptr, ec] = std::from_chars(value.data(), end, result);
+  if (value.empty() || ec != std::errc() || ptr != end || result < min_value) {
+    throw CommandLineParserException(
+        "Invalid value of " + name + ": \"" + value +
+        "\", expected an integer greater or equal to " +
+        std::to_string(min_value));
+  }
+  return result;
+}
+
+bool CommandLineParser::get_bool(const std::string &name) const {
+  const std::string &value = arguments_.at(name);
+  if (value == "true") {
+    return true;
+  }
+  if (value == "false") {
+    return false;
+  }
+  throw CommandLineParserException("Invalid value of " + name + ": \"" +
+                                   value + "\", expected true or false");
+}
+
 bool CommandLineParser::list_requested() const { return list_requested_; }
 
+const std::unordered_map<std::string, std::string> &
+CommandLineParser::get_arguments() const {
+  return arguments_;
+}
+
 } // namespace cassian
@@ -8,9 +8,12 @@
 #ifndef CASSIAN_FP_TYPES_BFLOAT16_HPP
 #define CASSIAN_FP_TYPES_BFLOAT16_HPP
 
+#include <array>
+#include <bit>
 #include <cmath>
 #include <cstdint>
 #include <limits>
+#include <span>
 #include <string>
 
 #include <cassian/fp_types/type_traits.hpp>
@@ -65,7 +68,10 @@ public:
    *
    * @returns value converted to float
    */
-  explicit operator float() const;
+  constexpr explicit operator float() const {
+    constexpr int remainder_bits = 16;
+    return std::bit_cast<float>(static_cast<uint32_t>(data) << remainder_bits);
+  }
 
   /**
    * Conversion operator to integral types, double and long double
@@ -80,7 +86,9 @@ public:
    * @param[in] rhs Value to compare against.
    * @returns true if both values are equal.
    */
-  bool operator==(const Bfloat16 &rhs) const;
+  constexpr bool operator==(const Bfloat16 &rhs) const {
+    return static_cast<float>(*this) == static_cast<float>(rhs);
+  }
 
   /**
    * Not equal operator.
@@ -88,7 +96,9 @@ public:
    * @param[in] rhs Value to compare against.
    * @returns true if values are not equal bitwise.
    */
-  bool operator!=(const Bfloat16 &rhs) const;
+  constexpr bool operator!=(const Bfloat16 &rhs) const {
+    return !(*this == rhs);
+  }
 
   /**
    * Less than operator.
@@ -96,7 +106,9 @@ public:
    * @param[in] rhs Value to compare.
    * @returns true if this is less than rhs.
    */
-  bool operator<(const Bfloat16 &rhs) const;
+  constexpr bool operator<(const Bfloat16 &rhs) const {
+    return static_cast<float>(*this) < static_cast<float>(rhs);
+  }
 
   /**
    * Greater than operator.
@@ -104,7 +116,7 @@ public:
    * @param[in] rhs Value to compare.
    * @returns true if this is greater than rhs.
    */
-  bool operator>(const Bfloat16 &rhs) const;
+  constexpr bool operator>(const Bfloat16 &rhs) const { return rhs < *this; }
 
   /**
    * Less than or equal operator.
@@ -112,7 +124,9 @@ public:
    * @param[in] rhs Value to compare.
    * @returns true if this is less than or equal to rhs.
    */
-  bool operator<=(const Bfloat16 &rhs) const;
+  constexpr bool operator<=(const Bfloat16 &rhs) const {
+    return !(*this > rhs);
+  }
 
   /**
    * Greater than or equal operator.
@@ -120,24 +134,40 @@ public:
    * @param[in] rhs Value to compare.
    * @returns true if this is greater than or equal to rhs.
    */
-  bool operator>=(const Bfloat16 &rhs) const;
+  constexpr bool operator>=(const Bfloat16 &rhs) const {
+    return !(*this < rhs);
+  }
 
   /**
    * Unary plus operator.
    */
-  Bfloat16 operator+() const;
+  constexpr Bfloat16 operator+() const { return *this; }
 
   /**
    * Unary minus operator.
    */
-  Bfloat16 operator-() const;
+  constexpr Bfloat16 operator-() const {
+    constexpr uint16_t sign_mask = 0x8000;
+    return Bfloat16::encode(data ^ sign_mask);
+  }
 
   /**
    * Nan sensitive equal
    *
    * @returns bool value - result of comparison
    */
-  bool nan_sensitive_eq(const Bfloat16 &rhs) const;
+  constexpr bool nan_sensitive_eq(const Bfloat16 &rhs) const {
+    constexpr uint16_t exponent_mask = 0x7f80;
+    constexpr uint16_t mantissa_mask = 0x007f;
+    const bool this_nan =
+        (data & exponent_mask) == exponent_mask && (data & mantissa_mask) != 0;
+    const bool rhs_nan = (rhs.data & exponent_mask) == exponent_mask &&
+                         (rhs.data & mantissa_mask) != 0;
+    if (this_nan && rhs_nan) {
+      return true;
+    }
+    return data == rhs.data;
+  }
 
   /**
    * Metadata needed to distinguish vector-like data types.
@@ -408,14 +438,24 @@ template <> struct is_custom_type<Bfloat16> : std::true_type {};
  *
  * @param[in] value object to use.
  */
-bool isnan(Bfloat16 value);
+constexpr bool isnan(Bfloat16 value) {
+  constexpr uint16_t exponent_mask = 0x7f80;
+  constexpr uint16_t mantissa_mask = 0x007f;
+  return (value.decode() & exponent_mask) == exponent_mask &&
+         (value.decode() & mantissa_mask) != 0;
+}
 
 /**
  * Checks whether the value is Infinity.
  *
  * @param[in] value object to use.
  */
-bool isinf(Bfloat16 value);
+constexpr bool isinf(Bfloat16 value) {
+  constexpr uint16_t exponent_mask = 0x7f80;
+  constexpr uint16_t mantissa_mask = 0x007f;
+  return (value.decode() & exponent_mask) == exponent_mask &&
+         (value.decode() & mantissa_mask) == 0;
+}
 
 /**
  * Categorizes floating point values into the following categories:
@@ -424,7 +464,17 @@ bool isinf(Bfloat16 value);
  * @param[in] value object to use.
  * @returns classification value.
  */
-int fpclassify(Bfloat16 value);
+constexpr int fpclassify(Bfloat16 value) {
+  constexpr uint16_t exponent_mask = 0x7f80;
+  constexpr uint16_t mantissa_mask = 0x007f;
+  if ((value.decode() & exponent_mask) == 0) {
+    return (value.decode() & mantissa_mask) != 0 ? FP_SUBNORMAL : FP_ZERO;
+  }
+  if ((value.decode() & exponent_mask) == exponent_mask) {
+    return (value.decode() & mantissa_mask) != 0 ? FP_NAN : FP_INFINITE;
+  }
+  return FP_NORMAL;
+}
 
 /**
  * Computes the absolute value of a Bfloat16 value arg.
@@ -432,7 +482,10 @@ int fpclassify(Bfloat16 value);
  * @param[in] value object to use.
  * @returns absolute value.
  */
-Bfloat16 abs(Bfloat16 value);
+constexpr Bfloat16 abs(Bfloat16 value) {
+  constexpr uint16_t sign_mask = 0x8000;
+  return Bfloat16::encode(value.decode() & ~sign_mask);
+}
 
 /**
  * Computes the square root of a Bfloat16 value arg.
@@ -449,7 +502,30 @@ Bfloat16 sqrt(Bfloat16 value);
  * @param[in] to value toward which the return value is approximated.
  * @returns the next representable value.
  */
-Bfloat16 nextafter(const Bfloat16 from, const Bfloat16 to);
+constexpr Bfloat16 nextafter(const Bfloat16 from, const Bfloat16 to) {
+  constexpr uint16_t sign_mask = 0x8000;
+  constexpr uint16_t quiet_bit = 0x0040;
+  if (isnan(from) || isnan(to)) {
+    // Propagate NaN operand as quiet NaN
+    return Bfloat16::encode((isnan(from) ? from.decode() : to.decode()) |
+                            quiet_bit);
+  }
+  if (from == to) {
+    return to;
+  }
+  if ((from.decode() & ~sign_mask) == 0) {
+    return Bfloat16::encode(to.decode() & sign_mask ? sign_mask | 1 : 1);
+  }
+
+  uint16_t from_data = from.decode();
+  const uint16_t to_data = to.decode();
+  if (from_data < sign_mask) { // from is positive
+    from_data += (to_data > from_data && to_data < sign_mask) ? 1 : -1;
+  } else {
+    from_data += (to_data > from_data && to_data >= sign_mask) ? 1 : -1;
+  }
+  return Bfloat16::encode(from_data);
+}
 
 /**
  * Value with magnitude of first argument and sign of second argument.
@@ -458,7 +534,43 @@ Bfloat16 nextafter(const Bfloat16 from, const Bfloat16 to);
  * @param[in] sign.
  * @returns value.
  */
-Bfloat16 copysign(Bfloat16 magnitude, Bfloat16 sign);
+constexpr Bfloat16 copysign(Bfloat16 magnitude, Bfloat16 sign) {
+  constexpr uint16_t sign_mask = 0x8000;
+  return Bfloat16::encode((magnitude.decode() & ~sign_mask) |
+                          (sign.decode() & sign_mask));
+}
+
+/**
+ * Convert floats to Bfloat16 values.
+ *
+ * Results are bit-identical to Bfloat16(float).
+ *
+ * @param[in] input values to convert.
+ * @param[out] output converted values, same size as input.
+ * @throws std::invalid_argument Thrown if sizes do not match.
+ */
+void convert(std::span<const float> input, std::span<Bfloat16> output);
+
+/**
+ * Convert Bfloat16 values to floats.
+ *
+ * Results are bit-identical to static_cast<float>(Bfloat16).
+ *
+ * @param[in] input values to convert.
+ * @param[out] output converted values, same size as input.
+ * @throws std::invalid_argument Thrown if sizes do not match.
+ */
+void convert(std::span<const Bfloat16> input, std::span<float> output);
+
+/**
+ * Get table of float values of all Bfloat16 bit patterns.
+ *
+ * Lookup with Bfloat16::decode() as index is an alternative to the float
+ * conversion operator for types with a 16-bit storage.
+ *
+ * @returns table with 65536 entries.
+ */
+const std::array<float, 65536> &get_bfloat16_to_float_table();
 
 } // namespace cassian
 
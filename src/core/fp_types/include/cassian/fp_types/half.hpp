@@ -8,9 +8,13 @@
 #ifndef CASSIAN_FP_TYPES_HALF_HPP
 #define CASSIAN_FP_TYPES_HALF_HPP
 
+#include <array>
+#include <bit>
+#include <cfenv>
 #include <cmath>
 #include <cstdint>
 #include <limits>
+#include <span>
 #include <string>
 
 #include <cassian/fp_types/type_traits.hpp>
@@ -73,7 +77,30 @@ public:
    *
    * @returns value converted to float
    */
-  explicit operator float() const;
+  constexpr explicit operator float() const {
+    constexpr uint32_t sign_mask = 0x8000;
+    constexpr uint32_t exponent_mask = 0x7c00;
+    constexpr uint32_t mantissa_mask = 0x03ff;
+    constexpr uint32_t float_exponent_mask = 0x7f800000;
+    constexpr uint32_t exponent_bias_diff = (127 - 15) << 10;
+    constexpr int mantissa_shift = 23 - 10;
+    // smallest half denorm = 2^-14 * 2^-10 = 2^-24
+    constexpr float denorm_scale = 0x1p-24F;
+    const uint32_t sign = (data & sign_mask) << 16;
+    const uint32_t exponent = data & exponent_mask;
+    const uint32_t mantissa = data & mantissa_mask;
+    if (exponent == exponent_mask) {
+      return std::bit_cast<float>(sign | float_exponent_mask |
+                                  (mantissa << mantissa_shift));
+    }
+    if (exponent != 0) {
+      return std::bit_cast<float>(
+          sign | ((exponent + exponent_bias_diff) | mantissa)
+                     << mantissa_shift);
+    }
+    const float value = static_cast<float>(mantissa) * denorm_scale;
+    return sign != 0 ? -value : value;
+  }
 
   /**
    * Conversion operator to integral types, double and long double
@@ -116,7 +143,9 @@ public:
    * @param[in] rhs Value to compare against.
    * @returns true if both values are equal.
    */
-  bool operator==(const Half &rhs) const;
+  constexpr bool operator==(const Half &rhs) const {
+    return static_cast<float>(*this) == static_cast<float>(rhs);
+  }
 
   /**
    * Not equal operator.
@@ -124,7 +153,7 @@ public:
    * @param[in] rhs Value to compare against.
    * @returns true if values are not equal bitwise.
    */
-  bool operator!=(const Half &rhs) const;
+  constexpr bool operator!=(const Half &rhs) const { return !(*this == rhs); }
 
   /**
    * Less than operator.
@@ -132,7 +161,9 @@ public:
    * @param[in] rhs Value to compare.
    * @returns true if this is less than rhs.
    */
-  bool operator<(const Half &rhs) const;
+  constexpr bool operator<(const Half &rhs) const {
+    return static_cast<float>(*this) < static_cast<float>(rhs);
+  }
 
   /**
    * Greater than operator.
@@ -140,7 +171,7 @@ public:
    * @param[in] rhs Value to compare.
    * @returns true if this is greater than rhs.
    */
-  bool operator>(const Half &rhs) const;
+  constexpr bool operator>(const Half &rhs) const { return rhs < *this; }
 
   /**
    * Less than or equal operator.
@@ -148,7 +179,7 @@ public:
    * @param[in] rhs Value to compare.
    * @returns true if this is less than or equal to rhs.
    */
-  bool operator<=(const Half &rhs) const;
+  constexpr bool operator<=(const Half &rhs) const { return !(*this > rhs); }
 
   /**
    * Greater than or equal operator.
@@ -156,14 +187,25 @@ public:
    * @param[in] rhs Value to compare.
    * @returns true if this is greater than or equal to rhs.
    */
-  bool operator>=(const Half &rhs) const;
+  constexpr bool operator>=(const Half &rhs) const { return !(*this < rhs); }
 
   /**
    * Nan sensitive equal
    *
    * @returns bool value - result of comparison
    */
-  bool nan_sensitive_eq(const Half &rhs) const;
+  constexpr bool nan_sensitive_eq(const Half &rhs) const {
+    constexpr uint16_t exponent_mask = 0x7c00;
+    constexpr uint16_t mantissa_mask = 0x03ff;
+    const bool this_nan =
+        (data & exponent_mask) == exponent_mask && (data & mantissa_mask) != 0;
+    const bool rhs_nan = (rhs.data & exponent_mask) == exponent_mask &&
+                         (rhs.data & mantissa_mask) != 0;
+    if (this_nan && rhs_nan) {
+      return true;
+    }
+    return data == rhs.data;
+  }
 
   /**
    * Metadata needed to distinguish vector-like data types.
@@ -653,37 +695,6 @@ protected:
    */
   friend std::ostream &operator<<(std::ostream &os, const Half &value);
 
-  /**
-   * Checks whether the value is NaN.
-   *
-   * @param[in] value object to use.
-   */
-  friend bool isnan(Half value);
-
-  /**
-   * Checks whether the value is Inf.
-   *
-   * @param[in] value object to use.
-   */
-  friend bool isinf(Half value);
-
-  /**
-   * Categorizes floating point values into the following categories:
-   * zero, subnormal, normal, infinite, NAN
-   *
-   * @param[in] value object to use.
-   * @returns classification value.
-   */
-  friend int fpclassify(Half value);
-
-  /**
-   * Computes the absolute value of a Half value arg.
-   *
-   * @param[in] value object to use.
-   * @returns absolute value.
-   */
-  friend Half abs(Half value);
-
   /**
    * Computes the square root of a Half value arg.
    *
@@ -692,15 +703,6 @@ protected:
    */
   friend Half sqrt(Half value);
 
-  /**
-   * Computes the next representable value of from in the direction of to.
-   *
-   * @param[in] from base value.
-   * @param[in] to value toward which the return value is approximated.
-   * @returns the next representable value.
-   */
-  friend Half nextafter(const Half from, const Half to);
-
   friend Half acos(Half value);
 
   friend Half acosh(Half value);
@@ -725,15 +727,6 @@ protected:
 
   friend Half cbrt(Half value);
 
-  /**
-   * Value with magnitude of first argument and sign of second argument.
-   *
-   * @param[in] magnitude.
-   * @param[in] sign.
-   * @returns value.
-   */
-  friend Half copysign(Half value_a, Half value_b);
-
   friend Half cos(Half value);
 
   friend Half cosh(Half value);
@@ -808,6 +801,140 @@ template <> struct is_floating_point<Half> : std::true_type {};
 
 template <> struct is_custom_type<Half> : std::true_type {};
 
+/**
+ * Checks whether the value is NaN.
+ *
+ * @param[in] value object to use.
+ */
+constexpr bool isnan(Half value) {
+  constexpr uint16_t exponent_mask = 0x7c00;
+  constexpr uint16_t mantissa_mask = 0x03ff;
+  return (value.decode() & exponent_mask) == exponent_mask &&
+         (value.decode() & mantissa_mask) != 0;
+}
+
+/**
+ * Checks whether the value is Inf.
+ *
+ * @param[in] value object to use.
+ */
+constexpr bool isinf(Half value) {
+  constexpr uint16_t exponent_mask = 0x7c00;
+  constexpr uint16_t mantissa_mask = 0x03ff;
+  return (value.decode() & exponent_mask) == exponent_mask &&
+         (value.decode() & mantissa_mask) == 0;
+}
+
+/**
+ * Categorizes floating point values into the following categories:
+ * zero, subnormal, normal, infinite, NAN
+ *
+ * @param[in] value object to use.
+ * @returns classification value.
+ */
+constexpr int fpclassify(Half value) {
+  constexpr uint16_t exponent_mask = 0x7c00;
+  constexpr uint16_t mantissa_mask = 0x03ff;
+  if ((value.decode() & exponent_mask) == 0) {
+    return (value.decode() & mantissa_mask) != 0 ? FP_SUBNORMAL : FP_ZERO;
+  }
+  if ((value.decode() & exponent_mask) == exponent_mask) {
+    return (value.decode() & mantissa_mask) != 0 ? FP_NAN : FP_INFINITE;
+  }
+  return FP_NORMAL;
+}
+
+/**
+ * Computes the absolute value of a Half value arg.
+ *
+ * @param[in] value object to use.
+ * @returns absolute value.
+ */
+constexpr Half abs(Half value) {
+  constexpr uint16_t sign_mask = 0x8000;
+  return Half::encode(value.decode() & ~sign_mask);
+}
+
+/**
+ * Computes the next representable value of from in the direction of to.
+ *
+ * @param[in] from base value.
+ * @param[in] to value toward which the return value is approximated.
+ * @returns the next representable value.
+ */
+constexpr Half nextafter(const Half from, const Half to) {
+  constexpr uint16_t sign_mask = 0x8000;
+  constexpr uint16_t quiet_bit = 0x0200;
+  if (isnan(from) || isnan(to)) {
+    // Propagate NaN operand as quiet NaN
+    return Half::encode((isnan(from) ? from.decode() : to.decode()) |
+                        quiet_bit);
+  }
+  if (from == to) {
+    return to;
+  }
+  if ((from.decode() & ~sign_mask) == 0) {
+    return Half::encode(to.decode() & sign_mask ? sign_mask | 1 : 1);
+  }
+
+  uint16_t from_data = from.decode();
+  const uint16_t to_data = to.decode();
+  if (from_data < sign_mask) { // from is positive
+    from_data += (to_data > from_data && to_data < sign_mask) ? 1 : -1;
+  } else {
+    from_data += (to_data > from_data && to_data >= sign_mask) ? 1 : -1;
+  }
+  return Half::encode(from_data);
+}
+
+/**
+ * Value with magnitude of first argument and sign of second argument.
+ *
+ * @param[in] magnitude.
+ * @param[in] sign.
+ * @returns value.
+ */
+constexpr Half copysign(Half magnitude, Half sign) {
+  constexpr uint16_t sign_mask = 0x8000;
+  return Half::encode((magnitude.decode() & ~sign_mask) |
+                      (sign.decode() & sign_mask));
+}
+
+/**
+ * Convert floats to halves.
+ *
+ * Results are bit-identical to Half(float). The rounding mode is read once
+ * per call instead of once per element.
+ *
+ * @param[in] input values to convert.
+ * @param[out] output converted values, same size as input.
+ * @param[in] rounding_mode rounding mode, one of FE_* macros.
+ * @throws std::invalid_argument Thrown if sizes do not match.
+ */
+void convert(std::span<const float> input, std::span<Half> output,
+             int rounding_mode = std::fegetround());
+
+/**
+ * Convert halves to floats.
+ *
+ * Results are bit-identical to static_cast<float>(Half).
+ *
+ * @param[in] input values to convert.
+ * @param[out] output converted values, same size as input.
+ * @throws std::invalid_argument Thrown if sizes do not match.
+ */
+void convert(std::span<const Half> input, std::span<float> output);
+
+/**
+ * Get table of float values of all Half bit patterns.
+ *
+ * Lookup with Half::decode() as index replaces the bit manipulation of the
+ * float conversion operator with a single load.
+ *
+ * @returns table with 65536 entries.
+ */
+const std::array<float, 65536> &get_half_to_float_table();
+
 } // namespace cassian
 
 /**
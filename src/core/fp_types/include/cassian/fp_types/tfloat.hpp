@@ -11,6 +11,7 @@
 #include <cmath>
 #include <cstdint>
 #include <limits>
+#include <span>
 #include <string>
 #include <type_traits>
 
@@ -445,6 +446,28 @@ Tfloat nextafter(const Tfloat from, const Tfloat to);
  */
 Tfloat copysign(Tfloat magnitude, Tfloat sign);
 
+/**
+ * Convert floats to Tfloat values.
+ *
+ * Results are bit-identical to Tfloat(float).
+ *
+ * @param[in] input values to convert.
+ * @param[out] output converted values, same size as input.
+ * @throws std::invalid_argument Thrown if sizes do not match.
+ */
+void convert(std::span<const float> input, std::span<Tfloat> output);
+
+/**
+ * Convert Tfloat values to floats.
+ *
+ * Results are bit-identical to static_cast<float>(Tfloat).
+ *
+ * @param[in] input values to convert.
+ * @param[out] output converted values, same size as input.
+ * @throws std::invalid_argument Thrown if sizes do not match.
+ */
+void convert(std::span<const Tfloat> input, std::span<float> output);
+
 } // namespace cassian
 
 /**
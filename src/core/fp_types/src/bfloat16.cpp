@@ -5,9 +5,13 @@
  *
  */
 
+#include <array>
+#include <cstddef>
 #include <cstring>
 #include <iomanip>
+#include <span>
 #include <sstream>
+#include <stdexcept>
 
 #include <cassian/fp_types/bfloat16.hpp>
 
@@ -45,37 +49,45 @@ Bfloat16::Bfloat16(float v) {
   data = static_cast<uint16_t>(tmp);
 }
 
-Bfloat16::operator float() const {
-  float tmp_f = 0;
-  uint32_t tmp_32 = data;
-  const int remainder_bits = 16;
-  tmp_32 = tmp_32 << remainder_bits;
-  std::memcpy(&tmp_f, &tmp_32, sizeof(uint32_t));
-  return tmp_f;
-}
-
-bool Bfloat16::operator==(const Bfloat16 &rhs) const {
-  const auto f_lhs = static_cast<float>(*this);
-  const auto f_rhs = static_cast<float>(rhs);
-  return f_lhs == f_rhs;
+void convert(std::span<const float> input, std::span<Bfloat16> output) {
+  constexpr int remainder_bits = 16;
+  constexpr uint32_t remainder_mask = (1 << remainder_bits) - 1;
+  constexpr uint32_t remainder_highest_bit = 0x8000;
+  constexpr uint32_t exponent_mask = 0x7f80;
+  constexpr uint32_t mantissa_mask = 0x007f;
+  if (input.size() != output.size()) {
+    throw std::invalid_argument("Input and output sizes differ");
+  }
+  // Branchless form of Bfloat16(float) so that the loop can be vectorized
+  for (size_t i = 0; i < input.size(); i++) {
+    uint32_t tmp = 0;
+    std::memcpy(&tmp, &input[i], sizeof(uint32_t));
+    const uint32_t remainder = tmp & remainder_mask;
+    tmp = tmp >> remainder_bits;
+    const bool is_nan_or_inf = (tmp & exponent_mask) == exponent_mask;
+    const bool round_up =
+        !is_nan_or_inf &&
+        (remainder > remainder_highest_bit ||
+         (remainder == remainder_highest_bit && (tmp & 1) != 0));
+    const uint32_t nan_bits =
+        is_nan_or_inf && remainder != 0 ? mantissa_mask : 0;
+    output[i] = Bfloat16::encode(
+        static_cast<uint16_t>((tmp + (round_up ? 1 : 0)) | nan_bits));
+  }
 }
 
-bool Bfloat16::operator!=(const Bfloat16 &rhs) const {
-  return !(*this == rhs);
-};
-
-bool Bfloat16::operator<(const Bfloat16 &rhs) const {
-  const auto f_lhs = static_cast<float>(*this);
-  const auto f_rhs = static_cast<float>(rhs);
-  return f_lhs < f_rhs;
+void convert(std::span<const Bfloat16> input, std::span<float> output) {
+  constexpr int remainder_bits = 16;
+  if (input.size() != output.size()) {
+    throw std::invalid_argument("Input and output sizes differ");
+  }
+  for (size_t i = 0; i < input.size(); i++) {
+    const uint32_t tmp = static_cast<uint32_t>(input[i].decode())
+                         << remainder_bits;
+    std::memcpy(&output[i], &tmp, sizeof(uint32_t));
+  }
 }
 
-bool Bfloat16::operator>(const Bfloat16 &rhs) const { return rhs < *this; };
-
-bool Bfloat16::operator<=(const Bfloat16 &rhs) const { return !(*this > rhs); };
-
-bool Bfloat16::operator>=(const Bfloat16 &rhs) const { return !(*this < rhs); };
-
 Bfloat16 operator+(Bfloat16 lhs, Bfloat16 rhs) {
   return Bfloat16(static_cast<float>(lhs) + static_cast<float>(rhs));
 };
@@ -92,24 +104,16 @@ Bfloat16 operator/(Bfloat16 lhs, Bfloat16 rhs) {
   return Bfloat16(static_cast<float>(lhs) / static_cast<float>(rhs));
 };
 
-Bfloat16 Bfloat16::operator+() const { return Bfloat16::encode(data); }
-
-Bfloat16 Bfloat16::operator-() const {
-  const uint16_t sign_mask = 0x8000;
-  return Bfloat16::encode(data ^ sign_mask);
-}
-
-bool Bfloat16::nan_sensitive_eq(const Bfloat16 &rhs) const {
-  const uint16_t exponent_mask = 0x7f80;
-  const uint16_t mantissa_mask = 0x007f;
-  const bool this_nan =
-      (data & exponent_mask) == exponent_mask && (data & mantissa_mask) != 0;
-  const bool rhs_nan = (rhs.data & exponent_mask) == exponent_mask &&
-                       (rhs.data & mantissa_mask) != 0;
-  if (this_nan && rhs_nan) {
-    return true;
-  }
-  return data == rhs.data;
+const std::array<float, 65536> &get_bfloat16_to_float_table() {
+  static const auto table = [] {
+    std::array<float, 65536> values{};
+    for (size_t i = 0; i < values.size(); i++) {
+      values[i] =
+          static_cast<float>(Bfloat16::encode(static_cast<uint16_t>(i)));
+    }
+    return values;
+  }();
+  return table;
 }
 
 std::string to_string(const Bfloat16 &value) {
@@ -124,76 +128,8 @@ std::ostream &operator<<(std::ostream &os, const Bfloat16 &value) {
   return os;
 }
 
-bool isnan(Bfloat16 value) {
-  const uint16_t exponent_mask = 0x7f80;
-  const uint16_t mantissa_mask = 0x007f;
-  return (value.decode() & exponent_mask) == exponent_mask &&
-         (value.decode() & mantissa_mask) != 0;
-}
-
-bool isinf(Bfloat16 value) {
-  const uint16_t exponent_mask = 0x7f80;
-  const uint16_t mantissa_mask = 0x007f;
-  return (value.decode() & exponent_mask) == exponent_mask &&
-         (value.decode() & mantissa_mask) == 0;
-}
-
-int fpclassify(Bfloat16 value) {
-  const uint16_t exponent_mask = 0x7f80;
-  const uint16_t mantissa_mask = 0x007f;
-  if ((value.decode() & exponent_mask) == 0) {
-    if ((value.decode() & mantissa_mask) != 0) {
-      return FP_SUBNORMAL;
-    }
-    return FP_ZERO;
-  }
-  if ((value.decode() & exponent_mask) == exponent_mask) {
-    if ((value.decode() & mantissa_mask) != 0) {
-      return FP_NAN;
-    }
-    return FP_INFINITE;
-  }
-  return FP_NORMAL;
-}
-
-Bfloat16 abs(Bfloat16 value) {
-  const uint16_t sign_mask = 0x8000;
-  return Bfloat16::encode(value.decode() & ~sign_mask);
-}
-
 Bfloat16 sqrt(Bfloat16 value) {
   return Bfloat16(std::sqrt(static_cast<float>(value)));
 }
 
-Bfloat16 nextafter(const Bfloat16 from, const Bfloat16 to) {
-  if (isnan(from) || isnan(to)) {
-    return from + to;
-  }
-  if (from == to) {
-    return to;
-  }
-  if (from == static_cast<Bfloat16>(0.0F)) {
-    return (to > static_cast<Bfloat16>(0.0F))
-               ? std::numeric_limits<Bfloat16>::denorm_min()
-               : -std::numeric_limits<Bfloat16>::denorm_min();
-  }
-
-  uint16_t from_data = from.decode();
-  const uint16_t to_data = to.decode();
-  const uint16_t sign_mask = 0x8000;
-
-  if (from_data < sign_mask) { // from is positive
-    from_data += (to_data > from_data && to_data < sign_mask) ? 1 : -1;
-  } else {
-    from_data += (to_data > from_data && to_data >= sign_mask) ? 1 : -1;
-  }
-
-  return Bfloat16::encode(from_data);
-}
-
-Bfloat16 copysign(Bfloat16 magnitude, Bfloat16 sign) {
-  const uint16_t sign_mask = 0x8000;
-  return Bfloat16::encode((magnitude.decode() & ~sign_mask) |
-                          (sign.decode() & sign_mask));
-}
 } // namespace cassian
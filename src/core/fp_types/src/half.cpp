@@ -5,19 +5,28 @@
  *
  */
 
+#include <array>
 #include <cassian/fp_types/half.hpp>
 #include <cfenv>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <iomanip>
+#include <span>
 #include <sstream>
+#include <stdexcept>
+
+#if (defined(__GNUC__) || defined(__clang__)) &&                              \
+    (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define CASSIAN_FP_TYPES_F16C
+#endif
 
 namespace cassian {
 
-Half::Half(float v) {
-  uint32_t bits = 0;
-  std::memcpy(&bits, &v, sizeof(v));
+namespace {
 
+uint16_t float_to_half_bits(const uint32_t bits, const int rounding_mode) {
   constexpr uint32_t float_sign_mask = 0x80000000;
   constexpr uint32_t float_exp_mask = 0x7f800000;
   constexpr uint32_t float_mantissa_mask = 0x007fffff;
@@ -85,15 +94,15 @@ Half::Half(float v) {
       const bool rest = (mantissa32 & half_rest_unsaved_mask) != 0;
       const bool is_odd = (mantissa16 & 1) != 0;
       const bool is_negative = sign != 0;
-      if (std::fegetround() == FE_TONEAREST) {
+      if (rounding_mode == FE_TONEAREST) {
         if (next && (is_odd || rest)) {
           mantissa16 += 1;
         }
-      } else if (std::fegetround() == FE_UPWARD) {
+      } else if (rounding_mode == FE_UPWARD) {
         if (!is_negative && (next || rest)) {
           mantissa16 += 1;
         }
-      } else if (std::fegetround() == FE_DOWNWARD) {
+      } else if (rounding_mode == FE_DOWNWARD) {
         if (is_negative && (next || rest)) {
           mantissa16 += 1;
         }
@@ -104,7 +113,38 @@ Half::Half(float v) {
     }
   }
 
-  data = sign + (biased_exp16 << half_exp_shift) + mantissa16;
+  return sign + (biased_exp16 << half_exp_shift) + mantissa16;
+}
+
+#ifdef CASSIAN_FP_TYPES_F16C
+// Hardware conversion matches float_to_half_bits only when rounding to
+// nearest even, other modes are handled by the portable loop.
+__attribute__((target("avx,f16c"))) size_t
+convert_f16c(const float *input, Half *output, const size_t size) {
+  constexpr size_t lanes = 8;
+  size_t i = 0;
+  for (; i + lanes <= size; i += lanes) {
+    const __m256 value = _mm256_loadu_ps(input + i);
+    const __m128i result =
+        _mm256_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), result);
+  }
+  return i;
+}
+
+bool is_f16c_supported() {
+  static const bool supported =
+      __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+  return supported;
+}
+#endif
+
+} // namespace
+
+Half::Half(float v) {
+  uint32_t bits = 0;
+  std::memcpy(&bits, &v, sizeof(v));
+  data = float_to_half_bits(bits, std::fegetround());
 }
 
 Half::Half(float v, const float random) {
@@ -175,72 +215,42 @@ Half::Half(float v, const float random) {
       (sign << sign_half_shift) | (exponent << exponent_half_shift) | mantissa;
 }
 
-Half::operator float() const {
-  const uint32_t float16_exp_shift = (23 - 10);
-  const uint32_t float16_exp_mask = 0x7c00;
-  const uint32_t float32_exp_mask = 0x7f800000;
-  const uint32_t float16_mantissa_mask = 0x03ff;
-  // -9 is needed because later we do multiplication of floats
-  // 127 - 15 - 9 = 103, float exponent: 103 - 127 = -24
-  // smallest half denorm = 2^-14 * 2^-10 = 2^-24
-  // 2^-24 * float(mantissa = 0x0001) = 2^-24 * 1.0
-  const uint32_t float16_to_32_bias_diff_denorm = ((127 - 15 - 9) << 23);
-  const uint32_t float16_to_32_bias_diff = ((127 - 15) << 10);
-  const uint32_t float16_sign_mask = 0x8000;
-  const uint32_t exp = data & float16_exp_mask;
-  const uint32_t mantissa = data & float16_mantissa_mask;
-  const uint32_t sign = (data & float16_sign_mask) << 16;
-  const uint32_t nan = (exp == float16_exp_mask ? float32_exp_mask : 0U);
-  // 0.0
-  if ((exp | mantissa) == 0) {
-    return *reinterpret_cast<const float *>(&sign);
+void convert(std::span<const float> input, std::span<Half> output,
+             const int rounding_mode) {
+  if (input.size() != output.size()) {
+    throw std::invalid_argument("Input and output sizes differ");
   }
-  // normals
-  if (exp != 0) {
-    uint32_t tmp =
-        (((exp + float16_to_32_bias_diff) | mantissa) << float16_exp_shift) |
-        nan | sign;
-    return *reinterpret_cast<float *>(&tmp);
+  size_t i = 0;
+#ifdef CASSIAN_FP_TYPES_F16C
+  if (rounding_mode == FE_TONEAREST && is_f16c_supported()) {
+    i = convert_f16c(input.data(), output.data(), input.size());
+  }
+#endif
+  for (; i < input.size(); i++) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &input[i], sizeof(bits));
+    output[i] = Half::encode(float_to_half_bits(bits, rounding_mode));
   }
-  // subnormals
-  float tmpf =
-      *reinterpret_cast<const float *>(&float16_to_32_bias_diff_denorm) *
-      static_cast<float>(mantissa);
-  *reinterpret_cast<uint32_t *>(&tmpf) |= sign;
-  return tmpf;
-}
-
-bool Half::operator==(const Half &rhs) const {
-  const auto f_lhs = static_cast<float>(*this);
-  const auto f_rhs = static_cast<float>(rhs);
-  return f_lhs == f_rhs;
 }
 
-bool Half::operator!=(const Half &rhs) const { return !(*this == rhs); };
-
-bool Half::operator<(const Half &rhs) const {
-  const auto f_lhs = static_cast<float>(*this);
-  const auto f_rhs = static_cast<float>(rhs);
-  return f_lhs < f_rhs;
+void convert(std::span<const Half> input, std::span<float> output) {
+  if (input.size() != output.size()) {
+    throw std::invalid_argument("Input and output sizes differ");
+  }
+  for (size_t i = 0; i < input.size(); i++) {
+    output[i] = static_cast<float>(input[i]);
+  }
 }
 
-bool Half::operator>(const Half &rhs) const { return rhs < *this; };
-
-bool Half::operator<=(const Half &rhs) const { return !(*this > rhs); };
-
-bool Half::operator>=(const Half &rhs) const { return !(*this < rhs); };
-
-bool Half::nan_sensitive_eq(const Half &rhs) const {
-  const uint16_t exponent_mask = 0x7c00;
-  const uint16_t mantissa_mask = 0x03ff;
-  const bool this_nan =
-      (data & exponent_mask) == exponent_mask && (data & mantissa_mask) != 0;
-  const bool rhs_nan = (rhs.data & exponent_mask) == exponent_mask &&
-                       (rhs.data & mantissa_mask) != 0;
-  if (this_nan && rhs_nan) {
-    return true;
-  }
-  return data == rhs.data;
+const std::array<float, 65536> &get_half_to_float_table() {
+  static const auto table = [] {
+    std::array<float, 65536> values{};
+    for (size_t i = 0; i < values.size(); i++) {
+      values[i] = static_cast<float>(Half::encode(static_cast<uint16_t>(i)));
+    }
+    return values;
+  }();
+  return table;
 }
 
 Half operator+(Half lhs, Half rhs) {
@@ -271,40 +281,6 @@ std::ostream &operator<<(std::ostream &os, const Half &value) {
   return os;
 }
 
-bool isnan(Half value) {
-  const uint16_t exponent_mask = 0x7c00;
-  const uint16_t mantissa_mask = 0x03ff;
-  return (value.decode() & exponent_mask) == exponent_mask &&
-         (value.decode() & mantissa_mask) != 0;
-}
-
-bool isinf(Half value) {
-  const uint16_t exponent_mask = 0x7c00;
-  const uint16_t mantissa_mask = 0x03ff;
-  return (value.decode() & exponent_mask) == exponent_mask &&
-         (value.decode() & mantissa_mask) == 0;
-}
-
-int fpclassify(Half value) {
-  const uint16_t exponent_mask = 0x7c00;
-  const uint16_t mantissa_mask = 0x03ff;
-  if ((value.decode() & exponent_mask) == 0) {
-    if ((value.decode() & mantissa_mask) != 0) {
-      return FP_SUBNORMAL;
-    }
-    return FP_ZERO;
-  }
-  if ((value.decode() & exponent_mask) == exponent_mask) {
-    if ((value.decode() & mantissa_mask) != 0) {
-      return FP_NAN;
-    }
-    return FP_INFINITE;
-  }
-  return FP_NORMAL;
-}
-
-Half abs(Half value) { return Half::encode(value.decode() & ~(1 << 15)); }
-
 Half sqrt(Half value) { return Half(std::sqrt(static_cast<float>(value))); }
 
 Half acos(Half value) { return Half(std::acos(static_cast<float>(value))); }
@@ -334,12 +310,6 @@ Half atan2(Half value_a, Half value_b) {
 
 Half cbrt(Half value) { return Half(std::cbrt(static_cast<float>(value))); }
 
-Half copysign(Half value_a, Half value_b) {
-  const uint16_t sign_mask = 0x8000;
-  return Half::encode((value_a.decode() & ~sign_mask) |
-                      (value_b.decode() & sign_mask));
-}
-
 Half cos(Half value) { return Half(std::cos(static_cast<float>(value))); }
 
 Half cosh(Half value) { return Half(std::cosh(static_cast<float>(value))); }
@@ -377,31 +347,6 @@ Half remainder(Half value_a, Half value_b) {
       std::remainder(static_cast<float>(value_a), static_cast<float>(value_b)));
 }
 
-Half nextafter(const Half from, const Half to) {
-  if (isnan(from) || isnan(to)) {
-    return from + to;
-  }
-  if (from == to) {
-    return to;
-  }
-  if (from == 0.0F) {
-    return (to > 0.0F) ? std::numeric_limits<Half>::denorm_min()
-                       : -std::numeric_limits<Half>::denorm_min();
-  }
-
-  uint16_t from_data = from.decode();
-  const uint16_t to_data = to.decode();
-  const uint16_t sign_mask = 0x8000;
-
-  if (from_data < sign_mask) { // from is positive
-    from_data += (to_data > from_data && to_data < sign_mask) ? 1 : -1;
-  } else {
-    from_data += (to_data > from_data && to_data >= sign_mask) ? 1 : -1;
-  }
-
-  return Half::encode(from_data);
-}
-
 Half rint(Half value) { return Half(std::rint(static_cast<float>(value))); }
 
 Half floor(Half value) { return Half(std::floor(static_cast<float>(value))); }
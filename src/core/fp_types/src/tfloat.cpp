@@ -5,9 +5,12 @@
  *
  */
 
+#include <cstddef>
 #include <cstring>
 #include <iomanip>
+#include <span>
 #include <sstream>
+#include <stdexcept>
 
 #include <cassian/fp_types/tfloat.hpp>
 
@@ -48,6 +51,43 @@ Tfloat::operator float() const {
   return tmp_f;
 }
 
+void convert(std::span<const float> input, std::span<Tfloat> output) {
+  constexpr uint32_t remainder_mask = 0x00001fff;
+  constexpr uint32_t exponent_mask = 0x7f800000;
+  constexpr uint32_t mantissa_mask = 0x007fe000;
+  constexpr uint32_t highest_temp = 0xffffe000;
+  constexpr uint32_t remainder_highest_bit = 0x00001000;
+  constexpr uint32_t last_bit = 0x00002000;
+  if (input.size() != output.size()) {
+    throw std::invalid_argument("Input and output sizes differ");
+  }
+  // Branchless form of Tfloat(float) so that the loop can be vectorized
+  for (size_t i = 0; i < input.size(); i++) {
+    uint32_t tmp = 0;
+    std::memcpy(&tmp, &input[i], sizeof(uint32_t));
+    const uint32_t remainder = tmp & remainder_mask;
+    tmp &= ~remainder_mask;
+    const bool is_nan_or_inf = (tmp & exponent_mask) == exponent_mask;
+    const bool round_up =
+        !is_nan_or_inf && tmp != highest_temp &&
+        (remainder > remainder_highest_bit ||
+         (remainder == remainder_highest_bit && (tmp & last_bit) != 0));
+    const uint32_t nan_bits =
+        is_nan_or_inf && remainder != 0 ? mantissa_mask : 0;
+    output[i] = Tfloat::encode((tmp + (round_up ? last_bit : 0)) | nan_bits);
+  }
+}
+
+void convert(std::span<const Tfloat> input, std::span<float> output) {
+  if (input.size() != output.size()) {
+    throw std::invalid_argument("Input and output sizes differ");
+  }
+  for (size_t i = 0; i < input.size(); i++) {
+    const uint32_t tmp = input[i].decode();
+    std::memcpy(&output[i], &tmp, sizeof(uint32_t));
+  }
+}
+
 bool Tfloat::operator==(const Tfloat &rhs) const {
   const auto f_lhs = static_cast<float>(*this);
   const auto f_rhs = static_cast<float>(rhs);
@@ -21,6 +21,7 @@ namespace test {
 class Config : public cassian::TestConfigBase {
 public:
   explicit Config(const cassian::CommandLineParser &parser);
+  explicit Config(std::unique_ptr<cassian::Runtime> runtime);
 };
 
 const Config &get_config();
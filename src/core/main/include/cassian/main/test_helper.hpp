@@ -8,9 +8,14 @@
 #ifndef CASSIAN_MAIN_TEST_HELPER_HPP
 #define CASSIAN_MAIN_TEST_HELPER_HPP
 
+#include <array>
 #include <cassert>
+#include <cstddef>
 #include <functional>
+#include <memory>
 #include <optional>
+#include <set>
+#include <span>
 #include <string>
 #include <variant>
 #include <vector>
@@ -18,7 +23,9 @@
 #include <cassian/fp_types/type_traits.hpp>
 #include <cassian/image/image.hpp>
 #include <cassian/image/pixel/common.hpp>
+#include <cassian/runtime/memory_kind.hpp>
 #include <cassian/runtime/program_descriptor.hpp>
+#include <cassian/utility/utility.hpp>
 
 #include "config.hpp"
 
@@ -42,6 +49,15 @@ public:
 
   using Action = std::function<void(void)>;
 
+  struct Stream {
+    size_t element_size = 0;
+    bool is_output = false;
+    // Returns host memory for a chunk of given size in double buffering slot.
+    std::function<void *(size_t slot, size_t chunk_size)> allocate;
+    // Fills input or consumes output chunk [offset, offset + size) in slot.
+    std::function<void(size_t slot, size_t offset, size_t size)> process;
+  };
+
   static Helper &instance();
 
   Helper(const Helper &) = delete;
@@ -68,11 +84,18 @@ public:
   void execute(std::array<size_t, 3> global_work_size,
                std::array<size_t, 3> local_work_size);
 
+  void pass_stream(const Stream &stream);
+  void pass_stream_offset();
+  void execute_streamed(size_t global_work_size, size_t local_work_size,
+                        size_t chunk_size);
+
   void cleanup();
 
   void add_action_after_exec(const Action &action);
 
-  cassian::Buffer create_buffer(size_t size);
+  cassian::Buffer
+  create_buffer(size_t size,
+                cassian::MemoryKind memory_kind = cassian::MemoryKind::device);
   cassian::Image create_image(const ImageDimensions dim, const ImageType type,
                               const ImageFormat format,
                               const ImageChannelOrder order);
@@ -87,8 +110,20 @@ public:
 private:
   Helper();
 
+  void set_arguments();
+
+  struct StreamArgument {
+    size_t index = 0;
+    Stream stream;
+    std::array<cassian::Buffer, 2> buffers;
+    std::array<void *, 2> host_data = {};
+  };
+
   cassian::Kernel kernel_;
   std::vector<Argument> arguments_;
+  std::vector<StreamArgument> streams_;
+  std::optional<size_t> stream_offset_index_;
+  std::set<int> stream_devices_;
 
   std::vector<cassian::Buffer> buffers_;
   std::vector<cassian::Image> images_;
@@ -223,6 +258,146 @@ void input_output(std::vector<T, Allocator> &data) {
       [rt, &data, buffer]() { data = rt->read_buffer_to_vector<T>(buffer); });
 }
 
+/**
+ * Pass buffer argument generated in place.
+ *
+ * Buffer is allocated in shared memory and filled through a mapping, so no
+ * staging copy is made on devices sharing memory with host.
+ *
+ * @tparam T element type.
+ * @param[in] size number of elements.
+ * @param[in] generate function filling `data` with input elements.
+ */
+template <typename T>
+void mapped_input(size_t size,
+                  const std::function<void(std::span<T> data)> &generate) {
+  auto &h = detail::Helper::instance();
+  auto *rt = h.config.runtime();
+
+  auto buffer = h.create_buffer(size * sizeof(T), MemoryKind::shared);
+  auto *data =
+      static_cast<T *>(rt->map_buffer(buffer, AccessQualifier::write_only));
+  auto f = finally([rt, buffer]() { rt->unmap_buffer(buffer); });
+  generate(std::span<T>(data, size));
+  h.pass(buffer);
+}
+
+/**
+ * Pass buffer argument checked in place.
+ *
+ * Buffer is allocated in shared memory and mapped after kernel execution, so
+ * no staging copy is made on devices sharing memory with host.
+ *
+ * @tparam T element type.
+ * @param[in] size number of elements.
+ * @param[in] check function receiving output elements.
+ */
+template <typename T>
+void mapped_output(
+    size_t size, const std::function<void(std::span<const T> data)> &check) {
+  auto &h = detail::Helper::instance();
+  auto *rt = h.config.runtime();
+
+  auto buffer = h.create_buffer(size * sizeof(T), MemoryKind::shared);
+  h.pass(buffer);
+
+  h.add_action_after_exec([rt, buffer, size, check]() {
+    const auto *data = static_cast<const T *>(
+        rt->map_buffer(buffer, AccessQualifier::read_only));
+    auto f = finally([rt, buffer]() { rt->unmap_buffer(buffer); });
+    check(std::span<const T>(data, size));
+  });
+}
+
+/**
+ * Pass buffer argument streamed in chunks by stream_kernel.
+ *
+ * Each chunk is generated right before it is uploaded, so the whole input
+ * never has to be held in memory.
+ *
+ * @tparam T element type.
+ * @param[in] generate function filling `data` with elements
+ * [offset, offset + data.size()) of the input.
+ */
+template <typename T>
+void stream_input(
+    const std::function<void(size_t offset, std::span<T> data)> &generate) {
+  auto staging = std::make_shared<std::array<std::vector<T>, 2>>();
+  detail::Helper::Stream stream;
+  stream.element_size = sizeof(T);
+  stream.allocate = [staging](size_t slot, size_t chunk_size) -> void * {
+    (*staging)[slot].resize(chunk_size);
+    return (*staging)[slot].data();
+  };
+  stream.process = [staging, generate](size_t slot, size_t offset,
+                                       size_t size) {
+    generate(offset, std::span<T>((*staging)[slot]).first(size));
+  };
+  detail::Helper::instance().pass_stream(stream);
+}
+
+/**
+ * Pass buffer argument streamed in chunks by stream_kernel.
+ *
+ * Results are handed over chunk by chunk, so the whole output never has to be
+ * held in memory.
+ *
+ * @tparam T element type.
+ * @param[in] consume function receiving elements
+ * [offset, offset + data.size()) of the output.
+ */
+template <typename T>
+void stream_output(
+    const std::function<void(size_t offset, std::span<const T> data)>
+        &consume) {
+  auto staging = std::make_shared<std::array<std::vector<T>, 2>>();
+  detail::Helper::Stream stream;
+  stream.element_size = sizeof(T);
+  stream.is_output = true;
+  stream.allocate = [staging](size_t slot, size_t chunk_size) -> void * {
+    (*staging)[slot].resize(chunk_size);
+    return (*staging)[slot].data();
+  };
+  stream.process = [staging, consume](size_t slot, size_t offset,
+                                      size_t size) {
+    consume(offset, std::span<const T>((*staging)[slot]).first(size));
+  };
+  detail::Helper::instance().pass_stream(stream);
+}
+
+/**
+ * Pass index of the first work item of the current chunk as an `unsigned
+ * long long` argument. Kernels add it to their global id to get the index in
+ * the whole range.
+ */
+void stream_offset();
+
+/**
+ * Run kernel over a 1D range split into chunks.
+ *
+ * Each chunk is launched as a separate ND-range with its own global ids
+ * starting from 0. Arguments passed with stream_input and stream_output are
+ * double-buffered, so the host generates chunk N + 1 and consumes chunk N - 1
+ * while the device processes chunk N. Other arguments are shared by all
+ * chunks. Memory usage depends only on the chunk size.
+ *
+ * @param[in] global_work_size total number of work items.
+ * @param[in] local_work_size local work size.
+ * @param[in] chunk_size maximum number of work items in a chunk, rounded down
+ * to a multiple of local work size.
+ * @param[in] name kernel name.
+ * @param[in] source kernel source.
+ * @param[in] flags build options.
+ * @param[in] spirv_flags SPIR-V build options.
+ * @throws std::invalid_argument Thrown if chunk size is smaller than local
+ * work size, global work size is 0 or not a multiple of local work size.
+ */
+void stream_kernel(
+    size_t global_work_size, size_t local_work_size, size_t chunk_size,
+    const std::string &name, const std::string &source,
+    const std::string &flags,
+    const std::optional<std::string> &spirv_flags = std::nullopt);
+
 template <typename Pixel, ImageType Type>
 void input(const HostImage<Pixel, Type> &data) {
   auto &h = detail::Helper::instance();
@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 #include <cassian/cli/cli.hpp>
 #include <cassian/main/config.hpp>
@@ -18,6 +19,9 @@ namespace ca = cassian;
 ca::test::Config::Config(const ca::CommandLineParser &parser)
     : TestConfigBase(parser) {}
 
+ca::test::Config::Config(std::unique_ptr<ca::Runtime> runtime)
+    : TestConfigBase(std::move(runtime), "source") {}
+
 const ca::test::Config *config = nullptr;
 const ca::test::Config &ca::test::get_config() { return *config; }
 void ca::test::set_config(const Config &c) { config = &c; }
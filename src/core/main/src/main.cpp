@@ -11,6 +11,7 @@
 #include <cassian/cli/cli.hpp>
 #include <cassian/main/config.hpp>
 #include <cassian/runtime/factory.hpp>
+#include <cassian/test_harness/sharding.hpp>
 #include <cassian/test_harness/test_config.hpp>
 #include <cassian/utility/version.hpp>
 
@@ -24,6 +25,8 @@ int main(int argc, char *argv[]) {
   const cassian::test::Config config(parser);
   set_config(config);
 
-  int result = Catch::Session().run(argc, argv);
+  Catch::Session session;
+  int result = cassian::run_test_session(session, parser, config.runtime(),
+                                         argc, argv);
   return result;
 }
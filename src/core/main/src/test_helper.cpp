@@ -5,10 +5,13 @@
  *
  */
 
+#include <algorithm>
 #include <cassian/image/nv12.hpp>
 #include <cassian/main/test_helper.hpp>
 #include <cassian/test_harness/test_harness.hpp>
 #include <cassian/utility/utility.hpp>
+#include <stdexcept>
+#include <utility>
 
 namespace cassian::test {
 
@@ -40,8 +43,7 @@ void Helper::kernel(const std::string &name,
                                                      linker_options);
 }
 
-void Helper::execute(std::array<size_t, 3> global_work_size,
-                     std::array<size_t, 3> local_work_size) {
+void Helper::set_arguments() {
   auto *rt = config.runtime();
 
   int i = 0;
@@ -52,7 +54,13 @@ void Helper::execute(std::array<size_t, 3> global_work_size,
         },
         arg);
   }
+}
 
+void Helper::execute(std::array<size_t, 3> global_work_size,
+                     std::array<size_t, 3> local_work_size) {
+  auto *rt = config.runtime();
+
+  set_arguments();
   rt->run_kernel(kernel_, global_work_size, local_work_size);
 
   for (const auto &action : after_kernel_exec_) {
@@ -60,6 +68,103 @@ void Helper::execute(std::array<size_t, 3> global_work_size,
   }
 }
 
+void Helper::pass_stream(const Stream &stream) {
+  StreamArgument argument;
+  argument.index = arguments_.size();
+  argument.stream = stream;
+  streams_.push_back(argument);
+  // Replaced with a buffer of the current slot for each chunk
+  arguments_.emplace_back(cassian::Buffer());
+}
+
+void Helper::pass_stream_offset() {
+  stream_offset_index_ = arguments_.size();
+  arguments_.emplace_back(0ULL);
+}
+
+void Helper::execute_streamed(size_t global_work_size, size_t local_work_size,
+                              size_t chunk_size) {
+  if (local_work_size == 0 || chunk_size < local_work_size) {
+    throw std::invalid_argument(
+        "Chunk size must not be smaller than local work size");
+  }
+  if (global_work_size == 0) {
+    throw std::invalid_argument("Global work size must not be 0");
+  }
+  // Otherwise the last chunk would not be a multiple of local work size
+  if (global_work_size % local_work_size != 0) {
+    throw std::invalid_argument(
+        "Global work size must be a multiple of local work size");
+  }
+  auto *rt = config.runtime();
+
+  chunk_size -= chunk_size % local_work_size;
+  chunk_size = std::min(chunk_size, global_work_size);
+  for (auto &argument : streams_) {
+    for (size_t slot = 0; slot < 2; slot++) {
+      argument.buffers[slot] =
+          create_buffer(chunk_size * argument.stream.element_size);
+      argument.host_data[slot] = argument.stream.allocate(slot, chunk_size);
+    }
+  }
+
+  // Chunk N is enqueued before chunk N - 1 is consumed, so the host works on
+  // one slot while the device works on the other.
+  std::array<std::vector<Event>, 2> events;
+  const auto enqueued = [&](size_t slot, const Event &event) {
+    events[slot].push_back(event);
+    stream_devices_.insert(event.device);
+  };
+  const auto chunk_range = [&](size_t chunk) {
+    const size_t offset = chunk * chunk_size;
+    return std::make_pair(offset,
+                          std::min(chunk_size, global_work_size - offset));
+  };
+  const size_t chunk_count = (global_work_size + chunk_size - 1) / chunk_size;
+  for (size_t chunk = 0; chunk <= chunk_count; chunk++) {
+    if (chunk < chunk_count) {
+      const size_t slot = chunk % 2;
+      const auto [offset, size] = chunk_range(chunk);
+      for (auto &argument : streams_) {
+        arguments_[argument.index] = argument.buffers[slot];
+        if (!argument.stream.is_output) {
+          argument.stream.process(slot, offset, size);
+          enqueued(slot, rt->enqueue_write_buffer(argument.buffers[slot],
+                                                  argument.host_data[slot]));
+        }
+      }
+      if (stream_offset_index_) {
+        arguments_[*stream_offset_index_] =
+            static_cast<unsigned long long>(offset);
+      }
+      set_arguments();
+      enqueued(slot, rt->enqueue_run_kernel(kernel_, {size, 1, 1},
+                                            {local_work_size, 1, 1}));
+      for (auto &argument : streams_) {
+        if (argument.stream.is_output) {
+          enqueued(slot, rt->enqueue_read_buffer(argument.buffers[slot],
+                                                 argument.host_data[slot]));
+        }
+      }
+    }
+    if (chunk > 0) {
+      const size_t slot = (chunk - 1) % 2;
+      const auto [offset, size] = chunk_range(chunk - 1);
+      rt->wait(events[slot]);
+      events[slot].clear();
+      for (auto &argument : streams_) {
+        if (argument.stream.is_output) {
+          argument.stream.process(slot, offset, size);
+        }
+      }
+    }
+  }
+
+  for (const auto &action : after_kernel_exec_) {
+    action();
+  }
+}
+
 void Helper::add_action_after_exec(const Action &action) {
   after_kernel_exec_.push_back(action);
 }
@@ -67,6 +172,11 @@ void Helper::add_action_after_exec(const Action &action) {
 void Helper::cleanup() {
   auto *rt = config.runtime();
 
+  // Streamed transfers may still be pending if execution was interrupted
+  for (const int device : stream_devices_) {
+    rt->finish(device);
+  }
+
   for (auto buf : buffers_) {
     rt->release_buffer(buf);
   }
@@ -85,15 +195,19 @@ void Helper::cleanup() {
 
   after_kernel_exec_.clear();
   arguments_.clear();
+  streams_.clear();
+  stream_offset_index_.reset();
+  stream_devices_.clear();
   buffers_.clear();
   images_.clear();
   samplers_.clear();
 }
 
-cassian::Buffer Helper::create_buffer(size_t size) {
+cassian::Buffer Helper::create_buffer(size_t size,
+                                      cassian::MemoryKind memory_kind) {
   auto *rt = config.runtime();
 
-  auto buf = rt->create_buffer(size);
+  auto buf = rt->create_buffer(size, AccessQualifier::read_write, memory_kind);
   buffers_.push_back(buf);
 
   return buf;
@@ -272,6 +386,19 @@ void kernel(std::array<size_t, 3> global_work_size,
   h.execute(global_work_size, local_work_size);
 }
 
+void stream_offset() { detail::Helper::instance().pass_stream_offset(); }
+
+void stream_kernel(size_t global_work_size, size_t local_work_size,
+                   size_t chunk_size, const std::string &name,
+                   const std::string &source, const std::string &flags,
+                   const std::optional<std::string> &spirv_flags) {
+  auto &h = detail::Helper::instance();
+  auto f = finally([] { detail::Helper::instance().cleanup(); });
+
+  h.kernel(name, source, flags, spirv_flags);
+  h.execute_streamed(global_work_size, local_work_size, chunk_size);
+}
+
 void input(const Nv12Image &data) {
   auto &h = detail::Helper::instance();
   auto *rt = h.config.runtime();
@@ -9,6 +9,8 @@
 #define CASSIAN_OFFLINE_COMPILER_OFFLINE_COMPILER_HPP
 
 #include <cstdint>
+#include <future>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -20,12 +22,31 @@ struct OclocProduct {
   std::string name;
   std::vector<uint8_t> data;
 };
+
+/**
+ * Program to compile with generate_spirv_from_sources.
+ */
+struct SpirvCompileJob {
+  /**
+   * Program source.
+   */
+  std::string source;
+
+  /**
+   * Build options to use during generation.
+   */
+  std::string build_options;
+};
+
 /**
  * Generate SPIR-V module from a file.
  *
  * @param[in] path path to input file.
  * @param[in] build_options build options to use during generation.
- * @returns path to output binary file with generated SPIR-V module.
+ * @returns path to output binary file with generated SPIR-V module. Each call
+ * creates a new file in the temporary directory, which is owned and has to be
+ * removed by the caller.
+ * @throws cassian::OfflineCompilerException Thrown if module can't be saved.
  */
 std::string generate_spirv(uint32_t ip_version, const std::string &path,
                            const std::string &build_options = std::string(),
@@ -43,6 +64,34 @@ generate_spirv_from_source(uint32_t ip_version, const std::string &source,
                            const std::string &build_options = std::string(),
                            bool quiet = false);
 
+/**
+ * Generate SPIR-V modules from multiple sources in parallel.
+ *
+ * Jobs are executed on a worker pool sized to the number of hardware threads,
+ * but at least two workers. Each job runs the offline compiler executable in
+ * its own child process, so compilations run in parallel. If the executable
+ * is not found, jobs fall back to the offline compiler library, which
+ * compiles one module at a time. Generated modules are stored in the SPIR-V
+ * cache, so this function can be used to warm up the cache before kernels are
+ * created.
+ *
+ * @param[in] jobs sources and build options to compile.
+ * @returns futures of SPIR-V modules stored in raw bytes, in order of `jobs`.
+ * Futures rethrow cassian::OfflineCompilerException if compilation failed.
+ */
+std::vector<std::future<std::vector<uint8_t>>>
+generate_spirv_from_sources(uint32_t ip_version,
+                            const std::vector<SpirvCompileJob> &jobs,
+                            bool quiet = false);
+
+/**
+ * Set offline compiler executable used by generate_spirv_from_sources.
+ *
+ * @param[in] path path to the executable. If empty, the executable is looked
+ * up in directories listed in the PATH environment variable.
+ */
+void set_offline_compiler_executable(const std::string &path);
+
 /**
  * Generate ocloc products from different input types(source/spirv/binary data).
  *
@@ -58,6 +107,18 @@ std::vector<OclocProduct> generate_offline_compiler_products(
     const std::string &build_options, const std::string &ocloc_cmd,
     const std::vector<const char *> &ocloc_options,
     const std::string &program_type, bool quiet = false);
+
+/**
+ * Get offline compiler version.
+ *
+ * Version is queried once and used to key cached SPIR-V modules, so that
+ * modules generated by a different compiler are not reused.
+ *
+ * @returns driver version reported by the offline compiler or empty string if
+ * it can't be queried.
+ */
+std::string get_offline_compiler_version();
+
 /**
  * Exception class used when an offline compiler encounters a fatal error.
  */
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_OFFLINE_COMPILER_SPIRV_CACHE_HPP
+#define CASSIAN_OFFLINE_COMPILER_SPIRV_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Cassian namespace.
+ */
+namespace cassian {
+
+/**
+ * SPIR-V cache statistics.
+ */
+struct SpirvCacheStatistics {
+  /**
+   * Number of modules found in memory.
+   */
+  size_t memory_hits = 0;
+
+  /**
+   * Number of modules found on disk.
+   */
+  size_t disk_hits = 0;
+
+  /**
+   * Number of modules not found in the cache.
+   */
+  size_t misses = 0;
+};
+
+/**
+ * Two-level cache of SPIR-V modules generated by the offline compiler.
+ *
+ * Modules are kept in memory up to a given total size, least recently used
+ * modules are evicted first. Optionally, modules are also stored in a directory
+ * shared between processes. Cache is thread-safe.
+ */
+class SpirvCache {
+public:
+  /**
+   * Default maximum total size of modules kept in memory.
+   */
+  static constexpr size_t default_capacity = 64 * 1024 * 1024;
+
+  /**
+   * Construct a cache.
+   *
+   * @param[in] capacity maximum total size of modules kept in memory in bytes.
+   */
+  explicit SpirvCache(size_t capacity = default_capacity);
+
+  /**
+   * Load SPIR-V module.
+   *
+   * @param[in] key cache key.
+   * @param[in] persistent look up the module on disk if it is not in memory.
+   * @returns module or std::nullopt if there is no entry for `key`.
+   */
+  std::optional<std::vector<uint8_t>> load(const std::string &key,
+                                           bool persistent = true);
+
+  /**
+   * Store SPIR-V module.
+   *
+   * @param[in] key cache key.
+   * @param[in] spirv module to store.
+   * @param[in] persistent store the module also on disk.
+   */
+  void store(const std::string &key, const std::vector<uint8_t> &spirv,
+             bool persistent = true);
+
+  /**
+   * Set maximum total size of modules kept in memory.
+   *
+   * @param[in] capacity capacity in bytes, 0 disables memory cache.
+   */
+  void set_capacity(size_t capacity);
+
+  /**
+   * Set directory used to store modules on disk.
+   *
+   * @param[in] directory cache directory, created if it does not exist. Empty
+   * string disables disk cache.
+   * @throws cassian::OfflineCompilerException Thrown if directory can't be
+   * created.
+   */
+  void set_directory(const std::string &directory);
+
+  /**
+   * Get cache statistics.
+   *
+   * @returns statistics.
+   */
+  SpirvCacheStatistics statistics() const;
+
+private:
+  using Entry = std::pair<std::string, std::vector<uint8_t>>;
+
+  mutable std::mutex mutex_;
+  size_t capacity_;
+  size_t size_ = 0;
+  std::list<Entry> entries_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+  std::string directory_;
+  SpirvCacheStatistics statistics_;
+
+  void store_in_memory(const std::string &key,
+                       const std::vector<uint8_t> &spirv);
+};
+
+/**
+ * Get SPIR-V cache used by generate_spirv_from_source.
+ *
+ * @returns cache.
+ */
+SpirvCache &get_spirv_cache();
+
+/**
+ * Check if SPIR-V modules built with a given compiler can be shared through
+ * the disk cache.
+ *
+ * @param[in] compiler_version offline compiler version, see
+ * get_offline_compiler_version.
+ * @returns false if version is unknown, modules of other compilers could be
+ * found on disk then.
+ */
+bool is_spirv_cache_persistent(const std::string &compiler_version);
+
+/**
+ * Build SPIR-V cache key.
+ *
+ * @param[in] compiler_version offline compiler version, see
+ * get_offline_compiler_version.
+ * @param[in] ip_version device IP version.
+ * @param[in] source program source.
+ * @param[in] build_options build options.
+ * @returns key unambiguously combining all parameters.
+ */
+std::string spirv_cache_key(const std::string &compiler_version,
+                            uint32_t ip_version, const std::string &source,
+                            const std::string &build_options);
+
+} // namespace cassian
+
+#endif
@@ -5,20 +5,30 @@
  *
  */
 
+#include <algorithm>
 #include <cassert>
+#include <condition_variable>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <future>
 #include <iomanip>
 #include <memory>
+#include <mutex>
+#include <random>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 #include <cassian/logging/logging.hpp>
 #include <cassian/offline_compiler/offline_compiler.hpp>
+#include <cassian/offline_compiler/spirv_cache.hpp>
 #include <cassian/system/factory.hpp>
 #include <cassian/system/library.hpp>
 #include <cassian/utility/utility.hpp>
@@ -27,9 +37,13 @@ namespace cassian {
 #if defined(_WIN32)
 #define SIGNATURE __cdecl
 constexpr char ocloc[] = "ocloc64.dll";
+constexpr char ocloc_executable[] = "ocloc64.exe";
+constexpr char path_separator = ';';
 #else
 #define SIGNATURE
 constexpr char ocloc[] = "libocloc.so";
+constexpr char ocloc_executable[] = "ocloc";
+constexpr char path_separator = ':';
 #endif
 
 class Ocloc {
@@ -61,6 +75,11 @@ public:
   const p_oclocInvoke_t invoke;   // NOLINT
   const p_oclocFreeOutput_t free; // NOLINT
 
+  // Serializes invocations, ocloc is not documented to be thread-safe and its
+  // virtual files (program.cl, stdout.log) have fixed names. Has to be held
+  // until outputs are freed.
+  std::mutex mutex;
+
   Ocloc()
       : library_(load_library(ocloc)),
         invoke(reinterpret_cast<p_oclocInvoke_t>(
@@ -69,14 +88,194 @@ public:
             library_->get_function("oclocFreeOutput"))) {}
 };
 
+namespace {
+
+Ocloc &get_ocloc() {
+  static Ocloc ocloc;
+  return ocloc;
+}
+
+std::mutex executable_mutex;
+std::string executable_override;
+
+std::string find_offline_compiler_executable() {
+  {
+    std::lock_guard<std::mutex> lock(executable_mutex);
+    if (!executable_override.empty()) {
+      return executable_override;
+    }
+  }
+  static const std::string found = []() {
+    const char *path = std::getenv("PATH");
+    std::istringstream directories(path == nullptr ? "" : path);
+    for (std::string directory;
+         std::getline(directories, directory, path_separator);) {
+      const auto candidate = fs::path(directory) / ocloc_executable;
+      std::error_code error;
+      if (!directory.empty() && fs::is_regular_file(candidate, error)) {
+        return candidate.string();
+      }
+    }
+    return std::string();
+  }();
+  return found;
+}
+
+// Every call gets its own process and directory, so calls run in parallel
+std::vector<uint8_t> run_offline_compiler_process(
+    const std::string &executable, uint32_t ip_version,
+    const std::string &source, const std::string &build_options, bool quiet) {
+  const fs::path directory =
+      fs::temp_directory_path() /
+      ("cassian_ocloc_" + std::to_string(std::random_device()()));
+  fs::create_directories(directory);
+  auto _ = finally([&directory]() {
+    std::error_code error;
+    fs::remove_all(directory, error);
+  });
+
+  const fs::path source_path = directory / "program.cl";
+  const fs::path log_path = directory / "stdout.log";
+  save_text_file(source, source_path.string());
+
+  std::vector<std::string> args = {executable,
+                                   "compile",
+                                   "-file",
+                                   source_path.string(),
+                                   "-spv_only",
+                                   "-out_dir",
+                                   directory.string(),
+                                   "-output",
+                                   "program",
+                                   "-output_no_suffix"};
+  if (!build_options.empty()) {
+    args.push_back("-options");
+    args.push_back(build_options);
+  }
+  if (ip_version != 0) {
+    args.push_back("-device");
+    args.push_back(std::to_string(ip_version));
+  }
+  if (quiet) {
+    args.push_back("-q");
+  }
+
+  const int status = start_process(args, {}, log_path.string())->wait();
+  if (status == 0) {
+    for (const auto &entry : fs::directory_iterator(directory)) {
+      if (entry.path().extension() == ".spv") {
+        return load_binary_file(entry.path().string());
+      }
+    }
+  }
+  if (!quiet && fs::exists(log_path)) {
+    logging::error() << "Build log:\n"
+                     << load_text_file(log_path.string()) << '\n';
+  }
+  throw OfflineCompilerException("Offline compiler operation failed");
+}
+
+std::vector<uint8_t>
+generate_spirv_in_child_process(uint32_t ip_version, const std::string &source,
+                                const std::string &build_options, bool quiet) {
+  const std::string executable = find_offline_compiler_executable();
+  if (executable.empty()) {
+    return generate_spirv_from_source(ip_version, source, build_options,
+                                      quiet);
+  }
+
+  auto &cache = get_spirv_cache();
+  const std::string compiler_version = get_offline_compiler_version();
+  const bool persistent = is_spirv_cache_persistent(compiler_version);
+  const std::string key =
+      spirv_cache_key(compiler_version, ip_version, source, build_options);
+  auto spirv = cache.load(key, persistent);
+  if (spirv.has_value()) {
+    return spirv.value();
+  }
+  auto generated = run_offline_compiler_process(executable, ip_version, source,
+                                                build_options, quiet);
+  cache.store(key, generated, persistent);
+  return generated;
+}
+
+class CompilerPool {
+public:
+  CompilerPool() {
+    // Workers mostly wait for compiler processes, so even a single core
+    // benefits from overlapping process startup with compilation
+    const unsigned thread_count =
+        std::max(2U, std::thread::hardware_concurrency());
+    for (unsigned i = 0; i < thread_count; i++) {
+      workers_.emplace_back([this]() { run(); });
+    }
+  }
+  CompilerPool(const CompilerPool &) = delete;
+  CompilerPool(CompilerPool &&) = delete;
+  ~CompilerPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    condition_.notify_all();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+  CompilerPool &operator=(const CompilerPool &) = delete;
+  CompilerPool &operator=(CompilerPool &&) = delete;
+
+  void submit(std::function<void()> job) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      jobs_.push_back(std::move(job));
+    }
+    condition_.notify_one();
+  }
+
+private:
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::function<void()>> jobs_;
+  std::vector<std::thread> workers_;
+  bool stop_ = false;
+
+  void run() {
+    while (true) {
+      std::function<void()> job;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this]() { return stop_ || !jobs_.empty(); });
+        // Queued jobs are drained, so no future is left without a result
+        if (jobs_.empty()) {
+          return;
+        }
+        job = std::move(jobs_.front());
+        jobs_.pop_front();
+      }
+      job();
+    }
+  }
+};
+
+} // namespace
+
 std::string generate_spirv(uint32_t ip_version, const std::string &path,
                            const std::string &build_options, bool quiet) {
-  static const std::string spv_file = "kernel.spv";
-
   auto source = load_text_file(path);
   auto spirv =
       generate_spirv_from_source(ip_version, source, build_options, quiet);
-  save_binary_file(spirv, spv_file);
+
+  // Unique per call, so concurrent callers never share a file and each one
+  // can remove its own module
+  const std::string spv_file =
+      (fs::temp_directory_path() /
+       ("cassian_kernel_" + std::to_string(std::random_device()()) + ".spv"))
+          .string();
+  if (!save_binary_file_atomic(spirv, spv_file)) {
+    throw OfflineCompilerException("Failed to save SPIR-V module: " +
+                                   spv_file);
+  }
 
   return spv_file;
 }
@@ -86,6 +285,16 @@ generate_spirv_from_source(uint32_t ip_version, const std::string &source,
                            const std::string &build_options, bool quiet) {
   static const std::string ocloc_cmd = "compile";
 
+  auto &cache = get_spirv_cache();
+  const std::string compiler_version = get_offline_compiler_version();
+  const bool persistent = is_spirv_cache_persistent(compiler_version);
+  const std::string key =
+      spirv_cache_key(compiler_version, ip_version, source, build_options);
+  auto spirv = cache.load(key, persistent);
+  if (spirv.has_value()) {
+    return spirv.value();
+  }
+
   std::vector<uint8_t> source_bytes(source.begin(), source.end());
   source_bytes.push_back(0);
   std::vector<const char *> ocloc_options = {"-spv_only"};
@@ -100,17 +309,43 @@ generate_spirv_from_source(uint32_t ip_version, const std::string &source,
                          });
 
   if (it != std::end(ocloc_products)) {
+    cache.store(key, it->data, persistent);
     return it->data;
   }
   return {};
 }
 
+std::vector<std::future<std::vector<uint8_t>>>
+generate_spirv_from_sources(uint32_t ip_version,
+                            const std::vector<SpirvCompileJob> &jobs,
+                            bool quiet) {
+  static CompilerPool pool;
+
+  std::vector<std::future<std::vector<uint8_t>>> futures;
+  futures.reserve(jobs.size());
+  for (const auto &job : jobs) {
+    auto task = std::make_shared<std::packaged_task<std::vector<uint8_t>()>>(
+        [ip_version, job, quiet]() {
+          return generate_spirv_in_child_process(ip_version, job.source,
+                                                 job.build_options, quiet);
+        });
+    futures.push_back(task->get_future());
+    pool.submit([task]() { (*task)(); });
+  }
+  return futures;
+}
+
+void set_offline_compiler_executable(const std::string &path) {
+  std::lock_guard<std::mutex> lock(executable_mutex);
+  executable_override = path;
+}
+
 std::vector<OclocProduct> generate_offline_compiler_products(
     uint32_t ip_version, const std::vector<uint8_t> &source_bytes,
     const std::string &build_options, const std::string &ocloc_cmd,
     const std::vector<const char *> &ocloc_options,
     const std::string &program_type, bool quiet) {
-  static Ocloc ocloc;
+  auto &ocloc = get_ocloc();
   static const std::string_view log_file = "stdout.log";
   const char *src_file = "program.cl";
 
@@ -167,6 +402,7 @@ std::vector<OclocProduct> generate_offline_compiler_products(
   uint64_t *len_outputs = nullptr;
   char **name_outputs = nullptr;
   std::vector<OclocProduct> ocloc_products;
+  std::lock_guard<std::mutex> lock(ocloc.mutex);
   auto _ = finally([&]() mutable {
     ocloc.free(&num_outputs, &data_outputs, &len_outputs, &name_outputs);
   });
@@ -203,4 +439,43 @@ std::vector<OclocProduct> generate_offline_compiler_products(
   return ocloc_products;
 }
 
+std::string get_offline_compiler_version() {
+  static const std::string version = []() {
+    static const std::string_view query = "OCL_DRIVER_VERSION";
+    std::vector<const char *> args = {"ocloc", "query", query.data()};
+
+    Ocloc *ocloc = nullptr;
+    try {
+      ocloc = &get_ocloc();
+    } catch (const std::runtime_error &) {
+      logging::warning() << "Failed to load offline compiler\n";
+      return std::string();
+    }
+    uint32_t num_outputs = 0;
+    uint8_t **data_outputs = nullptr;
+    uint64_t *len_outputs = nullptr;
+    char **name_outputs = nullptr;
+    std::lock_guard<std::mutex> lock(ocloc->mutex);
+    auto _ = finally([&]() mutable {
+      ocloc->free(&num_outputs, &data_outputs, &len_outputs, &name_outputs);
+    });
+
+    const int status =
+        ocloc->invoke(args.size(), args.data(), 0, nullptr, nullptr, nullptr,
+                      0, nullptr, nullptr, nullptr, &num_outputs,
+                      &data_outputs, &len_outputs, &name_outputs);
+    if (status == 0) {
+      for (uint32_t i = 0; i < num_outputs; i++) {
+        if (name_outputs[i] == query) {
+          return std::string(reinterpret_cast<char *>(data_outputs[i]),
+                             len_outputs[i]);
+        }
+      }
+    }
+    logging::warning() << "Failed to query offline compiler version\n";
+    return std::string();
+  }();
+  return version;
+}
+
 } // namespace cassian
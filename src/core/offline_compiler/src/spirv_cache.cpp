@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cassian/logging/logging.hpp>
+#include <cassian/offline_compiler/offline_compiler.hpp>
+#include <cassian/offline_compiler/spirv_cache.hpp>
+#include <cassian/utility/utility.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace cassian {
+
+namespace {
+
+std::string entry_path(const std::string &directory, const std::string &key) {
+  std::stringstream ss;
+  ss << std::hex << fnv1a_hash(key) << ".spv";
+  return (fs::path(directory) / ss.str()).string();
+}
+
+} // namespace
+
+SpirvCache::SpirvCache(size_t capacity) : capacity_(capacity) {}
+
+std::optional<std::vector<uint8_t>> SpirvCache::load(const std::string &key,
+                                                     bool persistent) {
+  std::string directory;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+      entries_.splice(entries_.begin(), entries_, it->second);
+      statistics_.memory_hits++;
+      return it->second->second;
+    }
+    if (persistent) {
+      directory = directory_;
+    }
+  }
+
+  // Disk is accessed without holding the lock, so that memory hits from other
+  // threads are not blocked
+  std::optional<std::vector<uint8_t>> spirv;
+  if (!directory.empty()) {
+    spirv = load_cache_entry(entry_path(directory, key), key);
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (spirv.has_value()) {
+    store_in_memory(key, spirv.value());
+    statistics_.disk_hits++;
+  } else {
+    statistics_.misses++;
+  }
+  return spirv;
+}
+
+void SpirvCache::store(const std::string &key,
+                       const std::vector<uint8_t> &spirv, bool persistent) {
+  std::string directory;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    store_in_memory(key, spirv);
+    if (persistent) {
+      directory = directory_;
+    }
+  }
+
+  if (!directory.empty()) {
+    const std::string path = entry_path(directory, key);
+    if (!save_cache_entry(path, key, spirv)) {
+      logging::warning() << "Failed to store SPIR-V cache entry: " << path
+                         << '\n';
+    }
+  }
+}
+
+void SpirvCache::set_capacity(size_t capacity) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  capacity_ = capacity;
+  while (size_ > capacity_) {
+    size_ -= entries_.back().second.size();
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+}
+
+void SpirvCache::set_directory(const std::string &directory) {
+  if (!directory.empty()) {
+    std::error_code error;
+    fs::create_directories(directory, error);
+    if (error) {
+      throw OfflineCompilerException(
+          "Failed to create SPIR-V cache directory: " + directory);
+    }
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  directory_ = directory;
+}
+
+SpirvCacheStatistics SpirvCache::statistics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return statistics_;
+}
+
+void SpirvCache::store_in_memory(const std::string &key,
+                                 const std::vector<uint8_t> &spirv) {
+  if (spirv.size() > capacity_ || index_.count(key) != 0) {
+    return;
+  }
+  while (size_ + spirv.size() > capacity_) {
+    size_ -= entries_.back().second.size();
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+  entries_.emplace_front(key, spirv);
+  index_[key] = entries_.begin();
+  size_ += spirv.size();
+}
+
+SpirvCache &get_spirv_cache() {
+  static SpirvCache cache;
+  return cache;
+}
+
+bool is_spirv_cache_persistent(const std::string &compiler_version) {
+  return !compiler_version.empty();
+}
+
+std::string spirv_cache_key(const std::string &compiler_version,
+                            uint32_t ip_version, const std::string &source,
+                            const std::string &build_options) {
+  std::string key = std::to_string(compiler_version.size());
+  key += ':';
+  key += compiler_version;
+  key += std::to_string(ip_version);
+  key += ';';
+  key += std::to_string(build_options.size());
+  key += ':';
+  key += build_options;
+  key += source;
+  return key;
+}
+
+} // namespace cassian
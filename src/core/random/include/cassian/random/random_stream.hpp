@@ -0,0 +1,314 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_RANDOM_RANDOM_STREAM_HPP
+#define CASSIAN_RANDOM_RANDOM_STREAM_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cassian/fp_types/bfloat16.hpp>
+#include <cassian/fp_types/half.hpp>
+#include <cassian/fp_types/tfloat.hpp>
+#include <cassian/utility/parallel.hpp>
+#include <cassian/vector/vector.hpp>
+
+/**
+ * Cassian namespace.
+ */
+namespace cassian {
+
+/**
+ * Philox4x32-10 counter-based random number generator.
+ *
+ * @param[in] counter 128-bit counter.
+ * @param[in] key 64-bit key.
+ * @returns 128 random bits.
+ */
+std::array<uint32_t, 4> philox4x32(std::array<uint32_t, 4> counter,
+                                   std::array<uint32_t, 2> key);
+
+/**
+ * Reproducible stream of random values.
+ *
+ * Stream is identified by a seed, a name, e.g. test case name, and a stream
+ * id. Value at a given index does not depend on any other value, so values can
+ * be generated in any order, from multiple threads or selectively, e.g. to
+ * reproduce a single failing element.
+ */
+class RandomStream {
+public:
+  /**
+   * Constructor.
+   *
+   * @param[in] seed Random seed.
+   * @param[in] name Stream name.
+   * @param[in] stream_id Stream id, distinguishes streams with the same name.
+   */
+  RandomStream(int seed, const std::string &name, uint64_t stream_id = 0);
+
+  /**
+   * Generate random bits.
+   *
+   * @param[in] index Element index.
+   * @returns 128 random bits.
+   */
+  std::array<uint32_t, 4> generate_bits(uint64_t index) const;
+
+  /**
+   * Generate first two words of random bits for consecutive elements.
+   *
+   * Element i of `low` and `high` is equal to word 0 and word 1 of
+   * generate_bits(first_index + i). Uses AVX2 if supported by the host.
+   *
+   * @param[in] first_index Index of the first element.
+   * @param[out] low First words.
+   * @param[out] high Second words, empty if not needed.
+   * @throws std::invalid_argument Thrown if `high` is not empty and its size
+   * differs from size of `low`.
+   */
+  void generate_bits(uint64_t first_index, std::span<uint32_t> low,
+                     std::span<uint32_t> high) const;
+
+  /**
+   * Generate random integer in range [0, range].
+   *
+   * @param[in] index Element index.
+   * @param[in] range Maximum value.
+   * @returns generated value.
+   */
+  uint64_t generate_uint(uint64_t index, uint64_t range) const;
+
+  /**
+   * Generate random scalar value in range [min, max].
+   *
+   * @param[in] index Element index.
+   * @param[in] min Minimum value.
+   * @param[in] max Maximum value.
+   * @returns generated value.
+   * @throws std::invalid_argument Thrown if min is bigger than max or, for
+   * floating-point types, if min or max is NaN or infinity.
+   * @tparam T type of generated value.
+   */
+  template <typename T, typename cassian::EnableIfIsScalar<T> = 0>
+  T generate_value(const uint64_t index, const T min, const T max) const {
+    static_assert(std::is_integral_v<T>,
+                  "Unsupported type passed to generate_value");
+    if (min > max) {
+      throw std::invalid_argument(
+          "min bigger than max passed to generate_value");
+    }
+    const uint64_t range =
+        static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+    return static_cast<T>(static_cast<uint64_t>(min) +
+                          generate_uint(index, range));
+  }
+
+  /**
+   * Generate random Vector value in range [min, max].
+   *
+   * Component j of the value at index i is generated from scalar index
+   * i * vector_size + j.
+   *
+   * @param[in] index Element index.
+   * @param[in] min Minimum scalar value.
+   * @param[in] max Maximum scalar value.
+   * @returns generated value.
+   * @tparam T type of generated value.
+   */
+  template <typename T, typename cassian::EnableIfIsVector<T> = 0>
+  T generate_value(const uint64_t index, const scalar_type_v<T> min,
+                   const scalar_type_v<T> max) const {
+    T value;
+    for (size_t j = 0; j < T::vector_size; j++) {
+      value[j] = generate_value<scalar_type_v<T>>(index * T::vector_size + j,
+                                                  min, max);
+    }
+    return value;
+  }
+
+  /**
+   * Generate vector of random values in range [min, max].
+   *
+   * @param[in] size Number of values to generate.
+   * @param[in] min Minimum scalar value.
+   * @param[in] max Maximum scalar value.
+   * @param[in] first_index Index of the first generated value.
+   * @returns vector of generated values.
+   * @tparam T type of generated values.
+   */
+  template <typename T>
+  std::vector<T> generate_vector(const size_t size,
+                                 const scalar_type_v<T> min,
+                                 const scalar_type_v<T> max,
+                                 const uint64_t first_index = 0) const;
+
+private:
+  std::array<uint32_t, 2> key_ = {};
+  uint64_t stream_id_ = 0;
+};
+
+/**
+ * Fill span with random values in range [min, max].
+ *
+ * Element i is equal to stream.generate_value<T>(first_index + i, min, max).
+ * Range is validated once for the whole span. Span is filled on the host
+ * thread pool, see parallel_for. All threads use the caller's rounding mode.
+ *
+ * @param[out] data Span to fill.
+ * @param[in] min Minimum value.
+ * @param[in] max Maximum value.
+ * @param[in] stream Random stream.
+ * @param[in] first_index Index of the first generated value.
+ * @throws std::invalid_argument Thrown if min is bigger than max or, for
+ * floating-point types, if min or max is NaN or infinity.
+ * @tparam T type of generated values.
+ */
+template <typename T, typename cassian::EnableIfIsScalar<T> = 0>
+void fill_random(std::span<T> data, const T min, const T max,
+                 const RandomStream &stream, const uint64_t first_index = 0) {
+  static_assert(std::is_integral_v<T>,
+                "Unsupported type passed to fill_random");
+  if (min > max) {
+    throw std::invalid_argument("min bigger than max passed to fill_random");
+  }
+  const uint64_t range =
+      static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+  const auto base = static_cast<uint64_t>(min);
+  parallel_for(data.size(), [&](const size_t begin, const size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      data[i] =
+          static_cast<T>(base + stream.generate_uint(first_index + i, range));
+    }
+  });
+}
+
+/**
+ * Specialization for float.
+ *
+ * @overload
+ */
+template <>
+void fill_random<float>(std::span<float> data, const float min,
+                        const float max, const RandomStream &stream,
+                        const uint64_t first_index);
+
+/**
+ * Specialization for double.
+ *
+ * @overload
+ */
+template <>
+void fill_random<double>(std::span<double> data, const double min,
+                         const double max, const RandomStream &stream,
+                         const uint64_t first_index);
+
+/**
+ * Specialization for bfloat16.
+ *
+ * @overload
+ */
+template <>
+void fill_random<bfloat16>(std::span<bfloat16> data, const bfloat16 min,
+                           const bfloat16 max, const RandomStream &stream,
+                           const uint64_t first_index);
+
+/**
+ * Specialization for half.
+ *
+ * @overload
+ */
+template <>
+void fill_random<half>(std::span<half> data, const half min, const half max,
+                       const RandomStream &stream, const uint64_t first_index);
+
+/**
+ * Specialization for tfloat.
+ *
+ * @overload
+ */
+template <>
+void fill_random<tfloat>(std::span<tfloat> data, const tfloat min,
+                         const tfloat max, const RandomStream &stream,
+                         const uint64_t first_index);
+
+template <typename T>
+std::vector<T> RandomStream::generate_vector(const size_t size,
+                                             const scalar_type_v<T> min,
+                                             const scalar_type_v<T> max,
+                                             const uint64_t first_index) const {
+  std::vector<T> data(size);
+  if constexpr (is_vector_v<T>) {
+    parallel_for(size, [&](const size_t begin, const size_t end) {
+      for (size_t i = begin; i < end; i++) {
+        data[i] = generate_value<T>(first_index + i, min, max);
+      }
+    });
+  } else {
+    fill_random<T>(data, min, max, *this, first_index);
+  }
+  return data;
+}
+
+/**
+ * Specialization for float.
+ *
+ * @overload
+ */
+template <>
+float RandomStream::generate_value<float>(const uint64_t index,
+                                          const float min,
+                                          const float max) const;
+
+/**
+ * Specialization for double.
+ *
+ * @overload
+ */
+template <>
+double RandomStream::generate_value<double>(const uint64_t index,
+                                            const double min,
+                                            const double max) const;
+
+/**
+ * Specialization for bfloat16.
+ *
+ * @overload
+ */
+template <>
+bfloat16 RandomStream::generate_value<bfloat16>(const uint64_t index,
+                                                const bfloat16 min,
+                                                const bfloat16 max) const;
+
+/**
+ * Specialization for half.
+ *
+ * @overload
+ */
+template <>
+half RandomStream::generate_value<half>(const uint64_t index, const half min,
+                                        const half max) const;
+
+/**
+ * Specialization for tfloat.
+ *
+ * @overload
+ */
+template <>
+tfloat RandomStream::generate_value<tfloat>(const uint64_t index,
+                                            const tfloat min,
+                                            const tfloat max) const;
+
+} // namespace cassian
+
+#endif
@@ -0,0 +1,430 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <cassian/random/random_stream.hpp>
+#include <cassian/utility/parallel.hpp>
+#include <cassian/utility/utility.hpp>
+#include <cfenv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) &&                              \
+    (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define CASSIAN_RANDOM_AVX2
+#endif
+
+namespace cassian {
+
+namespace {
+
+constexpr uint32_t philox_m0 = 0xD2511F53;
+constexpr uint32_t philox_m1 = 0xCD9E8D57;
+constexpr uint32_t philox_w0 = 0x9E3779B9;
+constexpr uint32_t philox_w1 = 0xBB67AE85;
+constexpr int philox_rounds = 10;
+
+// Number of values generated and mapped at once by fill_random
+constexpr size_t block_size = 1024;
+
+uint64_t splitmix64(uint64_t value) {
+  value += 0x9E3779B97F4A7C15;
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+  return value ^ (value >> 31);
+}
+
+// High 64 bits of a 64x64-bit product.
+uint64_t multiply_high(const uint64_t a, const uint64_t b) {
+  const uint64_t a_lo = a & 0xFFFFFFFF;
+  const uint64_t a_hi = a >> 32;
+  const uint64_t b_lo = b & 0xFFFFFFFF;
+  const uint64_t b_hi = b >> 32;
+  const uint64_t lo_lo = a_lo * b_lo;
+  const uint64_t hi_lo = a_hi * b_lo;
+  const uint64_t lo_hi = a_lo * b_hi;
+  const uint64_t hi_hi = a_hi * b_hi;
+  const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+  return hi_hi + (hi_lo >> 32) + (cross >> 32);
+}
+
+void philox_block(const std::array<uint32_t, 2> key, const uint64_t stream_id,
+                  const uint64_t first_index, std::span<uint32_t> low,
+                  std::span<uint32_t> high, size_t i) {
+  for (; i < low.size(); i++) {
+    const uint64_t index = first_index + i;
+    const auto bits = philox4x32(
+        {static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32),
+         static_cast<uint32_t>(stream_id),
+         static_cast<uint32_t>(stream_id >> 32)},
+        key);
+    low[i] = bits[0];
+    if (!high.empty()) {
+      high[i] = bits[1];
+    }
+  }
+}
+
+#ifdef CASSIAN_RANDOM_AVX2
+// High 32 bits of 32x32-bit products in each lane.
+__attribute__((target("avx2"))) __m256i multiply_high_avx2(const __m256i a,
+                                                           const __m256i b) {
+  const __m256i even = _mm256_mul_epu32(a, b);
+  const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+  return _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+}
+
+// Philox4x32-10 for 8 consecutive counters per iteration, returns number of
+// elements generated.
+__attribute__((target("avx2"))) size_t
+philox_block_avx2(const std::array<uint32_t, 2> key, const uint64_t stream_id,
+                  const uint64_t first_index, std::span<uint32_t> low,
+                  std::span<uint32_t> high) {
+  constexpr size_t lanes = 8;
+  const __m256i m0 = _mm256_set1_epi32(static_cast<int>(philox_m0));
+  const __m256i m1 = _mm256_set1_epi32(static_cast<int>(philox_m1));
+  const __m256i stream_lo =
+      _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(stream_id)));
+  const __m256i stream_hi = _mm256_set1_epi32(
+      static_cast<int>(static_cast<uint32_t>(stream_id >> 32)));
+  size_t i = 0;
+  for (; i + lanes <= low.size(); i += lanes) {
+    std::array<uint32_t, lanes> index_lo = {};
+    std::array<uint32_t, lanes> index_hi = {};
+    for (size_t lane = 0; lane < lanes; lane++) {
+      const uint64_t index = first_index + i + lane;
+      index_lo[lane] = static_cast<uint32_t>(index);
+      index_hi[lane] = static_cast<uint32_t>(index >> 32);
+    }
+    __m256i c0 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(index_lo.data()));
+    __m256i c1 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(index_hi.data()));
+    __m256i c2 = stream_lo;
+    __m256i c3 = stream_hi;
+    uint32_t k0 = key[0];
+    uint32_t k1 = key[1];
+    for (int round = 0; round < philox_rounds; round++) {
+      const __m256i hi0 = multiply_high_avx2(c0, m0);
+      const __m256i lo0 = _mm256_mullo_epi32(c0, m0);
+      const __m256i hi1 = multiply_high_avx2(c2, m1);
+      const __m256i lo1 = _mm256_mullo_epi32(c2, m1);
+      c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1),
+                            _mm256_set1_epi32(static_cast<int>(k0)));
+      c1 = lo1;
+      c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3),
+                            _mm256_set1_epi32(static_cast<int>(k1)));
+      c3 = lo0;
+      k0 += philox_w0;
+      k1 += philox_w1;
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(low.data() + i), c0);
+    if (!high.empty()) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(high.data() + i), c1);
+    }
+  }
+  return i;
+}
+
+bool is_avx2_supported() {
+  static const bool supported = __builtin_cpu_supports("avx2");
+  return supported;
+}
+#endif
+
+template <typename T> void validate_range(const T min, const T max) {
+  if (std::isnan(min) || std::isnan(max)) {
+    throw std::invalid_argument("NaN value passed to generate_value");
+  }
+
+  if (std::isinf(min) || std::isinf(max)) {
+    throw std::invalid_argument("INF value passed to generate_value");
+  }
+
+  if (min > max) {
+    throw std::invalid_argument(
+        "min bigger than max passed to generate_value");
+  }
+}
+
+template <typename T>
+T interpolate(const T random, const T min, const T max) {
+  if (min < 0 && max > 0) {
+    const T positive_part = random * max;
+    const T negative_part = (T(1) - random) * min;
+    return positive_part + negative_part;
+  }
+  return min + random * (max - min);
+}
+
+float to_unit_float(const uint32_t bits) {
+  return static_cast<float>(bits) / static_cast<float>(UINT32_MAX);
+}
+
+double to_unit_double(const uint64_t bits) {
+  return static_cast<double>(bits) / static_cast<double>(UINT64_MAX);
+}
+
+// Same mapping as interpolate with the range checks hoisted out of the loop.
+// Element i of data takes unit value to_unit(i).
+template <typename T, typename U, typename TO_UNIT>
+void map_uniform(std::span<T> data, const U min, const U max,
+                 const TO_UNIT &to_unit) {
+  if (min < 0 && max > 0) {
+    for (size_t i = 0; i < data.size(); i++) {
+      const U random = to_unit(i);
+      const U positive_part = random * max;
+      const U negative_part = (U(1) - random) * min;
+      data[i] = static_cast<T>(positive_part + negative_part);
+    }
+  } else {
+    const U range = max - min;
+    for (size_t i = 0; i < data.size(); i++) {
+      data[i] = static_cast<T>(min + to_unit(i) * range);
+    }
+  }
+}
+
+// Calls body(offset, values) for consecutive blocks of unit values of U,
+// generated with the block Philox generator.
+template <typename U, typename BODY>
+void generate_unit_blocks(const RandomStream &stream, const uint64_t first,
+                          const size_t begin, const size_t end,
+                          const BODY &body) {
+  std::array<uint32_t, block_size> low;
+  std::array<uint32_t, block_size> high;
+  std::array<U, block_size> values;
+  for (size_t offset = begin; offset < end; offset += block_size) {
+    const size_t count = std::min(block_size, end - offset);
+    if constexpr (std::is_same_v<U, float>) {
+      stream.generate_bits(first + offset, std::span(low.data(), count), {});
+    } else {
+      stream.generate_bits(first + offset, std::span(low.data(), count),
+                           std::span(high.data(), count));
+    }
+    body(offset, std::span<U>(values.data(), count), [&](const size_t i) {
+      if constexpr (std::is_same_v<U, float>) {
+        return to_unit_float(low[i]);
+      } else {
+        return to_unit_double(static_cast<uint64_t>(low[i]) |
+                              (static_cast<uint64_t>(high[i]) << 32));
+      }
+    });
+  }
+}
+
+// Batch conversion of floats, rounded in rounding_mode by formats that honor
+// the current rounding mode.
+template <typename T>
+void convert_block(std::span<const float> input, std::span<T> output,
+                   const int rounding_mode) {
+  if constexpr (std::is_same_v<T, half>) {
+    convert(input, output, rounding_mode);
+  } else {
+    convert(input, output);
+  }
+}
+
+template <typename T, typename U>
+void fill_uniform(std::span<T> data, const U min, const U max,
+                  const RandomStream &stream, const uint64_t first_index) {
+  validate_range(min, max);
+  if (min == max) {
+    std::fill(data.begin(), data.end(), static_cast<T>(min));
+    return;
+  }
+  // Pool threads run in the default rounding mode, so the caller's mode is
+  // applied to every chunk to keep results independent of the thread count.
+  const int rounding_mode = std::fegetround();
+  parallel_for(
+      data.size(),
+      [&](const size_t begin, const size_t end) {
+        const int thread_rounding_mode = std::fegetround();
+        std::fesetround(rounding_mode);
+        auto restore_rounding_mode =
+            finally([&]() { std::fesetround(thread_rounding_mode); });
+        generate_unit_blocks<U>(
+            stream, first_index, begin, end,
+            [&](const size_t offset, std::span<U> values,
+                const auto &to_unit) {
+              if constexpr (std::is_same_v<T, U>) {
+                map_uniform(data.subspan(offset, values.size()), min, max,
+                            to_unit);
+              } else {
+                // 16-bit formats are converted with a single batch
+                // conversion per block, which avoids per-element rounding
+                // mode queries.
+                map_uniform(values, min, max, to_unit);
+                convert_block(std::span<const U>(values),
+                              data.subspan(offset, values.size()),
+                              rounding_mode);
+              }
+            });
+      },
+      block_size);
+}
+
+template <typename T>
+void fill_random_from_float(std::span<T> data, const T min, const T max,
+                            const RandomStream &stream,
+                            const uint64_t first_index) {
+  fill_uniform(data, static_cast<float>(min), static_cast<float>(max), stream,
+               first_index);
+}
+
+} // namespace
+
+std::array<uint32_t, 4> philox4x32(std::array<uint32_t, 4> counter,
+                                   std::array<uint32_t, 2> key) {
+  for (int round = 0; round < philox_rounds; round++) {
+    const uint64_t product0 = static_cast<uint64_t>(philox_m0) * counter[0];
+    const uint64_t product1 = static_cast<uint64_t>(philox_m1) * counter[2];
+    const auto hi0 = static_cast<uint32_t>(product0 >> 32);
+    const auto lo0 = static_cast<uint32_t>(product0);
+    const auto hi1 = static_cast<uint32_t>(product1 >> 32);
+    const auto lo1 = static_cast<uint32_t>(product1);
+    counter = {hi1 ^ counter[1] ^ key[0], lo1, hi0 ^ counter[3] ^ key[1], lo0};
+    key[0] += philox_w0;
+    key[1] += philox_w1;
+  }
+  return counter;
+}
+
+RandomStream::RandomStream(const int seed, const std::string &name,
+                           const uint64_t stream_id)
+    : stream_id_(stream_id) {
+  const uint64_t key =
+      splitmix64(fnv1a_hash(name) ^ splitmix64(static_cast<uint64_t>(seed)));
+  key_ = {static_cast<uint32_t>(key), static_cast<uint32_t>(key >> 32)};
+}
+
+std::array<uint32_t, 4>
+RandomStream::generate_bits(const uint64_t index) const {
+  return philox4x32({static_cast<uint32_t>(index),
+                     static_cast<uint32_t>(index >> 32),
+                     static_cast<uint32_t>(stream_id_),
+                     static_cast<uint32_t>(stream_id_ >> 32)},
+                    key_);
+}
+
+void RandomStream::generate_bits(const uint64_t first_index,
+                                 std::span<uint32_t> low,
+                                 std::span<uint32_t> high) const {
+  if (!high.empty() && high.size() != low.size()) {
+    throw std::invalid_argument("Output sizes differ");
+  }
+  size_t i = 0;
+#ifdef CASSIAN_RANDOM_AVX2
+  if (is_avx2_supported()) {
+    i = philox_block_avx2(key_, stream_id_, first_index, low, high);
+  }
+#endif
+  philox_block(key_, stream_id_, first_index, low, high, i);
+}
+
+uint64_t RandomStream::generate_uint(const uint64_t index,
+                                     const uint64_t range) const {
+  const auto bits = generate_bits(index);
+  const uint64_t value = static_cast<uint64_t>(bits[0]) |
+                         (static_cast<uint64_t>(bits[1]) << 32);
+  if (range == UINT64_MAX) {
+    return value;
+  }
+  return multiply_high(value, range + 1);
+}
+
+template <>
+float RandomStream::generate_value<float>(const uint64_t index,
+                                          const float min,
+                                          const float max) const {
+  validate_range(min, max);
+  if (min == max) {
+    return min;
+  }
+  return interpolate(to_unit_float(generate_bits(index)[0]), min, max);
+}
+
+template <>
+double RandomStream::generate_value<double>(const uint64_t index,
+                                            const double min,
+                                            const double max) const {
+  validate_range(min, max);
+  if (min == max) {
+    return min;
+  }
+  return interpolate(to_unit_double(generate_uint(index, UINT64_MAX)), min,
+                     max);
+}
+
+template <>
+bfloat16 RandomStream::generate_value<bfloat16>(const uint64_t index,
+                                                const bfloat16 min,
+                                                const bfloat16 max) const {
+  const auto f_min = static_cast<float>(min);
+  const auto f_max = static_cast<float>(max);
+  return static_cast<bfloat16>(generate_value<float>(index, f_min, f_max));
+}
+
+template <>
+half RandomStream::generate_value<half>(const uint64_t index, const half min,
+                                        const half max) const {
+  const auto f_min = static_cast<float>(min);
+  const auto f_max = static_cast<float>(max);
+  return static_cast<half>(generate_value<float>(index, f_min, f_max));
+}
+
+template <>
+tfloat RandomStream::generate_value<tfloat>(const uint64_t index,
+                                            const tfloat min,
+                                            const tfloat max) const {
+  const auto f_min = static_cast<float>(min);
+  const auto f_max = static_cast<float>(max);
+  return static_cast<tfloat>(generate_value<float>(index, f_min, f_max));
+}
+
+template <>
+void fill_random<float>(std::span<float> data, const float min,
+                        const float max, const RandomStream &stream,
+                        const uint64_t first_index) {
+  fill_random_from_float(data, min, max, stream, first_index);
+}
+
+template <>
+void fill_random<double>(std::span<double> data, const double min,
+                         const double max, const RandomStream &stream,
+                         const uint64_t first_index) {
+  fill_uniform(data, min, max, stream, first_index);
+}
+
+template <>
+void fill_random<bfloat16>(std::span<bfloat16> data, const bfloat16 min,
+                           const bfloat16 max, const RandomStream &stream,
+                           const uint64_t first_index) {
+  fill_random_from_float(data, min, max, stream, first_index);
+}
+
+template <>
+void fill_random<half>(std::span<half> data, const half min, const half max,
+                       const RandomStream &stream, const uint64_t first_index) {
+  fill_random_from_float(data, min, max, stream, first_index);
+}
+
+template <>
+void fill_random<tfloat>(std::span<tfloat> data, const tfloat min,
+                         const tfloat max, const RandomStream &stream,
+                         const uint64_t first_index) {
+  fill_random_from_float(data, min, max, stream, first_index);
+}
+
+} // namespace cassian
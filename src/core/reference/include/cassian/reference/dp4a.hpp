@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <vector>
 
+#include <cassian/utility/parallel.hpp>
 #include <cassian/vector/vector.hpp>
 
 /**
@@ -29,12 +30,14 @@ std::vector<int32_t> dp4a(const std::vector<Vector<A_TYPE, 4>> &input_a,
                           const std::vector<Vector<B_TYPE, 4>> &input_b,
                           const std::vector<int32_t> &input_c) {
   std::vector<int32_t> output(input_c.size(), 0);
-  for (size_t i = 0; i < output.size(); ++i) {
-    output[i] = input_c[i];
-    for (int j = 0; j < 4; ++j) {
-      output[i] += input_a[i][j] * input_b[i][j];
+  parallel_for(output.size(), [&](const size_t begin, const size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      output[i] = input_c[i];
+      for (int j = 0; j < 4; ++j) {
+        output[i] += input_a[i][j] * input_b[i][j];
+      }
     }
-  }
+  });
   return output;
 }
 
@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_REFERENCE_REFERENCE_STORE_HPP
+#define CASSIAN_REFERENCE_REFERENCE_STORE_HPP
+
+#include <cassian/utility/utility.hpp>
+#include <cassian/vector/vector.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Cassian namespace.
+ */
+namespace cassian {
+
+/**
+ * Identifies reference results in ReferenceStore.
+ */
+struct ReferenceKey {
+  /**
+   * Function and its variant, e.g. kernel build options.
+   */
+  std::string function;
+
+  /**
+   * Data types and precision of reference values.
+   */
+  std::string type;
+
+  /**
+   * Hash of inputs used to compute references.
+   */
+  uint64_t input_hash = 0;
+
+  /**
+   * Version of reference implementations the results were computed with.
+   */
+  uint32_t version = 0;
+};
+
+/**
+ * Version of reference implementations used by test suites. Bump whenever
+ * any of them changes results, so that stale entries are not reused.
+ */
+constexpr uint32_t reference_version = 1;
+
+/**
+ * Build key of reference results computed with current reference
+ * implementations.
+ *
+ * @param[in] function function and its variant, e.g. kernel build options.
+ * @param[in] type data types and precision of reference values.
+ * @param[in] input_hash hash of inputs used to compute references.
+ * @returns key with version set to reference_version.
+ */
+inline ReferenceKey make_reference_key(std::string function, std::string type,
+                                       uint64_t input_hash) {
+  return {std::move(function), std::move(type), input_hash, reference_version};
+}
+
+/**
+ * Read-only view of reference values fetched from ReferenceStore.
+ *
+ * View keeps the underlying memory alive, so it can outlive the store.
+ *
+ * @tparam T reference type.
+ */
+template <typename T> class ReferenceView {
+public:
+  /**
+   * Construct empty view.
+   */
+  ReferenceView() = default;
+
+  /**
+   * Construct view of owned data.
+   *
+   * @param[in] mapping owner of memory, e.g. file mapping.
+   * @param[in] data pointer to first value inside owned memory.
+   * @param[in] size number of values.
+   */
+  ReferenceView(std::shared_ptr<const void> mapping, const T *data,
+                size_t size)
+      : mapping_(std::move(mapping)), values_(data, size) {}
+
+  /**
+   * Get number of values.
+   *
+   * @returns number of values.
+   */
+  size_t size() const { return values_.size(); }
+
+  /**
+   * Get pointer to values.
+   *
+   * @returns pointer to first value.
+   */
+  const T *data() const { return values_.data(); }
+
+  /**
+   * Get value.
+   *
+   * @param[in] index value index.
+   * @returns value.
+   */
+  const T &operator[](size_t index) const { return values_[index]; }
+
+  /**
+   * Get iterator to first value.
+   *
+   * @returns iterator.
+   */
+  auto begin() const { return values_.begin(); }
+
+  /**
+   * Get iterator past last value.
+   *
+   * @returns iterator.
+   */
+  auto end() const { return values_.end(); }
+
+  /**
+   * Get values as span.
+   *
+   * @returns span of values.
+   */
+  std::span<const T> span() const { return values_; }
+
+private:
+  std::shared_ptr<const void> mapping_;
+  std::span<const T> values_;
+};
+
+/**
+ * Exception class used when reference store entry can't be written.
+ */
+class ReferenceStoreException : public std::runtime_error {
+  using std::runtime_error::runtime_error;
+};
+
+/**
+ * On-disk store of precomputed reference results.
+ *
+ * Each entry is a separate file which is memory-mapped on lookup, so
+ * references are fetched without copying. Entries are written atomically,
+ * so concurrent test runs can share a store directory.
+ */
+class ReferenceStore {
+public:
+  /**
+   * Construct disabled store.
+   */
+  ReferenceStore() = default;
+
+  /**
+   * Construct store in a directory.
+   *
+   * @param[in] directory store directory, created on first store. Empty path
+   * disables the store.
+   * @param[in] rebuild ignore existing entries and overwrite them.
+   */
+  ReferenceStore(std::filesystem::path directory, bool rebuild);
+
+  /**
+   * Check whether store is enabled.
+   *
+   * @returns true if store has a directory.
+   */
+  bool enabled() const;
+
+  /**
+   * Find reference values.
+   *
+   * @tparam T reference type.
+   * @param[in] key entry key.
+   * @returns view of stored values or std::nullopt if entry does not exist,
+   * store is disabled or being rebuilt.
+   */
+  template <typename T>
+  std::optional<ReferenceView<T>> find(const ReferenceKey &key) const {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Reference type must be trivially copyable");
+    size_t size = 0;
+    auto mapping = find(key, sizeof(T), &size);
+    if (mapping == nullptr) {
+      return std::nullopt;
+    }
+    const auto *data = static_cast<const T *>(mapping.get());
+    return ReferenceView<T>(std::move(mapping), data, size / sizeof(T));
+  }
+
+  /**
+   * Store reference values. Does nothing if store is disabled.
+   *
+   * @tparam T reference type.
+   * @param[in] key entry key.
+   * @param[in] values values to store.
+   * @throws cassian::ReferenceStoreException Thrown if entry can't be written.
+   */
+  template <typename T>
+  void store(const ReferenceKey &key, std::span<const T> values) const {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Reference type must be trivially copyable");
+    store(key, sizeof(T), values.data(), values.size_bytes());
+  }
+
+  /**
+   * Fetch reference values from store or compute and store them.
+   *
+   * @tparam T reference type.
+   * @tparam F function type.
+   * @param[in] key entry key.
+   * @param[in] size number of values.
+   * @param[in] compute function filling `std::vector<T> &` of given size.
+   * @returns view of stored values, or of computed values if entry does not
+   * exist.
+   * @throws cassian::ReferenceStoreException Thrown if entry can't be written.
+   */
+  template <typename T, typename F>
+  ReferenceView<T> fetch(const ReferenceKey &key, size_t size,
+                         F compute) const {
+    if (auto view = find<T>(key); view && view->size() == size) {
+      return std::move(*view);
+    }
+    auto values = std::make_shared<std::vector<T>>(size);
+    compute(*values);
+    store<T>(key, *values);
+    const auto *data = values->data();
+    return ReferenceView<T>(std::move(values), data, size);
+  }
+
+private:
+  std::filesystem::path directory_;
+  bool rebuild_ = false;
+
+  std::shared_ptr<const void> find(const ReferenceKey &key,
+                                   size_t element_size, size_t *size) const;
+  void store(const ReferenceKey &key, size_t element_size, const void *data,
+             size_t size) const;
+  std::filesystem::path get_path(const ReferenceKey &key) const;
+};
+
+/**
+ * Set store used by test suites.
+ *
+ * @param[in] store reference store.
+ */
+void set_reference_store(ReferenceStore store);
+
+/**
+ * Get store used by test suites.
+ *
+ * @returns reference store, disabled unless set_reference_store was called.
+ */
+const ReferenceStore &get_reference_store();
+
+/**
+ * Compute hash of input vectors.
+ *
+ * Only element values are hashed, so padding of vector types does not affect
+ * the result.
+ *
+ * @param[in] inputs vectors to hash.
+ * @returns 64-bit hash.
+ */
+template <typename... T> uint64_t hash_inputs(const std::vector<T> &...inputs) {
+  uint64_t hash = fnv1a_offset_basis;
+  const auto add = [&hash](const auto &input) {
+    using value_type = typename std::decay_t<decltype(input)>::value_type;
+    const uint64_t size = input.size();
+    hash = fnv1a_hash(&size, sizeof(size), hash);
+    if constexpr (is_vector_v<value_type>) {
+      for (const auto &value : input) {
+        for (int i = 0; i < value_type::vector_size; i++) {
+          hash = fnv1a_hash(&value[i], sizeof(value[i]), hash);
+        }
+      }
+    } else {
+      hash = fnv1a_hash(input.data(), input.size() * sizeof(value_type), hash);
+    }
+  };
+  (add(inputs), ...);
+  return hash;
+}
+
+} // namespace cassian
+#endif
@@ -0,0 +1,23 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_REFERENCE_MAPPED_FILE_HPP
+#define CASSIAN_REFERENCE_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+
+namespace cassian {
+
+// Maps whole file read-only. Returns nullptr if file can't be opened, is
+// empty or can't be mapped. Mapping is released with the last reference.
+std::shared_ptr<const void> map_file(const std::filesystem::path &path,
+                                     size_t *size);
+
+} // namespace cassian
+#endif
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cstddef>
+#include <fcntl.h>
+#include <filesystem>
+#include <mapped_file.hpp>
+#include <memory>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cassian {
+
+std::shared_ptr<const void> map_file(const std::filesystem::path &path,
+                                     size_t *size) {
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return nullptr;
+  }
+  struct stat status = {};
+  if (fstat(fd, &status) != 0 || status.st_size <= 0) {
+    close(fd);
+    return nullptr;
+  }
+  const auto file_size = static_cast<size_t>(status.st_size);
+  void *data = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return nullptr;
+  }
+  *size = file_size;
+  return {data, [file_size](const void *pointer) {
+            munmap(const_cast<void *>(pointer), file_size);
+          }};
+}
+
+} // namespace cassian
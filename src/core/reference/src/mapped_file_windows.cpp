@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cstddef>
+#include <filesystem>
+#include <mapped_file.hpp>
+#include <memory>
+#include <windows.h>
+
+namespace cassian {
+
+std::shared_ptr<const void> map_file(const std::filesystem::path &path,
+                                     size_t *size) {
+  HANDLE file = CreateFileW(path.c_str(), GENERIC_READ,
+                            FILE_SHARE_READ | FILE_SHARE_DELETE, NULL,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE) {
+    return nullptr;
+  }
+  LARGE_INTEGER file_size = {};
+  if (GetFileSizeEx(file, &file_size) == 0 || file_size.QuadPart <= 0) {
+    CloseHandle(file);
+    return nullptr;
+  }
+  HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  CloseHandle(file);
+  if (mapping == NULL) {
+    return nullptr;
+  }
+  const void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (data == nullptr) {
+    return nullptr;
+  }
+  *size = static_cast<size_t>(file_size.QuadPart);
+  return {data, [](const void *pointer) { UnmapViewOfFile(pointer); }};
+}
+
+} // namespace cassian
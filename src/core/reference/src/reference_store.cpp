@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <array>
+#include <cassian/reference/reference_store.hpp>
+#include <cassian/utility/utility.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <mapped_file.hpp>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace cassian {
+
+namespace {
+
+constexpr std::array<char, 8> store_magic = {'C', 'A', 'S', 'R',
+                                             'E', 'F', '0', '2'};
+
+// Values are placed at an aligned offset, so mapped entries can be accessed
+// in place.
+constexpr uint64_t data_alignment = 64;
+
+struct EntryHeader {
+  std::array<char, 8> magic;
+  uint64_t function_size;
+  uint64_t type_size;
+  uint64_t input_hash;
+  uint64_t version;
+  uint64_t element_size;
+  uint64_t data_offset;
+  uint64_t data_size;
+};
+
+uint64_t get_data_offset(const ReferenceKey &key) {
+  const uint64_t size =
+      sizeof(EntryHeader) + key.function.size() + key.type.size();
+  return (size + data_alignment - 1) / data_alignment * data_alignment;
+}
+
+ReferenceStore reference_store;
+
+} // namespace
+
+ReferenceStore::ReferenceStore(std::filesystem::path directory, bool rebuild)
+    : directory_(std::move(directory)), rebuild_(rebuild) {}
+
+bool ReferenceStore::enabled() const { return !directory_.empty(); }
+
+std::shared_ptr<const void> ReferenceStore::find(const ReferenceKey &key,
+                                                 size_t element_size,
+                                                 size_t *size) const {
+  if (!enabled() || rebuild_) {
+    return nullptr;
+  }
+  size_t file_size = 0;
+  auto mapping = map_file(get_path(key), &file_size);
+  if (mapping == nullptr || file_size < sizeof(EntryHeader)) {
+    return nullptr;
+  }
+  const auto *bytes = static_cast<const char *>(mapping.get());
+  EntryHeader header = {};
+  std::memcpy(&header, bytes, sizeof(header));
+  if (header.magic != store_magic ||
+      header.function_size != key.function.size() ||
+      header.type_size != key.type.size() ||
+      header.input_hash != key.input_hash ||
+      header.version != key.version ||
+      header.element_size != element_size ||
+      header.data_offset != get_data_offset(key) ||
+      header.data_offset > file_size ||
+      header.data_size % element_size != 0 ||
+      header.data_size > file_size - header.data_offset) {
+    return nullptr;
+  }
+  const auto *function = bytes + sizeof(header);
+  const auto *type = function + header.function_size;
+  if (key.function.compare(0, key.function.size(), function,
+                           header.function_size) != 0 ||
+      key.type.compare(0, key.type.size(), type, header.type_size) != 0) {
+    return nullptr;
+  }
+  *size = header.data_size;
+  return {mapping, bytes + header.data_offset};
+}
+
+void ReferenceStore::store(const ReferenceKey &key, size_t element_size,
+                           const void *data, size_t size) const {
+  if (!enabled()) {
+    return;
+  }
+  std::error_code error;
+  std::filesystem::create_directories(directory_, error);
+  if (error) {
+    throw ReferenceStoreException(
+        "Failed to create reference store directory: " + directory_.string());
+  }
+
+  EntryHeader header = {};
+  header.magic = store_magic;
+  header.function_size = key.function.size();
+  header.type_size = key.type.size();
+  header.input_hash = key.input_hash;
+  header.version = key.version;
+  header.element_size = element_size;
+  header.data_offset = get_data_offset(key);
+  header.data_size = size;
+
+  std::vector<uint8_t> entry(header.data_offset + size);
+  std::memcpy(entry.data(), &header, sizeof(header));
+  std::memcpy(entry.data() + sizeof(header), key.function.data(),
+              key.function.size());
+  std::memcpy(entry.data() + sizeof(header) + key.function.size(),
+              key.type.data(), key.type.size());
+  std::memcpy(entry.data() + header.data_offset, data, size);
+
+  // Saved atomically, so concurrent runs never map a partially written entry.
+  // Entry may still be saved by a concurrent run if rename fails.
+  const auto path = get_path(key);
+  if (!save_binary_file_atomic(entry, path.string()) &&
+      !std::filesystem::exists(path)) {
+    throw ReferenceStoreException("Failed to write reference store entry: " +
+                                  path.string());
+  }
+}
+
+std::filesystem::path ReferenceStore::get_path(const ReferenceKey &key) const {
+  uint64_t hash = fnv1a_hash(key.function.data(), key.function.size());
+  hash = fnv1a_hash(key.type.data(), key.type.size(), hash);
+  hash = fnv1a_hash(&key.input_hash, sizeof(key.input_hash), hash);
+  hash = fnv1a_hash(&key.version, sizeof(key.version), hash);
+  std::stringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << hash << ".ref";
+  return directory_ / ss.str();
+}
+
+void set_reference_store(ReferenceStore store) {
+  reference_store = std::move(store);
+}
+
+const ReferenceStore &get_reference_store() { return reference_store; }
+
+} // namespace cassian
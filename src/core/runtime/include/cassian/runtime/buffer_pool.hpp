@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_RUNTIME_BUFFER_POOL_HPP
+#define CASSIAN_RUNTIME_BUFFER_POOL_HPP
+
+#include <cassian/runtime/access_qualifier.hpp>
+#include <cassian/runtime/idle_list.hpp>
+#include <cassian/runtime/memory_kind.hpp>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Cassian namespace.
+ */
+namespace cassian {
+
+/**
+ * Buffer pool statistics.
+ */
+struct BufferPoolStatistics {
+  /**
+   * Number of buffers served from the pool.
+   */
+  size_t pool_allocations = 0;
+
+  /**
+   * Number of buffers allocated by the driver.
+   */
+  size_t driver_allocations = 0;
+
+  /**
+   * Size of idle buffers in bytes.
+   */
+  size_t idle_bytes = 0;
+
+  /**
+   * Largest size of idle buffers in bytes.
+   */
+  size_t peak_idle_bytes = 0;
+};
+
+/**
+ * Pool of released buffers.
+ *
+ * Buffers are allocated with exact requested size, so that out of bounds
+ * accesses are not hidden by slack memory. Released buffers are kept idle and
+ * handed out again for a request of the same size, device, memory kind and
+ * access qualifier. Least recently released buffers are freed when the size of
+ * idle buffers exceeds the limit. Buffers larger than the limit bypass the
+ * pool and are freed on release.
+ */
+class BufferPool {
+public:
+  /**
+   * Default maximum size of idle buffers in bytes.
+   */
+  static constexpr size_t default_limit = 256 * 1024 * 1024;
+
+  /**
+   * Construct a pool.
+   *
+   * @param[in] limit maximum size of idle buffers in bytes.
+   */
+  explicit BufferPool(size_t limit = default_limit);
+
+  /**
+   * Take idle buffer out of the pool.
+   *
+   * @param[in] device device id.
+   * @param[in] size requested size in bytes.
+   * @param[in] access access qualifier.
+   * @param[in] memory_kind memory kind.
+   * @returns buffer id or std::nullopt if there is no matching idle buffer.
+   */
+  std::optional<std::uintptr_t> acquire(int device, size_t size,
+                                        AccessQualifier access,
+                                        MemoryKind memory_kind);
+
+  /**
+   * Add buffer allocated by the driver to the pool. Buffer is marked as in
+   * use.
+   *
+   * @param[in] buffer buffer id.
+   * @param[in] device device id.
+   * @param[in] size requested size in bytes.
+   * @param[in] access access qualifier.
+   * @param[in] memory_kind memory kind.
+   */
+  void insert(std::uintptr_t buffer, int device, size_t size,
+              AccessQualifier access, MemoryKind memory_kind);
+
+  /**
+   * Mark buffer as idle.
+   *
+   * @param[in] buffer buffer id.
+   * @returns buffers removed from the pool, to be freed by the caller.
+   */
+  std::vector<std::uintptr_t> release(std::uintptr_t buffer);
+
+  /**
+   * Set maximum size of idle buffers. Applied on next release.
+   *
+   * @param[in] limit maximum size of idle buffers in bytes, 0 disables
+   * reuse.
+   */
+  void set_limit(size_t limit);
+
+  /**
+   * Remove all idle buffers from the pool.
+   *
+   * @returns buffers removed from the pool, to be freed by the caller.
+   */
+  std::vector<std::uintptr_t> trim();
+
+  /**
+   * Get pool statistics.
+   *
+   * @returns statistics.
+   */
+  BufferPoolStatistics get_statistics() const;
+
+private:
+  struct Key {
+    int device = 0;
+    MemoryKind memory_kind = MemoryKind::device;
+    AccessQualifier access = AccessQualifier::read_write;
+    size_t size = 0;
+
+    auto operator<=>(const Key &) const = default;
+  };
+
+  size_t limit_;
+  BufferPoolStatistics statistics_;
+  std::unordered_map<std::uintptr_t, Key> keys_;
+  IdleList<Key> idle_buffers_;
+};
+
+} // namespace cassian
+
+#endif
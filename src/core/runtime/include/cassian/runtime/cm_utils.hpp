@@ -19,6 +19,8 @@ namespace cassian {
 /**
  * Checks if CM optional feature is supported
  *
+ * Result is memoized in the runtime, each feature is probed once.
+ *
  * @param[in] runtime
  * @param[in] program_type
  * @param[in] feature_macro name of feature
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_RUNTIME_DEVICE_INFO_HPP
+#define CASSIAN_RUNTIME_DEVICE_INFO_HPP
+
+#include <array>
+#include <cassian/runtime/device_properties.hpp>
+#include <cassian/runtime/feature.hpp>
+#include <functional>
+#include <string>
+
+/**
+ * Cassian namespace.
+ */
+namespace cassian {
+
+/**
+ * Immutable snapshot of device properties and supported features.
+ *
+ * Runtimes take a single snapshot of root device 0 in initialize(). Runtime
+ * reports properties and features of this device only, subdevices created by
+ * initialize_subdevices() are not queried.
+ */
+class DeviceInfo {
+public:
+  /**
+   * Query all device properties and features.
+   *
+   * Errors thrown while querying are stored and rethrown when a given
+   * property or feature is read.
+   *
+   * @param[in] query_property function returning value of a given property.
+   * @param[in] query_feature function checking if a given feature is
+   * supported.
+   * @returns snapshot.
+   */
+  static DeviceInfo
+  query(const std::function<int(DeviceProperty)> &query_property,
+        const std::function<bool(Feature)> &query_feature);
+
+  /**
+   * Get device property.
+   *
+   * @param[in] property property to read.
+   * @returns value of a given property.
+   * @throws cassian::RuntimeException Thrown if property could not be queried.
+   */
+  int get_device_property(DeviceProperty property) const;
+
+  /**
+   * Check if a given feature is supported.
+   *
+   * @param[in] feature feature to check.
+   * @returns true if feature is supported.
+   * @throws cassian::RuntimeException Thrown if feature could not be queried.
+   */
+  bool is_feature_supported(Feature feature) const;
+
+private:
+  static constexpr size_t property_count =
+      static_cast<size_t>(DeviceProperty::count);
+  static constexpr size_t feature_count = static_cast<size_t>(Feature::count);
+
+  std::array<int, property_count> properties_ = {};
+  std::array<std::string, property_count> property_errors_ = {};
+  std::array<bool, feature_count> features_ = {};
+  std::array<std::string, feature_count> feature_errors_ = {};
+};
+
+} // namespace cassian
+
+#endif
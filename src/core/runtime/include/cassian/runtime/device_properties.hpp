@@ -36,7 +36,11 @@ enum class DeviceProperty {
   fp64_config,
   dot_product_capabilities,
   non_uniform_work_group,
-  max_compute_units
+  max_compute_units,
+  /**
+   * Number of device properties, must be the last enumerator.
+   */
+  count
 };
 
 } // namespace cassian
@@ -29,6 +29,19 @@ namespace cassian {
  */
 std::unique_ptr<Runtime> create_runtime(const std::string &name);
 
+/**
+ * Create runtime configured with runtime specific command line arguments.
+ *
+ * @param[in] parser parser with arguments registered by
+ * `add_runtime_arguments`.
+ * @returns pointer to an object implementing cassian::Runtime interface.
+ * @throws cassian::UnknownRuntimeException Thrown if `--runtime` is not a
+ * supported runtime.
+ * @throws cassian::RuntimeException Thrown if a runtime specific argument has
+ * invalid value.
+ */
+std::unique_ptr<Runtime> create_runtime(const CommandLineParser &parser);
+
 /**
  * Override runtime creation.
  *
@@ -53,7 +53,11 @@ enum class Feature {
   integer_dp4a,
   integer_dp4a_packed,
   non_uniform_work_group,
-  extended_bit_operations
+  extended_bit_operations,
+  /**
+   * Number of features, must be the last enumerator.
+   */
+  count
 };
 
 /**
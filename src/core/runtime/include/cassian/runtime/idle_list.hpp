@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_RUNTIME_IDLE_LIST_HPP
+#define CASSIAN_RUNTIME_IDLE_LIST_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Cassian namespace.
+ */
+namespace cassian {
+
+/**
+ * Idle driver objects ordered by release time.
+ *
+ * Objects are identified by id and looked up by key. Several objects may
+ * share a key. Used by runtime caches to hand out idle objects again and to
+ * evict least recently released ones.
+ *
+ * @tparam KEY key type, must be ordered with operator<.
+ */
+template <typename KEY> class IdleList {
+public:
+  /**
+   * Add object as most recently released.
+   *
+   * @param[in] key object key.
+   * @param[in] id object id, must not be in the list.
+   */
+  void push(const KEY &key, std::uintptr_t id) {
+    order_.push_front(id);
+    positions_[id] = {items_.emplace(key, id), order_.begin()};
+  }
+
+  /**
+   * Take any object with a given key out of the list.
+   *
+   * @param[in] key object key.
+   * @returns object id or std::nullopt if there is no object for `key`.
+   */
+  std::optional<std::uintptr_t> take(const KEY &key) {
+    auto it = items_.find(key);
+    if (it == items_.end()) {
+      return std::nullopt;
+    }
+    const std::uintptr_t id = it->second;
+    erase(id);
+    return id;
+  }
+
+  /**
+   * Take least recently released object out of the list.
+   *
+   * @returns object key and id or std::nullopt if the list is empty.
+   */
+  std::optional<std::pair<KEY, std::uintptr_t>> take_oldest() {
+    if (order_.empty()) {
+      return std::nullopt;
+    }
+    const std::uintptr_t id = order_.back();
+    std::pair<KEY, std::uintptr_t> oldest = {positions_.at(id).first->first,
+                                             id};
+    erase(id);
+    return oldest;
+  }
+
+  /**
+   * Take all objects out of the list.
+   *
+   * @returns object ids, least recently released last.
+   */
+  std::vector<std::uintptr_t> take_all() {
+    std::vector<std::uintptr_t> ids(order_.begin(), order_.end());
+    items_.clear();
+    order_.clear();
+    positions_.clear();
+    return ids;
+  }
+
+  /**
+   * Remove object from the list.
+   *
+   * @param[in] id object id.
+   * @returns true if object was in the list.
+   */
+  bool erase(std::uintptr_t id) {
+    auto it = positions_.find(id);
+    if (it == positions_.end()) {
+      return false;
+    }
+    items_.erase(it->second.first);
+    order_.erase(it->second.second);
+    positions_.erase(it);
+    return true;
+  }
+
+  /**
+   * Check if object is in the list.
+   *
+   * @param[in] id object id.
+   * @returns true if object is in the list.
+   */
+  bool contains(std::uintptr_t id) const { return positions_.count(id) != 0; }
+
+  /**
+   * Number of objects in the list.
+   */
+  size_t size() const { return order_.size(); }
+
+private:
+  using Items = std::multimap<KEY, std::uintptr_t>;
+  using Order = std::list<std::uintptr_t>;
+
+  Items items_;
+  Order order_;
+  std::unordered_map<std::uintptr_t,
+                     std::pair<typename Items::iterator, typename Order::iterator>>
+      positions_;
+};
+
+} // namespace cassian
+
+#endif
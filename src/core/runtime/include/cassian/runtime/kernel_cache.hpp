@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_RUNTIME_KERNEL_CACHE_HPP
+#define CASSIAN_RUNTIME_KERNEL_CACHE_HPP
+
+#include <cassian/runtime/idle_list.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Cassian namespace.
+ */
+namespace cassian {
+
+/**
+ * In-memory cache of built programs kernels are created from.
+ *
+ * Programs are reference counted and shared by all kernels created with the
+ * same key, while every kernel is a separate driver object, so kernel
+ * arguments are never shared. A program is kept idle when its last kernel is
+ * released. Least recently released programs are evicted when the number of
+ * idle programs exceeds the capacity.
+ */
+class KernelCache {
+public:
+  /**
+   * Default maximum number of idle programs.
+   */
+  static constexpr size_t default_capacity = 256;
+
+  /**
+   * Construct a cache.
+   *
+   * @param[in] capacity maximum number of idle programs.
+   */
+  explicit KernelCache(size_t capacity = default_capacity);
+
+  /**
+   * Get program and add a reference to it.
+   *
+   * @param[in] key program key.
+   * @returns program id or std::nullopt if there is no program for `key`.
+   */
+  std::optional<std::uintptr_t> acquire(const std::string &key);
+
+  /**
+   * Add program to the cache with a single reference.
+   *
+   * @param[in] key program key.
+   * @param[in] program program id.
+   */
+  void insert(const std::string &key, std::uintptr_t program);
+
+  /**
+   * Check if program is owned by the cache.
+   *
+   * @param[in] program program id.
+   * @returns true if program was added with insert and not evicted.
+   */
+  bool contains(std::uintptr_t program) const;
+
+  /**
+   * Drop a reference to program. Program becomes idle when no references
+   * are left.
+   *
+   * @param[in] program program id.
+   * @returns programs evicted from the cache, to be destroyed by the caller.
+   */
+  std::vector<std::uintptr_t> release(std::uintptr_t program);
+
+  /**
+   * Set maximum number of idle programs. Applied on next release.
+   *
+   * @param[in] capacity maximum number of idle programs, 0 disables reuse of
+   * released programs.
+   */
+  void set_capacity(size_t capacity);
+
+  /**
+   * Remove all programs from the cache.
+   *
+   * @returns programs removed from the cache, to be destroyed by the caller.
+   */
+  std::vector<std::uintptr_t> clear();
+
+  /**
+   * Number of programs reused.
+   */
+  size_t hits() const;
+
+  /**
+   * Number of programs not found in the cache.
+   */
+  size_t misses() const;
+
+private:
+  struct Entry {
+    std::string key;
+    size_t references = 1;
+  };
+
+  size_t capacity_;
+  size_t hits_ = 0;
+  size_t misses_ = 0;
+  std::unordered_map<std::uintptr_t, Entry> entries_;
+  std::unordered_map<std::string, std::uintptr_t> programs_;
+  IdleList<std::string> idle_programs_;
+
+  void remove(std::uintptr_t program);
+};
+
+/**
+ * Build kernel cache key.
+ *
+ * @param[in] source program source.
+ * @param[in] build_options build options.
+ * @param[in] program_type program type.
+ * @param[in] spirv_options SPIR-V options.
+ * @returns key unambiguously combining all parameters.
+ */
+std::string kernel_cache_key(const std::string &source,
+                             const std::string &build_options,
+                             const std::string &program_type,
+                             const std::optional<std::string> &spirv_options);
+
+} // namespace cassian
+
+#endif
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_RUNTIME_MAPPED_BUFFERS_HPP
+#define CASSIAN_RUNTIME_MAPPED_BUFFERS_HPP
+
+#include <cassian/runtime/access_qualifier.hpp>
+#include <cassian/runtime/memory_kind.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Cassian namespace.
+ */
+namespace cassian {
+
+/**
+ * Host mappings of buffers.
+ *
+ * Buffers in host or shared memory are accessed in place. Buffers in device
+ * memory are mapped through a host staging copy, which is filled on map unless
+ * access is write_only and copied back on unmap unless access is read_only.
+ */
+class MappedBuffers {
+public:
+  /**
+   * Function copying buffer contents to host memory.
+   */
+  using ReadFunction = std::function<void(void *data)>;
+
+  /**
+   * Function copying host memory to a buffer.
+   */
+  using WriteFunction = std::function<void(const void *data)>;
+
+  /**
+   * Map buffer.
+   *
+   * @param[in] buffer buffer id.
+   * @param[in] size buffer size in bytes.
+   * @param[in] memory_kind memory kind of the buffer.
+   * @param[in] allocation buffer allocation, returned for host and shared
+   * memory.
+   * @param[in] access host access.
+   * @param[in] read function filling the staging copy.
+   * @returns pointer to buffer data of `size` bytes.
+   */
+  void *map(std::uintptr_t buffer, size_t size, MemoryKind memory_kind,
+            void *allocation, AccessQualifier access, const ReadFunction &read);
+
+  /**
+   * Unmap buffer. Does nothing if buffer has no staging copy.
+   *
+   * @param[in] buffer buffer id.
+   * @param[in] write function copying the staging copy back to the buffer.
+   */
+  void unmap(std::uintptr_t buffer, const WriteFunction &write);
+
+private:
+  struct Mapping {
+    std::vector<uint8_t> data;
+    AccessQualifier access = AccessQualifier::read_write;
+  };
+
+  std::unordered_map<std::uintptr_t, Mapping> mappings_;
+};
+
+} // namespace cassian
+
+#endif
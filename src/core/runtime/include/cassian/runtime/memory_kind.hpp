@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_RUNTIME_MEMORY_KIND_HPP
+#define CASSIAN_RUNTIME_MEMORY_KIND_HPP
+
+/**
+ * Cassian namespace.
+ */
+namespace cassian {
+
+/**
+ * Placement of buffer memory.
+ */
+enum class MemoryKind {
+  /**
+   * Device memory, accessed by host through copies.
+   */
+  device,
+  /**
+   * Host memory, accessed by device directly.
+   */
+  host,
+  /**
+   * Memory accessible by host and device, migrated on demand.
+   */
+  shared
+};
+
+} // namespace cassian
+
+#endif
@@ -12,10 +12,14 @@
 #include <cassian/runtime/access_qualifier.hpp>
 #include <cassian/runtime/device_properties.hpp>
 #include <cassian/runtime/feature.hpp>
+#include <cassian/runtime/memory_kind.hpp>
 #include <cassian/runtime/program_descriptor.hpp>
 #include <cassian/runtime/runtime.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace cassian {
 
@@ -28,9 +32,12 @@ public:
   void initialize_subdevices() override;
   int get_subdevice(int root_device, int subdevice) override;
   int get_subdevice_count(int root_device) override;
+  int get_root_device_count() override;
 
   Buffer create_buffer(int device, size_t size,
                        AccessQualifier access) override;
+  Buffer create_buffer(int device, size_t size, AccessQualifier access,
+                       MemoryKind memory_kind) override;
   Image create_image(const ImageDimensions dim, const ImageType type,
                      const ImageFormat format, const ImageChannelOrder order,
                      AccessQualifier access) override;
@@ -44,8 +51,15 @@ public:
   void read_image(const Image &image, void *data) override;
   void write_buffer(const Buffer &buffer, const void *data) override;
   void write_image(const Image &image, const void *data) override;
+  Event enqueue_read_buffer(const Buffer &buffer, void *data) override;
+  Event enqueue_write_buffer(const Buffer &buffer, const void *data) override;
+  void wait(const std::vector<Event> &events) override;
+  void finish(int device) override;
 
+  void *map_buffer(const Buffer &buffer, AccessQualifier access) override;
+  void unmap_buffer(const Buffer &buffer) override;
   void release_buffer(const Buffer &buffer) override;
+  void trim_buffer_pool() override;
   void release_image(const Image &image) override;
   void release_sampler(const Sampler &sampler) override;
 
@@ -67,6 +81,14 @@ public:
                            const Sampler &sampler) override;
   void release_kernel(const Kernel &kernel) override;
 
+  CommandGraph create_command_graph(int device) override;
+  void append_write_buffer(const CommandGraph &graph, const Buffer &buffer,
+                           const void *data) override;
+  void append_read_buffer(const CommandGraph &graph, const Buffer &buffer,
+                          void *data) override;
+  void run_command_graph(const CommandGraph &graph) override;
+  void release_command_graph(const CommandGraph &graph) override;
+
   bool is_feature_supported(Feature feature) const override;
   int get_device_property(DeviceProperty property) const override;
   std::string name() const override;
@@ -81,6 +103,17 @@ protected:
   void run_kernel_common(int device, const Kernel &kernel,
                          std::array<size_t, 3> global_work_size,
                          const std::array<size_t, 3> *local_work_size) override;
+  Event enqueue_run_kernel_common(
+      int device, const Kernel &kernel, std::array<size_t, 3> global_work_size,
+      const std::array<size_t, 3> *local_work_size) override;
+  void append_run_kernel_common(
+      const CommandGraph &graph, const Kernel &kernel,
+      std::array<size_t, 3> global_work_size,
+      const std::array<size_t, 3> *local_work_size) override;
+
+private:
+  std::uintptr_t next_buffer_id_ = 1;
+  std::unordered_map<std::uintptr_t, std::vector<uint8_t>> mapped_buffers_;
 };
 
 } // namespace cassian
@@ -12,6 +12,7 @@
 #include <CL/cl_platform.h>
 #include <cassian/runtime/access_qualifier.hpp>
 #include <cassian/runtime/image_properties.hpp>
+#include <cassian/runtime/memory_kind.hpp>
 #include <cassian/runtime/runtime.hpp>
 
 /**
@@ -41,6 +42,43 @@ cl_mem_flags append_access_qualifier_flags(cl_mem_flags flags,
   return flags;
 }
 
+/**
+ * Adds memory kind flags to the current cl_mem_flags
+ *
+ * Host and shared memory are both allocated in host accessible memory.
+ *
+ * @param[in, out] flags cl_mem_flags
+ * @param[in] memory_kind MemoryKind
+ */
+cl_mem_flags append_memory_kind_flags(cl_mem_flags flags,
+                                      const MemoryKind &memory_kind) {
+  switch (memory_kind) {
+  case MemoryKind::device:
+    break;
+  case MemoryKind::host:
+  case MemoryKind::shared:
+    flags |= CL_MEM_ALLOC_HOST_PTR;
+    break;
+  }
+  return flags;
+}
+
+/**
+ * Get OpenCL map flags
+ *
+ * @param[in] access AccessQualifier of host access
+ */
+cl_map_flags cl_get_map_flags(const AccessQualifier &access) {
+  switch (access) {
+  case AccessQualifier::read_only:
+    return CL_MAP_READ;
+  case AccessQualifier::write_only:
+    return CL_MAP_WRITE_INVALIDATE_REGION;
+  default:
+    return CL_MAP_READ | CL_MAP_WRITE;
+  }
+}
+
 /**
  * Get OpenCL image type
  *
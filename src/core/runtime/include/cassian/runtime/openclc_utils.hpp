@@ -9,6 +9,7 @@
 #define CASSIAN_RUNTIME_OPENCLC_UTILS_HPP
 
 #include <string>
+#include <vector>
 
 #include <cassian/runtime/runtime.hpp>
 
@@ -19,6 +20,8 @@ namespace cassian {
 /**
  * Checks if OpenCL C preprocessor macro is true.
  *
+ * Result is memoized in the runtime, each clause is probed once.
+ *
  * @param[in] runtime
  * @param[in] program_type
  * @param[in] if_clause #if clause to check
@@ -29,6 +32,8 @@ bool check_optional_openclc_macro(Runtime *runtime,
 /**
  * Checks if OpenCL C 3.0 optional feature is supported
  *
+ * Result is memoized in the runtime, each feature is probed once.
+ *
  * @param[in] runtime
  * @param[in] program_type
  * @param[in] feature_macro name of feature
@@ -36,6 +41,13 @@ bool check_optional_openclc_macro(Runtime *runtime,
 bool check_optional_openclc_feature_support(Runtime *runtime,
                                             const std::string &program_type,
                                             const std::string &feature_macro);
+
+/**
+ * Get OpenCL C 3.0 optional feature macros.
+ *
+ * @returns feature macro names.
+ */
+std::vector<std::string> get_openclc_optional_features();
 } // namespace cassian
 
 #endif
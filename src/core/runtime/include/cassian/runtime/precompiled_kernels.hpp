@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_RUNTIME_PRECOMPILED_KERNELS_HPP
+#define CASSIAN_RUNTIME_PRECOMPILED_KERNELS_HPP
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Cassian namespace.
+ */
+namespace cassian {
+
+/**
+ * Bundle of native program binaries compiled ahead of time.
+ *
+ * Bundles are generated at build time by cassian_target_precompile_kernels.
+ * Index file lists one entry per line, fields are separated by tabs: device IP
+ * version in decimal, source path, binary path and build options. Paths are
+ * relative to the index file. Build options are compared after
+ * normalize_build_options, so quoting and spacing of options passed to CMake
+ * do not have to match options built at runtime.
+ */
+class PrecompiledKernels {
+public:
+  /**
+   * Construct a bundle from an index file.
+   *
+   * @param[in] index_path path to index file.
+   * @throws cassian::RuntimeException Thrown if index can't be read.
+   */
+  explicit PrecompiledKernels(const std::string &index_path);
+
+  /**
+   * Find binary.
+   *
+   * @param[in] ip_version device IP version.
+   * @param[in] source program source.
+   * @param[in] build_options build options.
+   * @returns binary or std::nullopt if bundle has no matching binary.
+   */
+  std::optional<std::vector<uint8_t>> find(int ip_version,
+                                           const std::string &source,
+                                           const std::string &build_options);
+
+  /**
+   * Number of entries in the bundle.
+   */
+  size_t size() const;
+
+  /**
+   * Check if bundles are looked up for a program.
+   *
+   * Bundle binaries are compiled from source text, which is carried by both
+   * "source" and "spirv" program types. Programs with SPIR-V options are
+   * built differently and are never looked up.
+   *
+   * @param[in] program_type program type.
+   * @param[in] spirv_options SPIR-V options.
+   * @returns true if bundles are looked up for the program.
+   */
+  static bool is_applicable(const std::string &program_type,
+                            const std::optional<std::string> &spirv_options);
+
+private:
+  struct Entry {
+    std::string device;
+    std::string source_path;
+    std::string binary_path;
+    std::string build_options;
+  };
+
+  std::vector<Entry> entries_;
+  std::unordered_map<std::string, std::string> sources_;
+};
+
+/**
+ * Normalize build options for comparison.
+ *
+ * Options are split on whitespace outside of double quotes and joined with
+ * single spaces. Options containing whitespace are quoted as a whole, quotes
+ * are removed from other options.
+ *
+ * @param[in] build_options build options.
+ * @returns normalized build options.
+ */
+std::string normalize_build_options(const std::string &build_options);
+
+} // namespace cassian
+
+#endif
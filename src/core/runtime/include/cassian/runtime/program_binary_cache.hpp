@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_RUNTIME_PROGRAM_BINARY_CACHE_HPP
+#define CASSIAN_RUNTIME_PROGRAM_BINARY_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Cassian namespace.
+ */
+namespace cassian {
+
+/**
+ * Persistent, content-addressed cache of native program binaries.
+ *
+ * Binaries are stored in a directory shared between processes. Each entry is
+ * addressed by a hash of its key and keeps the full key to detect collisions.
+ */
+class ProgramBinaryCache {
+public:
+  /**
+   * Construct a cache backed by a given directory.
+   *
+   * @param[in] directory cache directory, created if it does not exist.
+   * @throws cassian::RuntimeException Thrown if directory can't be created.
+   */
+  explicit ProgramBinaryCache(std::string directory);
+
+  ProgramBinaryCache(const ProgramBinaryCache &) = delete;
+  ProgramBinaryCache(ProgramBinaryCache &&) = delete;
+
+  /**
+   * Destructor. Logs cache statistics.
+   */
+  ~ProgramBinaryCache();
+
+  ProgramBinaryCache &operator=(const ProgramBinaryCache &) = delete;
+  ProgramBinaryCache &operator=(ProgramBinaryCache &&) = delete;
+
+  /**
+   * Load binary.
+   *
+   * @param[in] key cache key.
+   * @returns binary or std::nullopt if there is no entry for `key`.
+   */
+  std::optional<std::vector<uint8_t>> load(const std::string &key);
+
+  /**
+   * Store binary.
+   *
+   * Failures are logged and otherwise ignored.
+   *
+   * @param[in] key cache key.
+   * @param[in] binary binary to store.
+   */
+  void store(const std::string &key, const std::vector<uint8_t> &binary);
+
+  /**
+   * Number of successful loads.
+   */
+  size_t hits() const;
+
+  /**
+   * Number of failed loads.
+   */
+  size_t misses() const;
+
+private:
+  std::string directory_;
+  size_t hits_ = 0;
+  size_t misses_ = 0;
+
+  std::string entry_path(const std::string &key) const;
+};
+
+/**
+ * Build program binary cache key.
+ *
+ * @param[in] components values identifying a program, e.g. runtime, device,
+ * build options and source.
+ * @returns key unambiguously combining all components.
+ */
+std::string
+program_binary_cache_key(const std::vector<std::string> &components);
+
+} // namespace cassian
+
+#endif
@@ -26,6 +26,7 @@
 #include <cassian/runtime/device_properties.hpp>
 #include <cassian/runtime/feature.hpp>
 #include <cassian/runtime/image_properties.hpp>
+#include <cassian/runtime/memory_kind.hpp>
 #include <cassian/runtime/program_descriptor.hpp>
 #include <cassian/runtime/sampler_properties.hpp>
 
@@ -295,6 +296,112 @@ struct LocalMemory {
   size_t size = 0;
 };
 
+/**
+ * API agnostic representation of an event signaled by an enqueued command.
+ */
+struct Event {
+  /**
+   * Default constructor.
+   */
+  Event() = default;
+
+  /**
+   * Construct an event with a given device and id.
+   *
+   * @param[in] device device.
+   * @param[in] id event id.
+   */
+  Event(int device, std::uintptr_t id);
+
+  /**
+   * Copy constructor.
+   */
+  Event(const Event &) = default;
+
+  /**
+   * Move constructor.
+   */
+  Event(Event &&) = default;
+
+  /**
+   * Destructor.
+   */
+  ~Event() = default;
+
+  /**
+   * Copy assignment operator.
+   */
+  Event &operator=(const Event &) = default;
+
+  /**
+   * Move assignment operator.
+   */
+  Event &operator=(Event &&) = default;
+
+  /**
+   * Device on which the command was enqueued.
+   */
+  int device = 0;
+
+  /**
+   * API-specifc id for tracking purposes.
+   */
+  std::uintptr_t id = 0;
+};
+
+/**
+ * API agnostic representation of a recorded sequence of commands.
+ */
+struct CommandGraph {
+  /**
+   * Default constructor.
+   */
+  CommandGraph() = default;
+
+  /**
+   * Construct a command graph with a given device and id.
+   *
+   * @param[in] device device.
+   * @param[in] id command graph id.
+   */
+  CommandGraph(int device, std::uintptr_t id);
+
+  /**
+   * Copy constructor.
+   */
+  CommandGraph(const CommandGraph &) = default;
+
+  /**
+   * Move constructor.
+   */
+  CommandGraph(CommandGraph &&) = default;
+
+  /**
+   * Destructor.
+   */
+  ~CommandGraph() = default;
+
+  /**
+   * Copy assignment operator.
+   */
+  CommandGraph &operator=(const CommandGraph &) = default;
+
+  /**
+   * Move assignment operator.
+   */
+  CommandGraph &operator=(CommandGraph &&) = default;
+
+  /**
+   * Device on which the commands are executed.
+   */
+  int device = 0;
+
+  /**
+   * API-specifc id for tracking purposes.
+   */
+  std::uintptr_t id = 0;
+};
+
 /**
  * Abstract class representing API agnostic runtime.
  */
@@ -360,18 +467,33 @@ public:
    */
   virtual int get_subdevice_count(int root_device) = 0;
 
+  /**
+   * Get number of root devices available in the system.
+   *
+   * Only the first root device is used by the runtime, remaining devices can
+   * be selected by other processes, e.g. with ZE_AFFINITY_MASK. Default
+   * implementation reports a single root device.
+   *
+   * @returns root device count.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error.
+   */
+  virtual int get_root_device_count();
+
   /**
    * Create buffer.
    *
    * @param[in] size size in bytes.
    * @param[in] access access qualifier
+   * @param[in] memory_kind placement of buffer memory
    * @returns Buffer object.
    * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
    * error.
    */
   Buffer create_buffer(size_t size,
-                       AccessQualifier access = AccessQualifier::read_write) {
-    return create_buffer(0, size, access);
+                       AccessQualifier access = AccessQualifier::read_write,
+                       MemoryKind memory_kind = MemoryKind::device) {
+    return create_buffer(0, size, access, memory_kind);
   }
 
   /**
@@ -388,6 +510,22 @@ public:
   create_buffer(int device, size_t size,
                 AccessQualifier access = AccessQualifier::read_write) = 0;
 
+  /**
+   * Create buffer with a given memory placement for subdevice context.
+   *
+   * Default implementation supports MemoryKind::device only.
+   *
+   * @param[in] size size in bytes.
+   * @param[in] subdevice_index index of subdevice
+   * @param[in] access access qualifier
+   * @param[in] memory_kind placement of buffer memory
+   * @returns Buffer object.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error or `memory_kind` is not supported.
+   */
+  virtual Buffer create_buffer(int device, size_t size, AccessQualifier access,
+                               MemoryKind memory_kind);
+
   /**
    * Create image.
    *
@@ -485,6 +623,90 @@ public:
    */
   virtual void write_image(const Image &image, const void *data) = 0;
 
+  /**
+   * Enqueue read data from buffer.
+   *
+   * Non-blocking buffer read. Commands enqueued on the same device using
+   * the same buffer are executed in order. Default implementation reads the
+   * buffer with read_buffer and returns an already completed event.
+   *
+   * @param[in] buffer buffer to read.
+   * @param[out] data read data.
+   * @returns Event signaled when data has been read.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error.
+   * @note data must point to a memory region greater or equal to buffer size
+   * and must stay valid until the event completes.
+   */
+  virtual Event enqueue_read_buffer(const Buffer &buffer, void *data);
+
+  /**
+   * Enqueue write data to buffer.
+   *
+   * Non-blocking buffer write. Commands enqueued on the same device using
+   * the same buffer are executed in order. Default implementation writes the
+   * buffer with write_buffer and returns an already completed event.
+   *
+   * @param[in] buffer buffer to write.
+   * @param[in] data data to write.
+   * @returns Event signaled when data has been written.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error.
+   * @note Data must point to a memory region not greater than buffer size and
+   * must stay valid until the event completes.
+   */
+  virtual Event enqueue_write_buffer(const Buffer &buffer, const void *data);
+
+  /**
+   * Wait for events to complete.
+   *
+   * @param[in] events events to wait for.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error.
+   * @note After waiting, events must not be used anymore. Waiting for an event
+   * which has already been released by finish() has no effect.
+   */
+  virtual void wait(const std::vector<Event> &events);
+
+  /**
+   * Wait for all commands enqueued on a device to complete and release their
+   * events.
+   *
+   * @param[in] device device id.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error.
+   */
+  virtual void finish(int device);
+
+  /**
+   * Map buffer to host memory.
+   *
+   * Waits for commands enqueued on the buffer's device. Buffers created with
+   * MemoryKind::host or MemoryKind::shared are accessed in place, otherwise
+   * data is copied to a host staging area.
+   *
+   * @param[in] buffer buffer to map.
+   * @param[in] access host access, write_only skips reading buffer contents.
+   * @returns pointer to buffer data of buffer size.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error or does not support mapping, which is the default.
+   * @note Buffer must not be used by kernels or copies until it is unmapped.
+   */
+  virtual void *
+  map_buffer(const Buffer &buffer,
+             AccessQualifier access = AccessQualifier::read_write);
+
+  /**
+   * Unmap buffer mapped with map_buffer.
+   *
+   * @param[in] buffer buffer to unmap.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error or does not support mapping, which is the default.
+   * @note After unmapping, pointer returned by map_buffer must not be used
+   * anymore.
+   */
+  virtual void unmap_buffer(const Buffer &buffer);
+
   /**
    * Release buffer.
    *
@@ -493,9 +715,19 @@ public:
    * error.
    * @note After releasing, buffer must not be used anymore.
    * @note Buffer must not be in use when calling this function.
+   * @note Mapped buffer is unmapped before it is released.
    */
   virtual void release_buffer(const Buffer &buffer) = 0;
 
+  /**
+   * Free idle buffers kept for reuse by create_buffer. Default implementation
+   * does nothing.
+   *
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error.
+   */
+  virtual void trim_buffer_pool();
+
   /**
    * Release image.
    *
@@ -553,6 +785,8 @@ public:
    * @returns Kernel object.
    * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
    * error.
+   * @note Program built for a kernel may be shared with other kernels created
+   * from the same source and options. Kernel arguments are never shared.
    */
   virtual Kernel
   create_kernel(const std::string &kernel_name, const std::string &source,
@@ -867,6 +1101,235 @@ public:
     run_kernel_common(device, kernel, {global_work_size, 1, 1}, &local_ws);
   }
 
+  /**
+   * Enqueue kernel with 3D global work size.
+   *
+   * Non-blocking kernel run. Commands enqueued on the same device using the
+   * same buffer are executed in order.
+   *
+   * @param[in] kernel kernel to run.
+   * @param[in] global_work_size global work size.
+   * @returns Event signaled when kernel has finished.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error.
+   */
+  Event enqueue_run_kernel(const Kernel &kernel,
+                           const std::array<size_t, 3> global_work_size) {
+    return enqueue_run_kernel_common(0, kernel, global_work_size);
+  }
+
+  /**
+   * Enqueue kernel with 3D global and local work size.
+   *
+   * @param[in] kernel kernel to run.
+   * @param[in] global_work_size global work size.
+   * @param[in] local_work_size local work size.
+   * @returns Event signaled when kernel has finished.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error.
+   */
+  Event enqueue_run_kernel(const Kernel &kernel,
+                           std::array<size_t, 3> global_work_size,
+                           std::array<size_t, 3> local_work_size) {
+    return enqueue_run_kernel_common(0, kernel, global_work_size,
+                                     &local_work_size);
+  }
+
+  /**
+   * Enqueue kernel with 3D global work size.
+   *
+   * @param[in] device device id.
+   * @param[in] kernel kernel to run.
+   * @param[in] global_work_size global work size.
+   * @returns Event signaled when kernel has finished.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error.
+   */
+  Event enqueue_run_kernel(int device, const Kernel &kernel,
+                           const std::array<size_t, 3> global_work_size) {
+    return enqueue_run_kernel_common(device, kernel, global_work_size,
+                                     /*local_work_size=*/nullptr);
+  }
+
+  /**
+   * Enqueue kernel with 3D global and local work size.
+   *
+   * @param[in] device device id.
+   * @param[in] kernel kernel to run.
+   * @param[in] global_work_size global work size.
+   * @param[in] local_work_size local work size.
+   * @returns Event signaled when kernel has finished.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error.
+   */
+  Event enqueue_run_kernel(int device, const Kernel &kernel,
+                           std::array<size_t, 3> global_work_size,
+                           std::array<size_t, 3> local_work_size) {
+    return enqueue_run_kernel_common(device, kernel, global_work_size,
+                                     &local_work_size);
+  }
+
+  /**
+   * Enqueue kernel with 1D global work size.
+   *
+   * @overload
+   */
+  Event enqueue_run_kernel(const Kernel &kernel,
+                           const size_t global_work_size) {
+    return enqueue_run_kernel_common(0, kernel, {global_work_size, 1, 1});
+  }
+
+  /**
+   * Enqueue kernel with 1D global and local work size.
+   *
+   * @overload
+   */
+  Event enqueue_run_kernel(const Kernel &kernel, const size_t global_work_size,
+                           const size_t local_work_size) {
+    std::array<size_t, 3> local_ws = {local_work_size, 1, 1};
+    return enqueue_run_kernel_common(0, kernel, {global_work_size, 1, 1},
+                                     &local_ws);
+  }
+
+  /**
+   * Enqueue kernel with 1D global work size.
+   *
+   * @overload
+   */
+  Event enqueue_run_kernel(int device, const Kernel &kernel,
+                           const size_t global_work_size) {
+    return enqueue_run_kernel_common(device, kernel, {global_work_size, 1, 1},
+                                     /*local_work_size=*/nullptr);
+  }
+
+  /**
+   * Enqueue kernel with 1D global and local work size.
+   *
+   * @overload
+   */
+  Event enqueue_run_kernel(int device, const Kernel &kernel,
+                           const size_t global_work_size,
+                           const size_t local_work_size) {
+    std::array<size_t, 3> local_ws = {local_work_size, 1, 1};
+    return enqueue_run_kernel_common(device, kernel, {global_work_size, 1, 1},
+                                     &local_ws);
+  }
+
+  /**
+   * Create empty command graph.
+   *
+   * Commands appended to a graph are recorded once and executed in append
+   * order on each run_command_graph() call.
+   *
+   * @param[in] device device id.
+   * @returns Created command graph.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error or does not support command graphs, which is the default.
+   */
+  virtual CommandGraph create_command_graph(int device = 0);
+
+  /**
+   * Append write data to buffer to command graph.
+   *
+   * @param[in] graph command graph.
+   * @param[in] buffer buffer to write.
+   * @param[in] data data to write.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error.
+   * @note Data pointer is recorded, not its contents. Each run writes current
+   * contents of data, so it must stay valid until the graph is released.
+   */
+  virtual void append_write_buffer(const CommandGraph &graph,
+                                   const Buffer &buffer, const void *data);
+
+  /**
+   * Append read data from buffer to command graph.
+   *
+   * @param[in] graph command graph.
+   * @param[in] buffer buffer to read.
+   * @param[out] data read data.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error.
+   * @note Data must point to a memory region greater or equal to buffer size
+   * and must stay valid until the graph is released.
+   */
+  virtual void append_read_buffer(const CommandGraph &graph,
+                                  const Buffer &buffer, void *data);
+
+  /**
+   * Append kernel run with 1D global work size to command graph.
+   *
+   * @param[in] graph command graph.
+   * @param[in] kernel kernel to run.
+   * @param[in] global_work_size global work size.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error.
+   * @note Kernel arguments are captured when appending. Changing them
+   * afterwards does not affect the graph.
+   */
+  void append_run_kernel(const CommandGraph &graph, const Kernel &kernel,
+                         const size_t global_work_size) {
+    append_run_kernel_common(graph, kernel, {global_work_size, 1, 1});
+  }
+
+  /**
+   * Append kernel run with 1D global and local work size to command graph.
+   *
+   * @overload
+   */
+  void append_run_kernel(const CommandGraph &graph, const Kernel &kernel,
+                         const size_t global_work_size,
+                         const size_t local_work_size) {
+    std::array<size_t, 3> local_ws = {local_work_size, 1, 1};
+    append_run_kernel_common(graph, kernel, {global_work_size, 1, 1},
+                             &local_ws);
+  }
+
+  /**
+   * Append kernel run with 3D global work size to command graph.
+   *
+   * @overload
+   */
+  void append_run_kernel(const CommandGraph &graph, const Kernel &kernel,
+                         const std::array<size_t, 3> global_work_size) {
+    append_run_kernel_common(graph, kernel, global_work_size);
+  }
+
+  /**
+   * Append kernel run with 3D global and local work size to command graph.
+   *
+   * @overload
+   */
+  void append_run_kernel(const CommandGraph &graph, const Kernel &kernel,
+                         const std::array<size_t, 3> global_work_size,
+                         const std::array<size_t, 3> local_work_size) {
+    append_run_kernel_common(graph, kernel, global_work_size,
+                             &local_work_size);
+  }
+
+  /**
+   * Run all commands recorded in command graph.
+   *
+   * Blocking run. Commands previously enqueued on the graph's device are
+   * finished first. The graph is closed on the first run and no more commands
+   * can be appended.
+   *
+   * @param[in] graph command graph to run.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error.
+   */
+  virtual void run_command_graph(const CommandGraph &graph);
+
+  /**
+   * Release command graph.
+   *
+   * @param[in] graph command graph to release.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error.
+   * @note After releasing, graph must not be used anymore.
+   */
+  virtual void release_command_graph(const CommandGraph &graph);
+
   /**
    * Release kernel.
    *
@@ -875,11 +1338,13 @@ public:
    * error.
    * @note After releasing, kernel must not be used anymore.
    * @note Kernel must not be in use when calling this function.
+   * @note Program of released kernel may be kept alive and reused by a
+   * following create_kernel call, see RuntimeCaches::set_kernel_cache_capacity.
    */
   virtual void release_kernel(const Kernel &kernel) = 0;
 
   /**
-   * Check if a given feature is supported.
+   * Check if a given feature is supported by root device 0.
    *
    * @param[in] feature feature to check.
    * @returns true if feature is supported.
@@ -889,7 +1354,7 @@ public:
   virtual bool is_feature_supported(Feature feature) const = 0;
 
   /**
-   * Get device property.
+   * Get property of root device 0.
    *
    * @param[in] property property to read.
    * @returns value of a given property.
@@ -1001,6 +1466,38 @@ protected:
   run_kernel_common(int device, const Kernel &kernel,
                     std::array<size_t, 3> global_work_size,
                     const std::array<size_t, 3> *local_work_size = nullptr) = 0;
+
+  /**
+   * Enqueue kernel with 3D global and local work size.
+   *
+   * @param[in] device device id.
+   * @param[in] kernel kernel to run.
+   * @param[in] global_work_size global work size.
+   * @param[in] local_work_size local work size.
+   * @returns Event signaled when kernel has finished.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error.
+   * @note Default implementation runs kernel with run_kernel_common and
+   * returns an already completed event.
+   */
+  virtual Event enqueue_run_kernel_common(
+      int device, const Kernel &kernel, std::array<size_t, 3> global_work_size,
+      const std::array<size_t, 3> *local_work_size = nullptr);
+
+  /**
+   * Append kernel run with 3D global and local work size to command graph.
+   *
+   * @param[in] graph command graph.
+   * @param[in] kernel kernel to run.
+   * @param[in] global_work_size global work size.
+   * @param[in] local_work_size local work size.
+   * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+   * error or does not support command graphs, which is the default.
+   */
+  virtual void append_run_kernel_common(
+      const CommandGraph &graph, const Kernel &kernel,
+      std::array<size_t, 3> global_work_size,
+      const std::array<size_t, 3> *local_work_size = nullptr);
 };
 
 template <typename T>
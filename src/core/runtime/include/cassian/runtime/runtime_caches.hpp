@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_RUNTIME_RUNTIME_CACHES_HPP
+#define CASSIAN_RUNTIME_RUNTIME_CACHES_HPP
+
+#include <cassian/runtime/buffer_pool.hpp>
+#include <cassian/runtime/kernel_cache.hpp>
+#include <cassian/runtime/precompiled_kernels.hpp>
+#include <cassian/runtime/program_binary_cache.hpp>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+/**
+ * Cassian namespace.
+ */
+namespace cassian {
+
+/**
+ * Caches of compiled programs, buffers and feature probes.
+ *
+ * Mixin for Runtime implementations. Runtimes deriving from it are configured
+ * by create_runtime and have feature probes memoized, other runtimes work
+ * without caching.
+ */
+class RuntimeCaches {
+public:
+  /**
+   * Default constructor.
+   */
+  RuntimeCaches() = default;
+
+  /**
+   * Copy constructor.
+   */
+  RuntimeCaches(const RuntimeCaches &) = delete;
+
+  /**
+   * Move constructor.
+   */
+  RuntimeCaches(RuntimeCaches &&) = delete;
+
+  /**
+   * Destructor.
+   */
+  virtual ~RuntimeCaches() = default;
+
+  /**
+   * Copy assignment operator.
+   */
+  RuntimeCaches &operator=(const RuntimeCaches &) = delete;
+
+  /**
+   * Move assignment operator.
+   */
+  RuntimeCaches &operator=(RuntimeCaches &&) = delete;
+
+  /**
+   * Set persistent cache of native program binaries used by create_kernel.
+   *
+   * @param[in] cache cache to use or nullptr to disable caching.
+   */
+  void set_program_binary_cache(std::shared_ptr<ProgramBinaryCache> cache) {
+    program_binary_cache_ = std::move(cache);
+  }
+
+  /**
+   * Set bundle of native program binaries compiled ahead of time, looked up
+   * by create_kernel before compiling programs of type "source" or "spirv"
+   * without SPIR-V options.
+   *
+   * @param[in] precompiled_kernels bundle to use or nullptr to disable.
+   */
+  void set_precompiled_kernels(
+      std::shared_ptr<PrecompiledKernels> precompiled_kernels) {
+    precompiled_kernels_ = std::move(precompiled_kernels);
+  }
+
+  /**
+   * Set maximum number of programs without kernels kept for reuse by
+   * create_kernel.
+   *
+   * @param[in] capacity maximum number of idle programs, 0 frees programs
+   * when their last kernel is released.
+   */
+  void set_kernel_cache_capacity(size_t capacity) {
+    kernel_cache_.set_capacity(capacity);
+  }
+
+  /**
+   * Set maximum size of released buffers kept for reuse by create_buffer.
+   *
+   * @param[in] limit maximum size of idle buffers in bytes, 0 disables reuse.
+   */
+  void set_buffer_pool_limit(size_t limit) { buffer_pool_.set_limit(limit); }
+
+  /**
+   * Get statistics of buffers reused by create_buffer.
+   *
+   * @returns buffer pool statistics.
+   */
+  BufferPoolStatistics get_buffer_pool_statistics() const {
+    return buffer_pool_.get_statistics();
+  }
+
+  /**
+   * Get memoized result of a language feature probe.
+   *
+   * @param[in] probe probe identifier.
+   * @returns probe result or std::nullopt if probe has not been run.
+   */
+  std::optional<bool> get_feature_probe(const std::string &probe) const {
+    const auto it = feature_probes_.find(probe);
+    if (it == feature_probes_.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
+  /**
+   * Memoize result of a language feature probe.
+   *
+   * @param[in] probe probe identifier.
+   * @param[in] supported probe result.
+   */
+  void set_feature_probe(const std::string &probe, bool supported) {
+    feature_probes_[probe] = supported;
+  }
+
+protected:
+  /**
+   * Persistent cache of native program binaries, if enabled.
+   */
+  std::shared_ptr<ProgramBinaryCache> program_binary_cache_ = nullptr;
+
+  /**
+   * Native program binaries compiled ahead of time, if available.
+   */
+  std::shared_ptr<PrecompiledKernels> precompiled_kernels_ = nullptr;
+
+  /**
+   * Programs shared by kernels created with create_kernel.
+   */
+  KernelCache kernel_cache_;
+
+  /**
+   * Released buffers kept for reuse by create_buffer.
+   */
+  BufferPool buffer_pool_;
+
+  /**
+   * Memoized language feature probes.
+   */
+  std::map<std::string, bool> feature_probes_;
+};
+
+} // namespace cassian
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <algorithm>
+#include <cassian/runtime/access_qualifier.hpp>
+#include <cassian/runtime/buffer_pool.hpp>
+#include <cassian/runtime/memory_kind.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace cassian {
+
+BufferPool::BufferPool(size_t limit) : limit_(limit) {}
+
+std::optional<std::uintptr_t> BufferPool::acquire(int device, size_t size,
+                                                  AccessQualifier access,
+                                                  MemoryKind memory_kind) {
+  const Key key = {device, memory_kind, access, size};
+  const auto buffer = idle_buffers_.take(key);
+  if (!buffer.has_value()) {
+    return std::nullopt;
+  }
+  statistics_.idle_bytes -= key.size;
+  statistics_.pool_allocations++;
+  return buffer;
+}
+
+void BufferPool::insert(std::uintptr_t buffer, int device, size_t size,
+                        AccessQualifier access, MemoryKind memory_kind) {
+  keys_[buffer] = {device, memory_kind, access, size};
+  statistics_.driver_allocations++;
+}
+
+std::vector<std::uintptr_t> BufferPool::release(std::uintptr_t buffer) {
+  const Key key = keys_.at(buffer);
+  if (idle_buffers_.contains(buffer)) {
+    return {};
+  }
+  if (key.size > limit_) {
+    keys_.erase(buffer);
+    return {buffer};
+  }
+
+  idle_buffers_.push(key, buffer);
+  statistics_.idle_bytes += key.size;
+
+  std::vector<std::uintptr_t> evicted;
+  while (statistics_.idle_bytes > limit_) {
+    const auto [oldest_key, oldest] = idle_buffers_.take_oldest().value();
+    statistics_.idle_bytes -= oldest_key.size;
+    keys_.erase(oldest);
+    evicted.push_back(oldest);
+  }
+  statistics_.peak_idle_bytes =
+      std::max(statistics_.peak_idle_bytes, statistics_.idle_bytes);
+  return evicted;
+}
+
+void BufferPool::set_limit(size_t limit) { limit_ = limit; }
+
+std::vector<std::uintptr_t> BufferPool::trim() {
+  std::vector<std::uintptr_t> buffers = idle_buffers_.take_all();
+  for (const auto buffer : buffers) {
+    keys_.erase(buffer);
+  }
+  statistics_.idle_bytes = 0;
+  return buffers;
+}
+
+BufferPoolStatistics BufferPool::get_statistics() const { return statistics_; }
+
+} // namespace cassian
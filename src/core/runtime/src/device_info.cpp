@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cassian/runtime/device_info.hpp>
+#include <cassian/runtime/device_properties.hpp>
+#include <cassian/runtime/feature.hpp>
+#include <cassian/runtime/runtime.hpp>
+#include <cstddef>
+#include <functional>
+
+namespace cassian {
+
+DeviceInfo
+DeviceInfo::query(const std::function<int(DeviceProperty)> &query_property,
+                  const std::function<bool(Feature)> &query_feature) {
+  DeviceInfo info;
+  for (size_t i = 0; i < property_count; i++) {
+    try {
+      info.properties_[i] = query_property(static_cast<DeviceProperty>(i));
+    } catch (const RuntimeException &e) {
+      info.property_errors_[i] = e.what();
+    }
+  }
+  for (size_t i = 0; i < feature_count; i++) {
+    try {
+      info.features_[i] = query_feature(static_cast<Feature>(i));
+    } catch (const RuntimeException &e) {
+      info.feature_errors_[i] = e.what();
+    }
+  }
+  return info;
+}
+
+int DeviceInfo::get_device_property(DeviceProperty property) const {
+  const auto i = static_cast<size_t>(property);
+  if (i >= property_count) {
+    throw RuntimeException("Failed to find device property");
+  }
+  if (!property_errors_[i].empty()) {
+    throw RuntimeException(property_errors_[i]);
+  }
+  return properties_[i];
+}
+
+bool DeviceInfo::is_feature_supported(Feature feature) const {
+  const auto i = static_cast<size_t>(feature);
+  if (i >= feature_count) {
+    return false;
+  }
+  if (!feature_errors_[i].empty()) {
+    throw RuntimeException(feature_errors_[i]);
+  }
+  return features_[i];
+}
+
+} // namespace cassian
@@ -6,8 +6,15 @@
  */
 
 #include <cassian/cli/cli.hpp>
+#include <cassian/offline_compiler/spirv_cache.hpp>
+#include <cassian/runtime/buffer_pool.hpp>
 #include <cassian/runtime/factory.hpp>
+#include <cassian/runtime/kernel_cache.hpp>
+#include <cassian/runtime/precompiled_kernels.hpp>
+#include <cassian/runtime/program_binary_cache.hpp>
 #include <cassian/runtime/runtime.hpp>
+#include <cassian/runtime/runtime_caches.hpp>
+#include <cassian/utility/utility.hpp>
 #include <memory>
 #include <string>
 
@@ -20,7 +27,50 @@
 #endif
 
 namespace cassian {
-std::unique_ptr<Runtime> create_runtime(const std::string &name) {
+
+namespace {
+
+#ifdef BUILD_OCL
+class OpenCLQueueModeConverter {
+public:
+  explicit OpenCLQueueModeConverter(const std::string &mode) {
+    if (mode == "in-order") {
+      mode_ = OpenCLQueueMode::in_order;
+    } else if (mode == "out-of-order") {
+      mode_ = OpenCLQueueMode::out_of_order;
+    } else {
+      throw RuntimeException("Unknown OpenCL queue mode: " + mode);
+    }
+  }
+  OpenCLQueueMode mode() const { return mode_; }
+
+private:
+  OpenCLQueueMode mode_;
+};
+#endif
+
+#ifdef BUILD_L0
+class LevelZeroCommandListModeConverter {
+public:
+  explicit LevelZeroCommandListModeConverter(const std::string &mode) {
+    if (mode == "pooled") {
+      mode_ = LevelZeroCommandListMode::pooled;
+    } else if (mode == "immediate") {
+      mode_ = LevelZeroCommandListMode::immediate;
+    } else {
+      throw RuntimeException("Unknown Level Zero command list mode: " + mode);
+    }
+  }
+  LevelZeroCommandListMode mode() const { return mode_; }
+
+private:
+  LevelZeroCommandListMode mode_;
+};
+#endif
+
+std::unique_ptr<Runtime>
+create_runtime(const std::string &name,
+               [[maybe_unused]] const CommandLineParser *parser) {
   auto runtime_extra = create_runtime_extra(name);
   if (runtime_extra != nullptr) {
     return runtime_extra;
@@ -28,19 +78,86 @@ std::unique_ptr<Runtime> create_runtime(const std::string &name) {
 
 #ifdef BUILD_OCL
   if (name == "ocl") {
-    return std::make_unique<OpenCLRuntime>();
+    if (parser == nullptr) {
+      return std::make_unique<OpenCLRuntime>();
+    }
+    const auto mode =
+        parser->get<OpenCLQueueModeConverter>("--ocl-queue-mode").mode();
+    return std::make_unique<OpenCLRuntime>(mode);
   }
 #endif
 
 #ifdef BUILD_L0
   if (name == "l0") {
-    return std::make_unique<LevelZeroRuntime>();
+    if (parser == nullptr) {
+      return std::make_unique<LevelZeroRuntime>();
+    }
+    const auto mode_converter = parser->get<LevelZeroCommandListModeConverter>(
+        "--l0-command-list-mode");
+    const bool use_copy_engine = parser->get_bool("--l0-copy-engine");
+    return std::make_unique<LevelZeroRuntime>(mode_converter.mode(),
+                                              use_copy_engine);
   }
 #endif
 
   throw UnknownRuntimeException("Unknown runtime name: " + name);
 }
 
+std::shared_ptr<PrecompiledKernels>
+create_precompiled_kernels(const std::string &index_path) {
+  if (index_path == "off") {
+    return nullptr;
+  }
+  if (!index_path.empty()) {
+    return std::make_shared<PrecompiledKernels>(index_path);
+  }
+
+  // Bundles are installed per executable, see cassian_target_precompile_kernels
+  try {
+    const std::string application = get_application_path().stem().string();
+    return std::make_shared<PrecompiledKernels>(
+        get_asset("precompiled_kernels/" + application + "/index.txt"));
+  } catch (const PathNotFoundException &) {
+  } catch (const AssetNotFoundException &) {
+  }
+  return nullptr;
+}
+
+} // namespace
+
+std::unique_ptr<Runtime> create_runtime(const std::string &name) {
+  return create_runtime(name, nullptr);
+}
+
+std::unique_ptr<Runtime> create_runtime(const CommandLineParser &parser) {
+  auto runtime = create_runtime(parser.get<std::string>("--runtime"), &parser);
+
+  const auto kernel_cache_dir = parser.get<std::string>("--kernel-cache-dir");
+  if (!kernel_cache_dir.empty()) {
+    get_spirv_cache().set_directory(
+        (fs::path(kernel_cache_dir) / "spirv").string());
+  }
+
+  auto *caches = dynamic_cast<RuntimeCaches *>(runtime.get());
+  if (caches == nullptr) {
+    return runtime;
+  }
+
+  if (!kernel_cache_dir.empty()) {
+    caches->set_program_binary_cache(
+        std::make_shared<ProgramBinaryCache>(kernel_cache_dir));
+  }
+
+  caches->set_precompiled_kernels(create_precompiled_kernels(
+      parser.get<std::string>("--precompiled-kernels")));
+
+  caches->set_kernel_cache_capacity(parser.get_unsigned("--kernel-cache-size"));
+
+  caches->set_buffer_pool_limit(parser.get_unsigned("--buffer-pool-limit"));
+
+  return runtime;
+}
+
 void add_runtime_arguments(CommandLineParser *parser) {
 #ifdef BUILD_OCL
   const std::string default_runtime = "ocl";
@@ -52,6 +169,19 @@ void add_runtime_arguments(CommandLineParser *parser) {
 
   parser->add_argument("--runtime", default_runtime);
   parser->add_argument("--program-type", "source");
+  parser->add_argument("--kernel-cache-dir", "");
+  parser->add_argument("--precompiled-kernels", "");
+  parser->add_argument("--kernel-cache-size",
+                       std::to_string(KernelCache::default_capacity));
+  parser->add_argument("--buffer-pool-limit",
+                       std::to_string(BufferPool::default_limit));
+#ifdef BUILD_OCL
+  parser->add_argument("--ocl-queue-mode", "in-order");
+#endif
+#ifdef BUILD_L0
+  parser->add_argument("--l0-command-list-mode", "pooled");
+  parser->add_argument("--l0-copy-engine", "true");
+#endif
 }
 
 } // namespace cassian
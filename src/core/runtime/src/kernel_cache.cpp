@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cassian/runtime/kernel_cache.hpp>
+#include <cassian/runtime/program_binary_cache.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cassian {
+
+KernelCache::KernelCache(size_t capacity) : capacity_(capacity) {}
+
+std::optional<std::uintptr_t> KernelCache::acquire(const std::string &key) {
+  auto it = programs_.find(key);
+  if (it == programs_.end()) {
+    misses_++;
+    return std::nullopt;
+  }
+  const std::uintptr_t program = it->second;
+  auto &entry = entries_.at(program);
+  if (entry.references++ == 0) {
+    idle_programs_.erase(program);
+  }
+  hits_++;
+  return program;
+}
+
+void KernelCache::insert(const std::string &key, std::uintptr_t program) {
+  entries_[program] = {key, 1};
+  programs_[key] = program;
+}
+
+bool KernelCache::contains(std::uintptr_t program) const {
+  return entries_.count(program) != 0;
+}
+
+std::vector<std::uintptr_t> KernelCache::release(std::uintptr_t program) {
+  auto &entry = entries_.at(program);
+  if (entry.references == 0 || --entry.references != 0) {
+    return {};
+  }
+  idle_programs_.push(entry.key, program);
+
+  std::vector<std::uintptr_t> evicted;
+  while (idle_programs_.size() > capacity_) {
+    const std::uintptr_t oldest = idle_programs_.take_oldest()->second;
+    remove(oldest);
+    evicted.push_back(oldest);
+  }
+  return evicted;
+}
+
+void KernelCache::set_capacity(size_t capacity) { capacity_ = capacity; }
+
+std::vector<std::uintptr_t> KernelCache::clear() {
+  std::vector<std::uintptr_t> programs;
+  programs.reserve(entries_.size());
+  for (const auto &entry : entries_) {
+    programs.push_back(entry.first);
+  }
+  entries_.clear();
+  programs_.clear();
+  idle_programs_.take_all();
+  return programs;
+}
+
+size_t KernelCache::hits() const { return hits_; }
+
+size_t KernelCache::misses() const { return misses_; }
+
+void KernelCache::remove(std::uintptr_t program) {
+  auto it = entries_.find(program);
+  auto key_it = programs_.find(it->second.key);
+  if (key_it != programs_.end() && key_it->second == program) {
+    programs_.erase(key_it);
+  }
+  entries_.erase(it);
+}
+
+std::string kernel_cache_key(const std::string &source,
+                             const std::string &build_options,
+                             const std::string &program_type,
+                             const std::optional<std::string> &spirv_options) {
+  return program_binary_cache_key(
+      {source, build_options, program_type,
+       spirv_options.has_value() ? "1" + spirv_options.value() : "0"});
+}
+
+} // namespace cassian
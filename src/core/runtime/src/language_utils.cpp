@@ -9,6 +9,11 @@
 #include <cassian/offline_compiler/offline_compiler.hpp>
 #include <cassian/runtime/cm_utils.hpp>
 #include <cassian/runtime/openclc_utils.hpp>
+#include <cassian/runtime/runtime_caches.hpp>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
 
 namespace cassian {
 namespace {
@@ -28,11 +33,34 @@ bool check_kernel_compilation(Runtime *runtime, const std::string &kernel_name,
   }
   return true;
 }
+
+std::optional<bool> get_feature_probe(Runtime *runtime,
+                                      const std::string &probe) {
+  const auto *caches = dynamic_cast<RuntimeCaches *>(runtime);
+  if (caches == nullptr) {
+    return std::nullopt;
+  }
+  return caches->get_feature_probe(probe);
+}
+
+void set_feature_probe(Runtime *runtime, const std::string &probe,
+                       bool supported) {
+  auto *caches = dynamic_cast<RuntimeCaches *>(runtime);
+  if (caches != nullptr) {
+    caches->set_feature_probe(probe, supported);
+  }
+}
 } // namespace
 
 bool check_optional_openclc_macro(Runtime *runtime,
                                   const std::string &program_type,
                                   const std::string &if_clause) {
+  const std::string probe = "openclc:" + program_type + ":#if " + if_clause;
+  const auto memoized = get_feature_probe(runtime, probe);
+  if (memoized.has_value()) {
+    return memoized.value();
+  }
+
   std::string source = "#if " + if_clause +
                        "\n"
                        "#error \"Feature unsupported\"\n"
@@ -42,12 +70,19 @@ bool check_optional_openclc_macro(Runtime *runtime,
   bool is_supported = check_kernel_compilation(runtime, "test", source,
                                                " -cl-std=CL3.0", program_type);
 
+  set_feature_probe(runtime, probe, is_supported);
   return is_supported;
 }
 
 bool check_optional_openclc_feature_support(Runtime *runtime,
                                             const std::string &program_type,
                                             const std::string &feature_macro) {
+  const std::string probe = "openclc:" + program_type + ":" + feature_macro;
+  const auto memoized = get_feature_probe(runtime, probe);
+  if (memoized.has_value()) {
+    return memoized.value();
+  }
+
   std::stringstream ss;
   ss << "!defined(" << feature_macro << ")";
 
@@ -57,12 +92,19 @@ bool check_optional_openclc_feature_support(Runtime *runtime,
   if (!is_supported) {
     logging::info() << feature_macro << " unsupported\n";
   }
+  set_feature_probe(runtime, probe, is_supported);
   return is_supported;
 }
 
 bool check_optional_cm_feature_support(Runtime *runtime,
                                        const std::string &program_type,
                                        const std::string &feature_macro) {
+  const std::string probe = "cm:" + program_type + ":" + feature_macro;
+  const auto memoized = get_feature_probe(runtime, probe);
+  if (memoized.has_value()) {
+    return memoized.value();
+  }
+
   std::string source = "#include <cm/cm.h>\n"
                        "#ifndef " +
                        feature_macro +
@@ -78,7 +120,28 @@ bool check_optional_cm_feature_support(Runtime *runtime,
     logging::info() << feature_macro << " unsupported\n";
   }
 
+  set_feature_probe(runtime, probe, is_supported);
   return is_supported;
 }
 
+std::vector<std::string> get_openclc_optional_features() {
+  return {"__opencl_c_3d_image_writes",
+          "__opencl_c_atomic_order_acq_rel",
+          "__opencl_c_atomic_order_seq_cst",
+          "__opencl_c_atomic_scope_device",
+          "__opencl_c_atomic_scope_all_devices",
+          "__opencl_c_device_enqueue",
+          "__opencl_c_generic_address_space",
+          "__opencl_c_fp64",
+          "__opencl_c_images",
+          "__opencl_c_int64",
+          "__opencl_c_integer_dot_product_input_4x8bit",
+          "__opencl_c_integer_dot_product_input_4x8bit_packed",
+          "__opencl_c_pipes",
+          "__opencl_c_program_scope_global_variables",
+          "__opencl_c_read_write_images",
+          "__opencl_c_subgroups",
+          "__opencl_c_work_group_collective_functions"};
+}
+
 } // namespace cassian
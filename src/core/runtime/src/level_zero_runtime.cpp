@@ -8,7 +8,10 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
+#include <future>
 #include <iterator>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -19,10 +22,16 @@
 #include <cassian/logging/logging.hpp>
 #include <cassian/offline_compiler/offline_compiler.hpp>
 #include <cassian/runtime/access_qualifier.hpp>
+#include <cassian/runtime/device_info.hpp>
 #include <cassian/runtime/device_properties.hpp>
 #include <cassian/runtime/feature.hpp>
 #include <cassian/runtime/image_properties.hpp>
+#include <cassian/runtime/kernel_cache.hpp>
 #include <cassian/runtime/level_zero_utils.hpp>
+#include <cassian/runtime/mapped_buffers.hpp>
+#include <cassian/runtime/memory_kind.hpp>
+#include <cassian/runtime/precompiled_kernels.hpp>
+#include <cassian/runtime/program_binary_cache.hpp>
 #include <cassian/runtime/program_descriptor.hpp>
 #include <cassian/runtime/runtime.hpp>
 #include <cassian/utility/utility.hpp>
@@ -31,12 +40,80 @@
 #include "level_zero_wrapper.hpp"
 
 namespace cassian {
+LevelZeroRuntime::LevelZeroRuntime(LevelZeroCommandListMode command_list_mode,
+                                   bool use_copy_engine)
+    : command_list_mode_(command_list_mode), use_copy_engine_(use_copy_engine) {
+}
+
 LevelZeroRuntime::~LevelZeroRuntime() {
+  for (size_t i = 0; i < pending_events_.size(); i++) {
+    const auto device = static_cast<int>(i);
+    for (const auto engine : {compute_engine, copy_engine}) {
+      const auto &pending_events = pending_events_[device][engine];
+      if (!pending_events.empty()) {
+        wrapper_.zeCommandQueueSynchronize(ze_get_queue(device, engine),
+                                           UINT64_MAX);
+      }
+      for (const auto &pending : pending_events) {
+        wrapper_.zeEventDestroy(pending.event);
+        ze_release_command_list(device, engine, pending.command_list);
+      }
+    }
+    for (const auto &completed : completed_events_[device]) {
+      wrapper_.zeEventDestroy(completed.event);
+    }
+  }
+  pending_events_.clear();
+  completed_events_.clear();
+  // Queues are idle, so cached modules and idle buffers can be freed. Kernels
+  // must be destroyed before their modules.
+  for (const auto &[id, module] : kernel_cached_modules_) {
+    try {
+      ze_release_kernel(id);
+    } catch (const RuntimeException &) {
+    }
+  }
+  for (const auto id : kernel_cache_.clear()) {
+    wrapper_.zeModuleDestroy(cached_modules_.at(id));
+  }
+  for (const auto id : buffer_pool_.trim()) {
+    try {
+      ze_free_buffer(id);
+    } catch (const RuntimeException &) {
+    }
+  }
+  for (const auto &[id, recorded] : command_graphs_) {
+    wrapper_.zeCommandListDestroy(recorded.command_list);
+  }
+  for (ze_event_pool_handle_t event_pool : event_pools_) {
+    if (event_pool != nullptr) {
+      wrapper_.zeEventPoolDestroy(event_pool);
+    }
+  }
+  for (const auto &pools : command_list_pools_) {
+    for (const auto &pool : pools) {
+      for (ze_command_list_handle_t command_list : pool) {
+        wrapper_.zeCommandListDestroy(command_list);
+      }
+    }
+  }
+  for (const auto &command_lists : immediate_command_lists_) {
+    for (ze_command_list_handle_t command_list : command_lists) {
+      if (command_list != nullptr) {
+        wrapper_.zeCommandListDestroy(command_list);
+      }
+    }
+  }
   for (ze_command_queue_handle_t queue : queues_) {
     if (queue != nullptr) {
       wrapper_.zeCommandQueueDestroy(queue);
     }
   }
+  for (ze_command_queue_handle_t queue : copy_queues_) {
+    if (queue != nullptr) {
+      wrapper_.zeCommandQueueDestroy(queue);
+    }
+  }
   for (ze_context_handle_t context : contexts_) {
     if (context != nullptr) {
       wrapper_.zeContextDestroy(context);
@@ -100,22 +177,23 @@ void LevelZeroRuntime::initialize() {
     throw RuntimeException("Failed to create Level Zero context");
   }
 
-  ze_command_queue_desc_t command_queue_description = {};
-  command_queue_description.stype = ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC;
-  command_queue_description.pNext = nullptr;
-  command_queue_description.ordinal = 0;
-  command_queue_description.index = 0;
-  command_queue_description.flags = 0;
-  command_queue_description.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
-  command_queue_description.priority = ZE_COMMAND_QUEUE_PRIORITY_NORMAL;
-
-  queues_.resize(1);
-  result = wrapper_.zeCommandQueueCreate(
-      contexts_[0], devices_[0], &command_queue_description, &queues_[0]);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to create Level Zero command queue");
-  }
+  queues_.resize(1, nullptr);
+  copy_queues_.resize(1, nullptr);
+  queue_group_ordinals_.resize(1);
+  ze_create_command_queues(0);
   root_devices_count_ = devices_.size();
+
+  event_pools_.resize(devices_.size(), nullptr);
+  free_event_indices_.resize(devices_.size());
+  pending_events_.resize(devices_.size());
+  completed_events_.resize(devices_.size());
+
+  device_info_ = DeviceInfo::query(
+      [this](DeviceProperty property) {
+        return ze_query_device_property(property);
+      },
+      [this](Feature feature) { return ze_query_feature(feature); });
+  device_identity_ = ze_get_device_identity();
 }
 
 void LevelZeroRuntime::initialize_subdevices() {
@@ -141,22 +219,19 @@ void LevelZeroRuntime::initialize_subdevices() {
     }
 
     contexts_.resize(contexts_.size() + num_subdevices);
-    queues_.resize(queues_.size() + num_subdevices);
+    queues_.resize(devices_.size(), nullptr);
+    copy_queues_.resize(devices_.size(), nullptr);
+    queue_group_ordinals_.resize(devices_.size());
+    event_pools_.resize(devices_.size(), nullptr);
+    free_event_indices_.resize(devices_.size());
+    pending_events_.resize(devices_.size());
+    completed_events_.resize(devices_.size());
 
     ze_context_desc_t context_description = {};
     context_description.stype = ZE_STRUCTURE_TYPE_CONTEXT_DESC;
     context_description.pNext = nullptr;
     context_description.flags = 0;
 
-    ze_command_queue_desc_t command_queue_description = {};
-    command_queue_description.stype = ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC;
-    command_queue_description.pNext = nullptr;
-    command_queue_description.ordinal = 0;
-    command_queue_description.index = 0;
-    command_queue_description.flags = 0;
-    command_queue_description.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
-    command_queue_description.priority = ZE_COMMAND_QUEUE_PRIORITY_NORMAL;
-
     for (int j = 0; j < num_subdevices; j++) {
       result = wrapper_.zeContextCreate(driver_, &context_description,
                                         &contexts_[subdevice_offsets_[i] + j]);
@@ -166,15 +241,7 @@ void LevelZeroRuntime::initialize_subdevices() {
                                (subdevice_offsets_[i] + j));
       }
 
-      result = wrapper_.zeCommandQueueCreate(
-          contexts_[subdevice_offsets_[i] + j],
-          devices_[subdevice_offsets_[i] + j], &command_queue_description,
-          &queues_[subdevice_offsets_[i] + j]);
-      if (result != ZE_RESULT_SUCCESS) {
-        throw RuntimeException("Failed to create Level Zero command queue for "
-                               "tile number: " +
-                               (subdevice_offsets_[i] + j));
-      }
+      ze_create_command_queues(subdevice_offsets_[i] + j);
     }
   }
 }
@@ -199,12 +266,32 @@ int LevelZeroRuntime::get_subdevice_count(int root_device) {
   return subdevice_count;
 }
 
+int LevelZeroRuntime::get_root_device_count() {
+  uint32_t num_devices = 0;
+  ze_result_t result = wrapper_.zeDeviceGet(driver_, &num_devices, nullptr);
+  if (result != ZE_RESULT_SUCCESS) {
+    throw RuntimeException("Failed to get number of Level Zero devices");
+  }
+  return static_cast<int>(num_devices);
+}
+
+Buffer LevelZeroRuntime::create_buffer(int device, const size_t size,
+                                       AccessQualifier access) {
+  return create_buffer(device, size, access, MemoryKind::device);
+}
+
 Buffer LevelZeroRuntime::create_buffer(int device, const size_t size,
-                                       AccessQualifier /*access*/) {
+                                       AccessQualifier access,
+                                       MemoryKind memory_kind) {
   if (device < 0 || device >= devices_.size()) {
     throw RuntimeException("Invalid device");
   }
 
+  if (const auto pooled =
+          buffer_pool_.acquire(device, size, access, memory_kind)) {
+    return {device, *pooled, size};
+  }
+
   ze_device_mem_alloc_desc_t device_memory_allocation_description = {};
   device_memory_allocation_description.stype =
       ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
@@ -212,12 +299,33 @@ Buffer LevelZeroRuntime::create_buffer(int device, const size_t size,
   device_memory_allocation_description.flags = 0;
   device_memory_allocation_description.ordinal = 0;
 
+  ze_host_mem_alloc_desc_t host_memory_allocation_description = {};
+  host_memory_allocation_description.stype =
+      ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC;
+  host_memory_allocation_description.pNext = nullptr;
+  host_memory_allocation_description.flags = 0;
+
   void *buffer = nullptr;
   ze_result_t result = ZE_RESULT_SUCCESS;
 
-  result = wrapper_.zeMemAllocDevice(contexts_[device],
-                                     &device_memory_allocation_description,
-                                     size, 1, devices_[device], &buffer);
+  switch (memory_kind) {
+  case MemoryKind::device:
+    result = wrapper_.zeMemAllocDevice(contexts_[device],
+                                       &device_memory_allocation_description,
+                                       size, 1, devices_[device], &buffer);
+    break;
+  case MemoryKind::host:
+    result = wrapper_.zeMemAllocHost(contexts_[device],
+                                     &host_memory_allocation_description,
+                                     size, 1, &buffer);
+    break;
+  case MemoryKind::shared:
+    result = wrapper_.zeMemAllocShared(
+        contexts_[device], &device_memory_allocation_description,
+        &host_memory_allocation_description, size, 1, devices_[device],
+        &buffer);
+    break;
+  }
 
   if (result != ZE_RESULT_SUCCESS) {
     throw RuntimeException("Failed to allocate Level Zero memory");
@@ -225,6 +333,8 @@ Buffer LevelZeroRuntime::create_buffer(int device, const size_t size,
 
   auto id = reinterpret_cast<std::uintptr_t>(buffer);
   buffers_[id] = buffer;
+  buffer_memory_kinds_[id] = memory_kind;
+  buffer_pool_.insert(id, device, size, access, memory_kind);
 
   return {device, id, size};
 }
@@ -361,67 +471,17 @@ Sampler LevelZeroRuntime::create_sampler(SamplerCoordinates coordinates,
 }
 
 void LevelZeroRuntime::read_buffer(const Buffer &buffer, void *data) {
-  void *b = buffers_.at(buffer.id);
-
-  ze_command_list_desc_t command_list_description = {};
-  command_list_description.stype = ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC;
-  command_list_description.pNext = nullptr;
-  command_list_description.commandQueueGroupOrdinal = 0;
-  command_list_description.flags = 0;
-
-  ze_command_list_handle_t command_list = nullptr;
-  ze_result_t result = wrapper_.zeCommandListCreate(
-      contexts_[buffer.device], devices_[buffer.device],
-      &command_list_description, &command_list);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to create Level Zero command list");
-  }
-
-  result = wrapper_.zeCommandListAppendMemoryCopy(
-      command_list, data, b, buffer.size, nullptr, 0, nullptr);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException(
-        "Failed to append memory copy to Level Zero command list");
-  }
-
-  result = wrapper_.zeCommandListClose(command_list);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to close Level Zero command list");
-  }
-
-  result = wrapper_.zeCommandQueueExecuteCommandLists(queues_[buffer.device], 1,
-                                                      &command_list, nullptr);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to execute Level Zero command list");
-  }
-
-  result =
-      wrapper_.zeCommandQueueSynchronize(queues_[buffer.device], UINT64_MAX);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to synchronize Level Zero command queue");
-  }
-
-  result = wrapper_.zeCommandListDestroy(command_list);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to destroy Level Zero command list");
-  }
+  // Waits only for enqueued commands using the same buffer
+  wait({enqueue_read_buffer(buffer, data)});
 }
 
 void LevelZeroRuntime::read_image(const Image &image, void *data) {
   ze_image_handle_t src_image = images_.at(image.id);
 
-  ze_command_list_desc_t command_list_description = {};
-  command_list_description.stype = ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC;
-  command_list_description.pNext = nullptr;
-  command_list_description.commandQueueGroupOrdinal = 0;
-  command_list_description.flags = 0;
+  const Engine engine = ze_get_transfer_engine(0);
+  ze_command_list_handle_t command_list = ze_acquire_command_list(0, engine);
+  auto f = finally([&]() { ze_release_command_list(0, engine, command_list); });
 
-  ze_command_list_handle_t command_list = nullptr;
-  ze_result_t result = wrapper_.zeCommandListCreate(
-      contexts_[0], devices_[0], &command_list_description, &command_list);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to create Level Zero command list");
-  }
   ze_image_region_t region = {};
   region.width = image.dim.width;
   region.height = image.dim.height;
@@ -429,92 +489,28 @@ void LevelZeroRuntime::read_image(const Image &image, void *data) {
   region.originX = 0;
   region.originY = 0;
   region.originZ = 0;
-  result = wrapper_.zeCommandListAppendImageCopyToMemory(
+  ze_result_t result = wrapper_.zeCommandListAppendImageCopyToMemory(
       command_list, data, src_image, &region, nullptr, 0, nullptr);
   if (result != ZE_RESULT_SUCCESS) {
     throw RuntimeException(
         "Failed to append image copy to Level Zero command list");
   }
-  result = wrapper_.zeCommandListClose(command_list);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to close Level Zero command list");
-  }
-  result = wrapper_.zeCommandQueueExecuteCommandLists(queues_[0], 1,
-                                                      &command_list, nullptr);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to execute Level Zero command list");
-  }
-  result = wrapper_.zeCommandQueueSynchronize(queues_[0], UINT64_MAX);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to synchronize Level Zero command queue");
-  }
 
-  result = wrapper_.zeCommandListDestroy(command_list);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to destroy Level Zero command list");
-  }
+  ze_execute_command_list(0, engine, command_list);
 }
 
 void LevelZeroRuntime::write_buffer(const Buffer &buffer, const void *data) {
-  void *b = buffers_.at(buffer.id);
-
-  ze_command_list_desc_t command_list_description = {};
-  command_list_description.stype = ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC;
-  command_list_description.pNext = nullptr;
-  command_list_description.commandQueueGroupOrdinal = 0;
-  command_list_description.flags = 0;
-
-  ze_command_list_handle_t command_list = nullptr;
-  ze_result_t result = wrapper_.zeCommandListCreate(
-      contexts_[0], devices_[0], &command_list_description, &command_list);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to create Level Zero command list");
-  }
-
-  result = wrapper_.zeCommandListAppendMemoryCopy(
-      command_list, b, data, buffer.size, nullptr, 0, nullptr);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException(
-        "Failed to append memory copy to Level Zero command list");
-  }
-
-  result = wrapper_.zeCommandListClose(command_list);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to close Level Zero command list");
-  }
-
-  result = wrapper_.zeCommandQueueExecuteCommandLists(queues_[0], 1,
-                                                      &command_list, nullptr);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to execute Level Zero command list");
-  }
-
-  result = wrapper_.zeCommandQueueSynchronize(queues_[0], UINT64_MAX);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to synchronize Level Zero command queue");
-  }
-
-  result = wrapper_.zeCommandListDestroy(command_list);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to destroy Level Zero command list");
-  }
+  // Waits only for enqueued commands using the same buffer
+  wait({enqueue_write_buffer(buffer, data)});
 }
 
 void LevelZeroRuntime::write_image(const Image &image, const void *data) {
   ze_image_handle_t dst_image = images_.at(image.id);
 
-  ze_command_list_desc_t command_list_description = {};
-  command_list_description.stype = ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC;
-  command_list_description.pNext = nullptr;
-  command_list_description.commandQueueGroupOrdinal = 0;
-  command_list_description.flags = 0;
+  const Engine engine = ze_get_transfer_engine(0);
+  ze_command_list_handle_t command_list = ze_acquire_command_list(0, engine);
+  auto f = finally([&]() { ze_release_command_list(0, engine, command_list); });
 
-  ze_command_list_handle_t command_list = nullptr;
-  ze_result_t result = wrapper_.zeCommandListCreate(
-      contexts_[0], devices_[0], &command_list_description, &command_list);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to create Level Zero command list");
-  }
   ze_image_region_t region = {};
   region.width = image.dim.width;
   region.height = image.dim.height;
@@ -522,35 +518,152 @@ void LevelZeroRuntime::write_image(const Image &image, const void *data) {
   region.originX = 0;
   region.originY = 0;
   region.originZ = 0;
-  result = wrapper_.zeCommandListAppendImageCopyFromMemory(
+  ze_result_t result = wrapper_.zeCommandListAppendImageCopyFromMemory(
       command_list, dst_image, data, &region, nullptr, 0, nullptr);
   if (result != ZE_RESULT_SUCCESS) {
     throw RuntimeException(
         "Failed to append image copy to Level Zero command list");
   }
-  result = wrapper_.zeCommandListClose(command_list);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to close Level Zero command list");
+
+  ze_execute_command_list(0, engine, command_list);
+}
+
+Event LevelZeroRuntime::enqueue_read_buffer(const Buffer &buffer,
+                                            void *data) {
+  void *b = buffers_.at(buffer.id);
+  return ze_enqueue_commands(
+      buffer.device, ze_get_transfer_engine(buffer.device), {buffer.id},
+      [&](ze_command_list_handle_t command_list, ze_event_handle_t signal_event,
+          uint32_t num_wait_events, ze_event_handle_t *wait_events) {
+        ze_result_t result = wrapper_.zeCommandListAppendMemoryCopy(
+            command_list, data, b, buffer.size, signal_event, num_wait_events,
+            wait_events);
+        if (result != ZE_RESULT_SUCCESS) {
+          throw RuntimeException(
+              "Failed to append memory copy to Level Zero command list");
+        }
+      });
+}
+
+Event LevelZeroRuntime::enqueue_write_buffer(const Buffer &buffer,
+                                             const void *data) {
+  void *b = buffers_.at(buffer.id);
+  return ze_enqueue_commands(
+      buffer.device, ze_get_transfer_engine(buffer.device), {buffer.id},
+      [&](ze_command_list_handle_t command_list, ze_event_handle_t signal_event,
+          uint32_t num_wait_events, ze_event_handle_t *wait_events) {
+        ze_result_t result = wrapper_.zeCommandListAppendMemoryCopy(
+            command_list, b, data, buffer.size, signal_event, num_wait_events,
+            wait_events);
+        if (result != ZE_RESULT_SUCCESS) {
+          throw RuntimeException(
+              "Failed to append memory copy to Level Zero command list");
+        }
+      });
+}
+
+void LevelZeroRuntime::wait(const std::vector<Event> &events) {
+  for (const auto &event : events) {
+    if (event.device < 0 || event.device >= devices_.size()) {
+      throw RuntimeException("Invalid device");
+    }
+
+    for (const auto engine : {compute_engine, copy_engine}) {
+      auto &pending_events = pending_events_[event.device][engine];
+      auto it = std::find_if(
+          std::begin(pending_events), std::end(pending_events),
+          [&](const PendingEvent &pending) { return pending.id == event.id; });
+      if (it == std::end(pending_events)) {
+        continue;
+      }
+
+      ze_result_t result =
+          wrapper_.zeEventHostSynchronize(it->event, UINT64_MAX);
+      if (result != ZE_RESULT_SUCCESS) {
+        throw RuntimeException("Failed to synchronize Level Zero event");
+      }
+
+      // Commands on an engine complete in order, so all preceding events are
+      // done as well. An event is kept alive while a later command may still
+      // wait on it.
+      auto completed = std::distance(std::begin(pending_events), it);
+      if (std::next(it) == std::end(pending_events)) {
+        completed++;
+      }
+      ze_retire_events(event.device, engine, completed);
+      break;
+    }
   }
-  result = wrapper_.zeCommandQueueExecuteCommandLists(queues_[0], 1,
-                                                      &command_list, nullptr);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to execute Level Zero command list");
+}
+
+void LevelZeroRuntime::finish(int device) {
+  if (device < 0 || device >= devices_.size()) {
+    throw RuntimeException("Invalid device");
   }
-  result = wrapper_.zeCommandQueueSynchronize(queues_[0], UINT64_MAX);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to synchronize Level Zero command queue");
+
+  for (const auto engine : {compute_engine, copy_engine}) {
+    auto &pending_events = pending_events_[device][engine];
+    if (pending_events.empty()) {
+      continue;
+    }
+
+    ze_result_t result = wrapper_.zeEventHostSynchronize(
+        pending_events.back().event, UINT64_MAX);
+    if (result != ZE_RESULT_SUCCESS) {
+      throw RuntimeException("Failed to synchronize Level Zero event");
+    }
+    ze_retire_events(device, engine, pending_events.size());
   }
 
-  result = wrapper_.zeCommandListDestroy(command_list);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to destroy Level Zero command list");
+  // Both engines are idle, so no command waits on completed events anymore
+  for (const auto &completed : completed_events_[device]) {
+    ze_destroy_event(device, completed.event, completed.index);
   }
+  completed_events_[device].clear();
 }
 
-void LevelZeroRuntime::release_buffer(const Buffer &buffer) {
+void *LevelZeroRuntime::map_buffer(const Buffer &buffer,
+                                   AccessQualifier access) {
   void *b = buffers_.at(buffer.id);
-  buffers_.erase(buffer.id);
+  finish(buffer.device);
+  return mapped_buffers_.map(
+      buffer.id, buffer.size, buffer_memory_kinds_.at(buffer.id), b, access,
+      [&](void *data) { read_buffer(buffer, data); });
+}
+
+void LevelZeroRuntime::unmap_buffer(const Buffer &buffer) {
+  mapped_buffers_.unmap(buffer.id, [&](const void *data) {
+    write_buffer(buffer, data);
+  });
+}
+
+void LevelZeroRuntime::release_buffer(const Buffer &buffer) {
+  // Staging copy of a buffer released while mapped is written back, as if it
+  // had been unmapped first
+  unmap_buffer(buffer);
+  for (const auto id : buffer_pool_.release(buffer.id)) {
+    ze_free_buffer(id);
+  }
+}
+
+void LevelZeroRuntime::trim_buffer_pool() {
+  for (const auto id : buffer_pool_.trim()) {
+    ze_free_buffer(id);
+  }
+}
+
+void LevelZeroRuntime::ze_free_buffer(std::uintptr_t id) {
+  void *b = buffers_.at(id);
+  // Last command using the buffer may still be running
+  auto it = buffer_events_.find(id);
+  if (it != buffer_events_.end()) {
+    for (size_t device = 0; device < pending_events_.size(); device++) {
+      wait({{static_cast<int>(device), it->second}});
+    }
+  }
+  buffers_.erase(id);
+  buffer_memory_kinds_.erase(id);
+  buffer_events_.erase(id);
 
   ze_result_t result = wrapper_.zeMemFree(contexts_[0], b);
   if (result != ZE_RESULT_SUCCESS) {
@@ -580,7 +693,25 @@ ze_module_handle_t LevelZeroRuntime::ze_create_module(
     const std::string &source, const std::string &build_options,
     const std::string &program_type,
     const std::optional<std::string> &spirv_options, bool quiet) {
-  ze_result_t result = ZE_RESULT_SUCCESS;
+  if (program_type == "source") {
+    throw RuntimeException(
+        "Compilation from source is not supported by Level Zero");
+  }
+
+  if (program_type != "spirv") {
+    throw RuntimeException("Invalid program type: " + program_type);
+  }
+
+  static const auto ip_version =
+      get_device_property(DeviceProperty::ip_version);
+  const std::vector<uint8_t> spv =
+      generate_spirv_from_source(ip_version, source, build_options, quiet);
+  return ze_create_module_from_spirv(spv, build_options, spirv_options, quiet);
+}
+
+ze_module_handle_t LevelZeroRuntime::ze_create_module_from_spirv(
+    const std::vector<uint8_t> &spv, const std::string &build_options,
+    const std::optional<std::string> &spirv_options, bool quiet) {
   ze_module_handle_t module = nullptr;
   ze_module_build_log_handle_t build_log_handle = nullptr;
   auto f = finally([&]() mutable {
@@ -589,48 +720,33 @@ ze_module_handle_t LevelZeroRuntime::ze_create_module(
     }
   });
 
-  if (program_type == "source") {
-    throw RuntimeException(
-        "Compilation from source is not supported by Level Zero");
+  ze_module_desc_t module_description = {};
+  module_description.stype = ZE_STRUCTURE_TYPE_MODULE_DESC;
+  module_description.pNext = nullptr;
+  module_description.format = ZE_MODULE_FORMAT_IL_SPIRV;
+  module_description.inputSize = static_cast<uint32_t>(spv.size());
+  module_description.pInputModule = spv.data();
+
+  if (spirv_options.has_value()) {
+    module_description.pBuildFlags = spirv_options->c_str();
+  } else if (build_options.find("-cmc") == 0) {
+    module_description.pBuildFlags = "-vc-codegen";
+  } else {
+    module_description.pBuildFlags = build_options.c_str();
   }
 
-  if (program_type == "spirv") {
-    static const auto ip_version =
-        get_device_property(DeviceProperty::ip_version);
+  module_description.pConstants = nullptr;
 
-    const std::vector<uint8_t> spv =
-        generate_spirv_from_source(ip_version, source, build_options, quiet);
-
-    ze_module_desc_t module_description = {};
-    module_description.stype = ZE_STRUCTURE_TYPE_MODULE_DESC;
-    module_description.pNext = nullptr;
-    module_description.format = ZE_MODULE_FORMAT_IL_SPIRV;
-    module_description.inputSize = static_cast<uint32_t>(spv.size());
-    module_description.pInputModule = spv.data();
-
-    if (spirv_options.has_value()) {
-      module_description.pBuildFlags = spirv_options->c_str();
-    } else if (build_options.find("-cmc") == 0) {
-      module_description.pBuildFlags = "-vc-codegen";
-    } else {
-      module_description.pBuildFlags = build_options.c_str();
+  ze_result_t result =
+      wrapper_.zeModuleCreate(contexts_[0], devices_[0], &module_description,
+                              &module, &build_log_handle);
+  if (result != ZE_RESULT_SUCCESS) {
+    if (!quiet) {
+      const auto build_log = ze_get_module_build_log(build_log_handle);
+      logging::error() << "Build log:\n" << build_log << '\n';
     }
 
-    module_description.pConstants = nullptr;
-
-    result =
-        wrapper_.zeModuleCreate(contexts_[0], devices_[0], &module_description,
-                                &module, &build_log_handle);
-    if (result != ZE_RESULT_SUCCESS) {
-      if (!quiet) {
-        const auto build_log = ze_get_module_build_log(build_log_handle);
-        logging::error() << "Build log:\n" << build_log << '\n';
-      }
-
-      throw RuntimeException("Failed to create Level Zero module");
-    }
-  } else {
-    throw RuntimeException("Invalid program type: " + program_type);
+    throw RuntimeException("Failed to create Level Zero module");
   }
 
   return module;
@@ -640,11 +756,19 @@ Kernel LevelZeroRuntime::create_kernel(
     const std::string &kernel_name, const std::string &source,
     const std::string &build_options, const std::string &program_type,
     const std::optional<std::string> &spirv_options, bool quiet) {
-  ze_result_t result = ZE_RESULT_SUCCESS;
-  logging::debug() << "Build options: " << build_options << '\n';
-  logging::debug() << "SPIR-V options: " << spirv_options.value_or("") << '\n';
-  ze_module_handle_t module = ze_create_module(
-      source, build_options, program_type, spirv_options, quiet);
+  const auto module_key =
+      kernel_cache_key(source, build_options, program_type, spirv_options);
+  std::uintptr_t module_id = 0;
+  const auto cached_module = kernel_cache_.acquire(module_key);
+  if (cached_module.has_value()) {
+    module_id = cached_module.value();
+  } else {
+    ze_module_handle_t module = ze_build_module(
+        source, build_options, program_type, spirv_options, quiet);
+    module_id = reinterpret_cast<std::uintptr_t>(module);
+    cached_modules_[module_id] = module;
+    kernel_cache_.insert(module_key, module_id);
+  }
 
   ze_kernel_desc_t kernel_description = {};
   kernel_description.stype = ZE_STRUCTURE_TYPE_KERNEL_DESC;
@@ -652,19 +776,61 @@ Kernel LevelZeroRuntime::create_kernel(
   kernel_description.pKernelName = kernel_name.c_str();
   kernel_description.flags = 0;
 
+  // Every kernel is a separate object, so arguments set by previous users of
+  // the module are never seen
   ze_kernel_handle_t kernel = nullptr;
-  result = wrapper_.zeKernelCreate(module, &kernel_description, &kernel);
+  ze_result_t result = wrapper_.zeKernelCreate(
+      cached_modules_.at(module_id), &kernel_description, &kernel);
   if (result != ZE_RESULT_SUCCESS) {
+    ze_release_cached_module(module_id);
     throw RuntimeException("Failed to create Level Zero kernel");
   }
 
   auto id = reinterpret_cast<std::uintptr_t>(kernel);
   kernels_[id] = kernel;
-  modules_.emplace(id, module);
+  kernel_cached_modules_[id] = module_id;
 
   return Kernel(id);
 }
 
+ze_module_handle_t LevelZeroRuntime::ze_build_module(
+    const std::string &source, const std::string &build_options,
+    const std::string &program_type,
+    const std::optional<std::string> &spirv_options, bool quiet) {
+  logging::debug() << "Build options: " << build_options << '\n';
+  logging::debug() << "SPIR-V options: " << spirv_options.value_or("") << '\n';
+  std::string cache_key;
+  ze_module_handle_t module = nullptr;
+  if (precompiled_kernels_ != nullptr &&
+      PrecompiledKernels::is_applicable(program_type, spirv_options)) {
+    const auto binary = precompiled_kernels_->find(
+        get_device_property(DeviceProperty::ip_version), source,
+        build_options);
+    if (binary.has_value()) {
+      module = ze_create_module_from_native_binary(binary.value());
+    }
+  }
+  if (module == nullptr && program_binary_cache_ != nullptr) {
+    cache_key = program_binary_cache_key(
+        {name(), device_identity_, program_type, build_options,
+         spirv_options.value_or(""), source});
+    const auto binary = program_binary_cache_->load(cache_key);
+    if (binary.has_value()) {
+      module = ze_create_module_from_native_binary(binary.value());
+    }
+  }
+  if (module == nullptr) {
+    module = ze_create_module(source, build_options, program_type,
+                              spirv_options, quiet);
+    if (program_binary_cache_ != nullptr) {
+      program_binary_cache_->store(cache_key,
+                                   ze_get_module_native_binary(module));
+    }
+  }
+
+  return module;
+}
+
 Kernel LevelZeroRuntime::create_kernel_from_multiple_programs(
     const std::string &kernel_name,
     const std::vector<ProgramDescriptor> &program_descriptors,
@@ -683,15 +849,31 @@ Kernel LevelZeroRuntime::create_kernel_from_multiple_programs(
     }
   });
 
-  std::transform(std::begin(program_descriptors), std::end(program_descriptors),
-                 std::back_inserter(modules), [this, quiet](const auto &desc) {
-                   return ze_create_module(desc.source, desc.compiler_options,
-                                           desc.program_type,
-                                           desc.spirv_options, quiet);
-                 });
-
-  result = wrapper_.zeModuleDynamicLink(modules.size(), modules.data(),
-                                        &link_log_handle);
+  // SPIR-V of all programs is generated on the offline compiler pool, so the
+  // driver creates a module while SPIR-V of the following ones is generated.
+  std::vector<SpirvCompileJob> jobs;
+  for (const auto &desc : program_descriptors) {
+    if (desc.program_type == "spirv") {
+      jobs.push_back({desc.source, desc.compiler_options});
+    }
+  }
+  auto spirv = generate_spirv_from_sources(
+      get_device_property(DeviceProperty::ip_version), jobs, quiet);
+  auto next_spirv = spirv.begin();
+  for (const auto &desc : program_descriptors) {
+    if (desc.program_type == "spirv") {
+      modules.push_back(ze_create_module_from_spirv(
+          (next_spirv++)->get(), desc.compiler_options, desc.spirv_options,
+          quiet));
+    } else {
+      modules.push_back(ze_create_module(desc.source, desc.compiler_options,
+                                         desc.program_type,
+                                         desc.spirv_options, quiet));
+    }
+  }
+
+  result = wrapper_.zeModuleDynamicLink(modules.size(), modules.data(),
+                                        &link_log_handle);
 
   if (result != ZE_RESULT_SUCCESS) {
     if (!quiet) {
@@ -750,6 +932,16 @@ std::vector<uint8_t> LevelZeroRuntime::create_program_and_get_native_binary(
   ze_module_handle_t module = ze_create_module(
       source, build_options, program_type, spirv_options, quiet);
 
+  auto program_bytes = ze_get_module_native_binary(module);
+  ze_result_t status = wrapper_.zeModuleDestroy(module);
+  if (status != ZE_RESULT_SUCCESS) {
+    throw RuntimeException("Failed to destroy module");
+  }
+  return program_bytes;
+}
+
+std::vector<uint8_t>
+LevelZeroRuntime::ze_get_module_native_binary(ze_module_handle_t module) const {
   size_t binary_size = 0;
   ze_result_t status = ZE_RESULT_SUCCESS;
   status = wrapper_.zeModuleGetNativeBinary(module, &binary_size, nullptr);
@@ -764,18 +956,61 @@ std::vector<uint8_t> LevelZeroRuntime::create_program_and_get_native_binary(
     throw RuntimeException("Failed to get pModuleNativeBinary using "
                            "zeModuleGetNativeBinary command");
   }
-  status = wrapper_.zeModuleDestroy(module);
-  if (status != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to destroy module");
-  }
   return program_bytes;
 }
 
+ze_module_handle_t LevelZeroRuntime::ze_create_module_from_native_binary(
+    const std::vector<uint8_t> &binary) {
+  ze_module_desc_t module_description = {};
+  module_description.stype = ZE_STRUCTURE_TYPE_MODULE_DESC;
+  module_description.pNext = nullptr;
+  module_description.format = ZE_MODULE_FORMAT_NATIVE;
+  module_description.inputSize = binary.size();
+  module_description.pInputModule = binary.data();
+  module_description.pBuildFlags = nullptr;
+  module_description.pConstants = nullptr;
+
+  ze_module_handle_t module = nullptr;
+  ze_result_t result = wrapper_.zeModuleCreate(
+      contexts_[0], devices_[0], &module_description, &module, nullptr);
+  if (result != ZE_RESULT_SUCCESS) {
+    // Stale cache entries, e.g. from a different driver, are rebuilt
+    logging::debug() << "Failed to create Level Zero module from binary\n";
+    return nullptr;
+  }
+  return module;
+}
+
+std::string LevelZeroRuntime::ze_get_device_identity() const {
+  ze_device_properties_t device_properties = {};
+  device_properties.stype = ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES;
+  device_properties.pNext = nullptr;
+  ze_result_t result =
+      wrapper_.zeDeviceGetProperties(devices_[0], &device_properties);
+  if (result != ZE_RESULT_SUCCESS) {
+    throw RuntimeException("Failed to get Level Zero device properties");
+  }
+
+  ze_driver_properties_t driver_properties = {};
+  driver_properties.stype = ZE_STRUCTURE_TYPE_DRIVER_PROPERTIES;
+  driver_properties.pNext = nullptr;
+  result = wrapper_.zeDriverGetProperties(driver_, &driver_properties);
+  if (result != ZE_RESULT_SUCCESS) {
+    throw RuntimeException("Failed to get Level Zero driver properties");
+  }
+
+  return std::string(device_properties.name) + ";" +
+         std::to_string(device_properties.deviceId) + ";" +
+         std::to_string(driver_properties.driverVersion) + ";" +
+         std::to_string(get_device_property(DeviceProperty::ip_version));
+}
+
 void LevelZeroRuntime::set_kernel_argument(const Kernel &kernel,
                                            const int argument_index,
                                            const Buffer &buffer) {
   void *b = buffers_.at(buffer.id);
   set_kernel_argument(kernel, argument_index, sizeof(b), &b);
+  kernel_buffers_[kernel.id][argument_index] = buffer.id;
 }
 
 void LevelZeroRuntime::set_kernel_argument(const Kernel &kernel,
@@ -802,6 +1037,11 @@ void LevelZeroRuntime::set_kernel_argument(const Kernel &kernel,
   if (result != ZE_RESULT_SUCCESS) {
     throw RuntimeException("Failed to set Level Zero kernel argument");
   }
+
+  auto it = kernel_buffers_.find(kernel.id);
+  if (it != kernel_buffers_.end()) {
+    it->second.erase(argument_index);
+  }
 }
 
 void LevelZeroRuntime::run_kernel_common(
@@ -812,22 +1052,59 @@ void LevelZeroRuntime::run_kernel_common(
     throw RuntimeException("Invalid device");
   }
 
-  ze_kernel_handle_t k = kernels_.at(kernel.id);
+  ze_command_list_handle_t command_list =
+      ze_acquire_command_list(device, compute_engine);
+  auto f = finally([&]() {
+    ze_release_command_list(device, compute_engine, command_list);
+  });
 
-  ze_command_list_desc_t command_list_description = {};
-  command_list_description.stype = ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC;
-  command_list_description.pNext = nullptr;
-  command_list_description.commandQueueGroupOrdinal = 0;
-  command_list_description.flags = 0;
+  ze_append_launch_kernel(command_list, kernel, global_work_size,
+                          local_work_size, nullptr, 0, nullptr);
 
-  ze_command_list_handle_t command_list = nullptr;
-  ze_result_t result =
-      wrapper_.zeCommandListCreate(contexts_[device], devices_[device],
-                                   &command_list_description, &command_list);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to create Level Zero command list");
+  ze_execute_command_list(device, compute_engine, command_list);
+}
+
+Event LevelZeroRuntime::enqueue_run_kernel_common(
+    int device, const Kernel &kernel,
+    const std::array<size_t, 3> global_work_size,
+    const std::array<size_t, 3> *local_work_size) {
+  std::vector<std::uintptr_t> buffers;
+  auto it = kernel_buffers_.find(kernel.id);
+  if (it != kernel_buffers_.end()) {
+    for (const auto &[argument_index, buffer] : it->second) {
+      buffers.push_back(buffer);
+    }
   }
 
+  return ze_enqueue_commands(
+      device, compute_engine, buffers,
+      [&](ze_command_list_handle_t command_list, ze_event_handle_t signal_event,
+          uint32_t num_wait_events, ze_event_handle_t *wait_events) {
+        ze_append_launch_kernel(command_list, kernel, global_work_size,
+                                local_work_size, signal_event, num_wait_events,
+                                wait_events);
+      });
+}
+
+void LevelZeroRuntime::append_run_kernel_common(
+    const CommandGraph &graph, const Kernel &kernel,
+    const std::array<size_t, 3> global_work_size,
+    const std::array<size_t, 3> *local_work_size) {
+  ze_append_to_graph(graph, [&](ze_command_list_handle_t command_list) {
+    ze_append_launch_kernel(command_list, kernel, global_work_size,
+                            local_work_size, nullptr, 0, nullptr);
+  });
+}
+
+void LevelZeroRuntime::ze_append_launch_kernel(
+    ze_command_list_handle_t command_list, const Kernel &kernel,
+    const std::array<size_t, 3> global_work_size,
+    const std::array<size_t, 3> *local_work_size,
+    ze_event_handle_t signal_event, uint32_t num_wait_events,
+    ze_event_handle_t *wait_events) {
+  ze_kernel_handle_t k = kernels_.at(kernel.id);
+
+  ze_result_t result = ZE_RESULT_SUCCESS;
   ze_group_count_t thread_group_dimensions = {};
   std::array<uint32_t, 3> local_ws = {1, 1, 1};
   if (local_work_size == nullptr) {
@@ -872,44 +1149,46 @@ void LevelZeroRuntime::run_kernel_common(
                                                   : to_string(local_ws))
                    << '\n';
   result = wrapper_.zeCommandListAppendLaunchKernel(
-      command_list, k, &thread_group_dimensions, nullptr, 0, nullptr);
+      command_list, k, &thread_group_dimensions, signal_event, num_wait_events,
+      wait_events);
   if (result != ZE_RESULT_SUCCESS) {
     throw RuntimeException(
         "Failed to append kernel to Level Zero command list");
   }
+}
 
-  result = wrapper_.zeCommandListClose(command_list);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to close Level Zero command list");
-  }
-
-  result = wrapper_.zeCommandQueueExecuteCommandLists(queues_[device], 1,
-                                                      &command_list, nullptr);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to execute Level Zero command list");
-  }
-
-  result = wrapper_.zeCommandQueueSynchronize(queues_[device], UINT64_MAX);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to synchronize Level Zero command queue");
+void LevelZeroRuntime::release_kernel(const Kernel &kernel) {
+  ze_release_kernel(kernel.id);
+  auto it = kernel_cached_modules_.find(kernel.id);
+  if (it != kernel_cached_modules_.end()) {
+    const std::uintptr_t module = it->second;
+    kernel_cached_modules_.erase(it);
+    ze_release_cached_module(module);
   }
+}
 
-  result = wrapper_.zeCommandListDestroy(command_list);
-  if (result != ZE_RESULT_SUCCESS) {
-    throw RuntimeException("Failed to destroy Level Zero command list");
+void LevelZeroRuntime::ze_release_cached_module(std::uintptr_t id) {
+  for (const auto evicted : kernel_cache_.release(id)) {
+    ze_module_handle_t m = cached_modules_.at(evicted);
+    cached_modules_.erase(evicted);
+    ze_result_t result = wrapper_.zeModuleDestroy(m);
+    if (result != ZE_RESULT_SUCCESS) {
+      throw RuntimeException("Failed to release Level Zero module");
+    }
   }
 }
 
-void LevelZeroRuntime::release_kernel(const Kernel &kernel) {
-  ze_kernel_handle_t k = kernels_.at(kernel.id);
-  kernels_.erase(kernel.id);
+void LevelZeroRuntime::ze_release_kernel(std::uintptr_t id) {
+  ze_kernel_handle_t k = kernels_.at(id);
+  kernels_.erase(id);
+  kernel_buffers_.erase(id);
 
   ze_result_t result = wrapper_.zeKernelDestroy(k);
   if (result != ZE_RESULT_SUCCESS) {
     throw RuntimeException("Failed to release Level Zero kernel");
   }
 
-  auto modules_for_kernel = modules_.equal_range(kernel.id);
+  auto modules_for_kernel = modules_.equal_range(id);
   std::vector<std::pair<std::uintptr_t, ze_module_handle_t>> modules_to_destroy;
 
   auto is_module_in_use = [&](auto p) {
@@ -922,7 +1201,7 @@ void LevelZeroRuntime::release_kernel(const Kernel &kernel) {
   std::copy_if(modules_for_kernel.first, modules_for_kernel.second,
                std::back_inserter(modules_to_destroy), is_module_in_use);
 
-  modules_.erase(kernel.id);
+  modules_.erase(id);
 
   for (auto m : modules_to_destroy) {
     result = wrapper_.zeModuleDestroy(m.second);
@@ -932,7 +1211,112 @@ void LevelZeroRuntime::release_kernel(const Kernel &kernel) {
   }
 }
 
+CommandGraph LevelZeroRuntime::create_command_graph(int device) {
+  if (device < 0 || device >= devices_.size()) {
+    throw RuntimeException("Invalid device");
+  }
+
+  ze_command_list_desc_t command_list_description = {};
+  command_list_description.stype = ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC;
+  command_list_description.pNext = nullptr;
+  command_list_description.commandQueueGroupOrdinal =
+      queue_group_ordinals_[device][compute_engine];
+  command_list_description.flags = 0;
+
+  ze_command_list_handle_t command_list = nullptr;
+  ze_result_t result =
+      wrapper_.zeCommandListCreate(contexts_[device], devices_[device],
+                                   &command_list_description, &command_list);
+  if (result != ZE_RESULT_SUCCESS) {
+    throw RuntimeException("Failed to create Level Zero command list");
+  }
+
+  auto id = reinterpret_cast<std::uintptr_t>(command_list);
+  command_graphs_[id] = {command_list, false};
+  return {device, id};
+}
+
+void LevelZeroRuntime::append_write_buffer(const CommandGraph &graph,
+                                           const Buffer &buffer,
+                                           const void *data) {
+  void *b = buffers_.at(buffer.id);
+  ze_append_to_graph(graph, [&](ze_command_list_handle_t command_list) {
+    ze_result_t result = wrapper_.zeCommandListAppendMemoryCopy(
+        command_list, b, data, buffer.size, nullptr, 0, nullptr);
+    if (result != ZE_RESULT_SUCCESS) {
+      throw RuntimeException(
+          "Failed to append memory copy to Level Zero command list");
+    }
+  });
+}
+
+void LevelZeroRuntime::append_read_buffer(const CommandGraph &graph,
+                                          const Buffer &buffer, void *data) {
+  void *b = buffers_.at(buffer.id);
+  ze_append_to_graph(graph, [&](ze_command_list_handle_t command_list) {
+    ze_result_t result = wrapper_.zeCommandListAppendMemoryCopy(
+        command_list, data, b, buffer.size, nullptr, 0, nullptr);
+    if (result != ZE_RESULT_SUCCESS) {
+      throw RuntimeException(
+          "Failed to append memory copy to Level Zero command list");
+    }
+  });
+}
+
+void LevelZeroRuntime::run_command_graph(const CommandGraph &graph) {
+  auto &recorded = command_graphs_.at(graph.id);
+
+  ze_result_t result = ZE_RESULT_SUCCESS;
+  if (!recorded.closed) {
+    result = wrapper_.zeCommandListClose(recorded.command_list);
+    if (result != ZE_RESULT_SUCCESS) {
+      throw RuntimeException("Failed to close Level Zero command list");
+    }
+    recorded.closed = true;
+  }
+
+  // Keep graph commands ordered after previously enqueued ones
+  finish(graph.device);
+
+  ze_command_queue_handle_t queue = queues_[graph.device];
+  result = wrapper_.zeCommandQueueExecuteCommandLists(
+      queue, 1, &recorded.command_list, nullptr);
+  if (result != ZE_RESULT_SUCCESS) {
+    throw RuntimeException("Failed to execute Level Zero command list");
+  }
+
+  result = wrapper_.zeCommandQueueSynchronize(queue, UINT64_MAX);
+  if (result != ZE_RESULT_SUCCESS) {
+    throw RuntimeException("Failed to synchronize Level Zero command queue");
+  }
+}
+
+void LevelZeroRuntime::release_command_graph(const CommandGraph &graph) {
+  ze_command_list_handle_t command_list =
+      command_graphs_.at(graph.id).command_list;
+  command_graphs_.erase(graph.id);
+
+  ze_result_t result = wrapper_.zeCommandListDestroy(command_list);
+  if (result != ZE_RESULT_SUCCESS) {
+    throw RuntimeException("Failed to destroy Level Zero command list");
+  }
+}
+
 bool LevelZeroRuntime::is_feature_supported(const Feature feature) const {
+  if (device_info_.has_value()) {
+    return device_info_->is_feature_supported(feature);
+  }
+  return ze_query_feature(feature);
+}
+
+int LevelZeroRuntime::get_device_property(const DeviceProperty property) const {
+  if (device_info_.has_value()) {
+    return device_info_->get_device_property(property);
+  }
+  return ze_query_device_property(property);
+}
+
+bool LevelZeroRuntime::ze_query_feature(const Feature feature) const {
   ze_device_module_properties_t device_module_properties = {};
   device_module_properties.stype = ZE_STRUCTURE_TYPE_DEVICE_MODULE_PROPERTIES;
   device_module_properties.pNext = nullptr;
@@ -1082,7 +1466,8 @@ bool LevelZeroRuntime::is_feature_supported(const Feature feature) const {
   }
 }
 
-int LevelZeroRuntime::get_device_property(const DeviceProperty property) const {
+int LevelZeroRuntime::ze_query_device_property(
+    const DeviceProperty property) const {
   ze_device_ip_version_ext_t ip_version = {};
   ip_version.stype = ZE_STRUCTURE_TYPE_DEVICE_IP_VERSION_EXT;
   ip_version.pNext = nullptr;
@@ -1179,6 +1564,368 @@ int LevelZeroRuntime::get_device_property(const DeviceProperty property) const {
 
 std::string LevelZeroRuntime::name() const { return "L0"; }
 
+void LevelZeroRuntime::ze_create_command_queues(const int device) {
+  uint32_t num_groups = 0;
+  ze_result_t result = wrapper_.zeDeviceGetCommandQueueGroupProperties(
+      devices_[device], &num_groups, nullptr);
+  if (result != ZE_RESULT_SUCCESS) {
+    throw RuntimeException(
+        "Failed to get number of Level Zero command queue groups");
+  }
+
+  std::vector<ze_command_queue_group_properties_t> groups(num_groups);
+  for (auto &group : groups) {
+    group.stype = ZE_STRUCTURE_TYPE_COMMAND_QUEUE_GROUP_PROPERTIES;
+    group.pNext = nullptr;
+  }
+  result = wrapper_.zeDeviceGetCommandQueueGroupProperties(
+      devices_[device], &num_groups, groups.data());
+  if (result != ZE_RESULT_SUCCESS) {
+    throw RuntimeException(
+        "Failed to get Level Zero command queue group properties");
+  }
+
+  // Copy only groups are backed by blitter engines
+  std::optional<uint32_t> compute_ordinal;
+  std::optional<uint32_t> copy_ordinal;
+  for (uint32_t i = 0; i < num_groups; i++) {
+    const auto flags = groups[i].flags;
+    if ((flags & ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COMPUTE) != 0) {
+      if (!compute_ordinal.has_value()) {
+        compute_ordinal = i;
+      }
+    } else if ((flags & ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COPY) != 0) {
+      if (!copy_ordinal.has_value()) {
+        copy_ordinal = i;
+      }
+    }
+  }
+  if (!use_copy_engine_) {
+    copy_ordinal = std::nullopt;
+  }
+
+  auto &ordinals = queue_group_ordinals_[device];
+  ordinals[compute_engine] = compute_ordinal.value_or(0);
+  ordinals[copy_engine] = copy_ordinal.value_or(ordinals[compute_engine]);
+
+  ze_command_queue_desc_t command_queue_description = {};
+  command_queue_description.stype = ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC;
+  command_queue_description.pNext = nullptr;
+  command_queue_description.ordinal = ordinals[compute_engine];
+  command_queue_description.index = 0;
+  command_queue_description.flags = 0;
+  command_queue_description.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+  command_queue_description.priority = ZE_COMMAND_QUEUE_PRIORITY_NORMAL;
+
+  result = wrapper_.zeCommandQueueCreate(contexts_[device], devices_[device],
+                                         &command_queue_description,
+                                         &queues_[device]);
+  if (result != ZE_RESULT_SUCCESS) {
+    queues_[device] = nullptr;
+    throw RuntimeException("Failed to create Level Zero command queue");
+  }
+
+  if (!copy_ordinal.has_value()) {
+    return;
+  }
+  command_queue_description.ordinal = ordinals[copy_engine];
+  result = wrapper_.zeCommandQueueCreate(contexts_[device], devices_[device],
+                                         &command_queue_description,
+                                         &copy_queues_[device]);
+  if (result != ZE_RESULT_SUCCESS) {
+    copy_queues_[device] = nullptr;
+    throw RuntimeException("Failed to create Level Zero copy command queue");
+  }
+  logging::debug() << "Using Level Zero command queue group "
+                   << ordinals[copy_engine] << " for copies on device "
+                   << device << '\n';
+}
+
+LevelZeroRuntime::Engine
+LevelZeroRuntime::ze_get_transfer_engine(const int device) const {
+  return copy_queues_[device] != nullptr ? copy_engine : compute_engine;
+}
+
+ze_command_queue_handle_t
+LevelZeroRuntime::ze_get_queue(const int device, const Engine engine) const {
+  return engine == copy_engine ? copy_queues_[device] : queues_[device];
+}
+
+ze_command_list_handle_t
+LevelZeroRuntime::ze_acquire_command_list(const int device,
+                                          const Engine engine) {
+  ze_result_t result = ZE_RESULT_SUCCESS;
+
+  if (command_list_mode_ == LevelZeroCommandListMode::immediate) {
+    immediate_command_lists_.resize(devices_.size());
+    ze_command_list_handle_t &command_list =
+        immediate_command_lists_[device][engine];
+    if (command_list == nullptr) {
+      ze_command_queue_desc_t command_queue_description = {};
+      command_queue_description.stype = ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC;
+      command_queue_description.pNext = nullptr;
+      command_queue_description.ordinal =
+          queue_group_ordinals_[device][engine];
+      command_queue_description.index = 0;
+      command_queue_description.flags = 0;
+      command_queue_description.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
+      command_queue_description.priority = ZE_COMMAND_QUEUE_PRIORITY_NORMAL;
+
+      result = wrapper_.zeCommandListCreateImmediate(
+          contexts_[device], devices_[device], &command_queue_description,
+          &command_list);
+      if (result != ZE_RESULT_SUCCESS) {
+        command_list = nullptr;
+        throw RuntimeException(
+            "Failed to create Level Zero immediate command list");
+      }
+    }
+    return command_list;
+  }
+
+  command_list_pools_.resize(devices_.size());
+  auto &pool = command_list_pools_[device][engine];
+  if (!pool.empty()) {
+    ze_command_list_handle_t command_list = pool.back();
+    pool.pop_back();
+    return command_list;
+  }
+
+  ze_command_list_desc_t command_list_description = {};
+  command_list_description.stype = ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC;
+  command_list_description.pNext = nullptr;
+  command_list_description.commandQueueGroupOrdinal =
+      queue_group_ordinals_[device][engine];
+  command_list_description.flags = 0;
+
+  ze_command_list_handle_t command_list = nullptr;
+  result =
+      wrapper_.zeCommandListCreate(contexts_[device], devices_[device],
+                                   &command_list_description, &command_list);
+  if (result != ZE_RESULT_SUCCESS) {
+    throw RuntimeException("Failed to create Level Zero command list");
+  }
+  return command_list;
+}
+
+void LevelZeroRuntime::ze_execute_command_list(
+    const int device, const Engine engine,
+    ze_command_list_handle_t command_list) {
+  // Synchronous immediate command lists complete commands on append
+  if (command_list_mode_ == LevelZeroCommandListMode::immediate) {
+    return;
+  }
+
+  // Keep blocking commands ordered after previously enqueued ones
+  finish(device);
+
+  ze_result_t result = wrapper_.zeCommandListClose(command_list);
+  if (result != ZE_RESULT_SUCCESS) {
+    throw RuntimeException("Failed to close Level Zero command list");
+  }
+
+  ze_command_queue_handle_t queue = ze_get_queue(device, engine);
+  result = wrapper_.zeCommandQueueExecuteCommandLists(queue, 1, &command_list,
+                                                      nullptr);
+  if (result != ZE_RESULT_SUCCESS) {
+    throw RuntimeException("Failed to execute Level Zero command list");
+  }
+
+  result = wrapper_.zeCommandQueueSynchronize(queue, UINT64_MAX);
+  if (result != ZE_RESULT_SUCCESS) {
+    throw RuntimeException("Failed to synchronize Level Zero command queue");
+  }
+}
+
+void LevelZeroRuntime::ze_release_command_list(
+    const int device, const Engine engine,
+    ze_command_list_handle_t command_list) {
+  if (command_list_mode_ == LevelZeroCommandListMode::immediate) {
+    return;
+  }
+
+  // Called from cleanup paths, so failures drop the list instead of throwing
+  if (wrapper_.zeCommandListReset(command_list) == ZE_RESULT_SUCCESS) {
+    command_list_pools_[device][engine].push_back(command_list);
+  } else {
+    wrapper_.zeCommandListDestroy(command_list);
+  }
+}
+
+Event LevelZeroRuntime::ze_enqueue_commands(
+    const int device, const Engine engine,
+    const std::vector<std::uintptr_t> &buffers,
+    const AppendCommands &append_commands) {
+  if (device < 0 || device >= devices_.size()) {
+    throw RuntimeException("Invalid device");
+  }
+
+  PendingEvent pending = {};
+  pending.event = ze_create_event(device, &pending.index);
+  pending.command_list = ze_acquire_command_list(device, engine);
+
+  auto &pending_events = pending_events_[device][engine];
+  try {
+    // Commands on an engine run in order, so each waits for its predecessor
+    std::vector<ze_event_handle_t> wait_events;
+    if (!pending_events.empty()) {
+      wait_events.push_back(pending_events.back().event);
+    }
+
+    // Commands on the other engine are waited for only if they use the same
+    // buffers
+    const Engine other_engine =
+        engine == compute_engine ? copy_engine : compute_engine;
+    for (const auto buffer : buffers) {
+      auto it = buffer_events_.find(buffer);
+      if (it == buffer_events_.end()) {
+        continue;
+      }
+      PendingEvent *last_use =
+          ze_find_pending_event(device, other_engine, it->second);
+      if (last_use == nullptr ||
+          std::find(std::begin(wait_events), std::end(wait_events),
+                    last_use->event) != std::end(wait_events)) {
+        continue;
+      }
+      last_use->awaited_by_other_engine = true;
+      wait_events.push_back(last_use->event);
+    }
+
+    append_commands(pending.command_list, pending.event,
+                    static_cast<uint32_t>(wait_events.size()),
+                    wait_events.empty() ? nullptr : wait_events.data());
+
+    if (command_list_mode_ == LevelZeroCommandListMode::pooled) {
+      ze_result_t result = wrapper_.zeCommandListClose(pending.command_list);
+      if (result != ZE_RESULT_SUCCESS) {
+        throw RuntimeException("Failed to close Level Zero command list");
+      }
+
+      result = wrapper_.zeCommandQueueExecuteCommandLists(
+          ze_get_queue(device, engine), 1, &pending.command_list, nullptr);
+      if (result != ZE_RESULT_SUCCESS) {
+        throw RuntimeException("Failed to execute Level Zero command list");
+      }
+    }
+  } catch (...) {
+    ze_release_command_list(device, engine, pending.command_list);
+    ze_destroy_event(device, pending.event, pending.index);
+    throw;
+  }
+
+  pending.id = next_event_id_++;
+  for (const auto buffer : buffers) {
+    buffer_events_[buffer] = pending.id;
+  }
+  pending_events.push_back(pending);
+  return {device, pending.id};
+}
+
+LevelZeroRuntime::PendingEvent *
+LevelZeroRuntime::ze_find_pending_event(const int device, const Engine engine,
+                                        const std::uintptr_t id) {
+  auto &pending_events = pending_events_[device][engine];
+  auto it = std::find_if(
+      std::begin(pending_events), std::end(pending_events),
+      [&](const PendingEvent &pending) { return pending.id == id; });
+  return it != std::end(pending_events) ? &*it : nullptr;
+}
+
+ze_event_handle_t LevelZeroRuntime::ze_create_event(const int device,
+                                                    uint32_t *index) {
+  constexpr uint32_t event_pool_size = 64;
+
+  ze_result_t result = ZE_RESULT_SUCCESS;
+  auto &free_event_indices = free_event_indices_[device];
+
+  if (event_pools_[device] == nullptr) {
+    ze_event_pool_desc_t event_pool_description = {};
+    event_pool_description.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
+    event_pool_description.pNext = nullptr;
+    event_pool_description.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    event_pool_description.count = event_pool_size;
+
+    result = wrapper_.zeEventPoolCreate(
+        contexts_[device], &event_pool_description, 1, &devices_[device],
+        &event_pools_[device]);
+    if (result != ZE_RESULT_SUCCESS) {
+      event_pools_[device] = nullptr;
+      throw RuntimeException("Failed to create Level Zero event pool");
+    }
+
+    for (uint32_t i = event_pool_size; i > 0; i--) {
+      free_event_indices.push_back(i - 1);
+    }
+  }
+
+  if (free_event_indices.empty()) {
+    finish(device);
+  }
+
+  ze_event_desc_t event_description = {};
+  event_description.stype = ZE_STRUCTURE_TYPE_EVENT_DESC;
+  event_description.pNext = nullptr;
+  event_description.index = free_event_indices.back();
+  event_description.signal = ZE_EVENT_SCOPE_FLAG_HOST;
+  event_description.wait = ZE_EVENT_SCOPE_FLAG_HOST;
+
+  ze_event_handle_t event = nullptr;
+  result = wrapper_.zeEventCreate(event_pools_[device], &event_description,
+                                  &event);
+  if (result != ZE_RESULT_SUCCESS) {
+    throw RuntimeException("Failed to create Level Zero event");
+  }
+
+  *index = free_event_indices.back();
+  free_event_indices.pop_back();
+  return event;
+}
+
+void LevelZeroRuntime::ze_destroy_event(const int device,
+                                        ze_event_handle_t event,
+                                        const uint32_t index) {
+  // Called from cleanup paths, so failures are not reported
+  wrapper_.zeEventDestroy(event);
+  free_event_indices_[device].push_back(index);
+}
+
+void LevelZeroRuntime::ze_retire_events(const int device, const Engine engine,
+                                        const size_t count) {
+  auto &pending_events = pending_events_[device][engine];
+  for (size_t i = 0; i < count; i++) {
+    const PendingEvent &pending = pending_events.front();
+    ze_release_command_list(device, engine, pending.command_list);
+    // Commands on the other engine may still wait on the event
+    if (pending.awaited_by_other_engine) {
+      completed_events_[device].push_back(pending);
+    } else {
+      ze_destroy_event(device, pending.event, pending.index);
+    }
+    pending_events.pop_front();
+  }
+}
+
+void LevelZeroRuntime::ze_append_to_graph(
+    const CommandGraph &graph,
+    const std::function<void(ze_command_list_handle_t command_list)>
+        &append_command) {
+  auto &recorded = command_graphs_.at(graph.id);
+  if (recorded.closed) {
+    throw RuntimeException("Command graph has already been run");
+  }
+
+  append_command(recorded.command_list);
+
+  // Commands in a command list may overlap, so serialize them like a queue
+  ze_result_t result = wrapper_.zeCommandListAppendBarrier(
+      recorded.command_list, nullptr, 0, nullptr);
+  if (result != ZE_RESULT_SUCCESS) {
+    throw RuntimeException(
+        "Failed to append barrier to Level Zero command list");
+  }
+}
+
 std::string LevelZeroRuntime::ze_get_module_build_log(
     const ze_module_build_log_handle_t &build_log_handle) const {
   size_t log_size = 0;
@@ -10,29 +10,61 @@
 
 #include <array>
 #include <cassian/runtime/access_qualifier.hpp>
+#include <cassian/runtime/device_info.hpp>
 #include <cassian/runtime/device_properties.hpp>
 #include <cassian/runtime/feature.hpp>
+#include <cassian/runtime/mapped_buffers.hpp>
+#include <cassian/runtime/memory_kind.hpp>
 #include <cassian/runtime/program_descriptor.hpp>
 #include <cassian/runtime/runtime.hpp>
+#include <cassian/runtime/runtime_caches.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
+#include <functional>
 #include <level_zero_wrapper.hpp>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <ze_api.h>
 
 namespace cassian {
 
-class LevelZeroRuntime : public Runtime {
+/**
+ * Strategy for submitting commands to Level Zero devices.
+ */
+enum class LevelZeroCommandListMode {
+  /**
+   * Regular command lists, reset and reused from a per-device pool.
+   */
+  pooled,
+  /**
+   * Synchronous immediate command lists, one per device.
+   */
+  immediate
+};
+
+class LevelZeroRuntime : public Runtime, public RuntimeCaches {
 public:
+  LevelZeroRuntime() = default;
+  explicit LevelZeroRuntime(LevelZeroCommandListMode command_list_mode,
+                            bool use_copy_engine = true);
+  LevelZeroRuntime(const LevelZeroRuntime &) = delete;
+  LevelZeroRuntime(LevelZeroRuntime &&) = delete;
   ~LevelZeroRuntime();
+  LevelZeroRuntime &operator=(const LevelZeroRuntime &) = delete;
+  LevelZeroRuntime &operator=(LevelZeroRuntime &&) = delete;
 
   void initialize() override;
   void initialize_subdevices() override;
   int get_subdevice(int root_device, int subdevice) override;
   int get_subdevice_count(int root_device) override;
+  int get_root_device_count() override;
   Buffer create_buffer(int device, size_t size,
                        AccessQualifier access) override;
+  Buffer create_buffer(int device, size_t size, AccessQualifier access,
+                       MemoryKind memory_kind) override;
   Image create_image(const ImageDimensions dim, const ImageType type,
                      const ImageFormat format, const ImageChannelOrder order,
                      AccessQualifier access) override;
@@ -45,7 +77,14 @@ public:
   void read_image(const Image &image, void *data) override;
   void write_buffer(const Buffer &buffer, const void *data) override;
   void write_image(const Image &image, const void *data) override;
+  Event enqueue_read_buffer(const Buffer &buffer, void *data) override;
+  Event enqueue_write_buffer(const Buffer &buffer, const void *data) override;
+  void wait(const std::vector<Event> &events) override;
+  void finish(int device) override;
+  void *map_buffer(const Buffer &buffer, AccessQualifier access) override;
+  void unmap_buffer(const Buffer &buffer) override;
   void release_buffer(const Buffer &buffer) override;
+  void trim_buffer_pool() override;
   void release_image(const Image &image) override;
   void release_sampler(const Sampler &sampler) override;
 
@@ -71,6 +110,14 @@ public:
                            const Sampler &sampler) override;
   void release_kernel(const Kernel &kernel) override;
 
+  CommandGraph create_command_graph(int device) override;
+  void append_write_buffer(const CommandGraph &graph, const Buffer &buffer,
+                           const void *data) override;
+  void append_read_buffer(const CommandGraph &graph, const Buffer &buffer,
+                          void *data) override;
+  void run_command_graph(const CommandGraph &graph) override;
+  void release_command_graph(const CommandGraph &graph) override;
+
   bool is_feature_supported(Feature feature) const override;
   int get_device_property(DeviceProperty property) const override;
 
@@ -82,6 +129,13 @@ protected:
   void run_kernel_common(int device, const Kernel &kernel,
                          std::array<size_t, 3> global_work_size,
                          const std::array<size_t, 3> *local_work_size) override;
+  Event enqueue_run_kernel_common(
+      int device, const Kernel &kernel, std::array<size_t, 3> global_work_size,
+      const std::array<size_t, 3> *local_work_size) override;
+  void append_run_kernel_common(
+      const CommandGraph &graph, const Kernel &kernel,
+      std::array<size_t, 3> global_work_size,
+      const std::array<size_t, 3> *local_work_size) override;
 
   LevelZeroWrapper wrapper_;
 
@@ -89,18 +143,107 @@ protected:
   std::vector<ze_device_handle_t> devices_;
   std::vector<ze_context_handle_t> contexts_;
   std::vector<ze_command_queue_handle_t> queues_;
+  std::vector<ze_command_queue_handle_t> copy_queues_;
 
   std::unordered_map<std::uintptr_t, void *> buffers_;
+  std::unordered_map<std::uintptr_t, MemoryKind> buffer_memory_kinds_;
+
+  MappedBuffers mapped_buffers_;
   std::unordered_map<std::uintptr_t, ze_image_handle_t> images_;
   std::unordered_multimap<std::uintptr_t, ze_module_handle_t> modules_;
   std::unordered_map<std::uintptr_t, ze_kernel_handle_t> kernels_;
+  std::unordered_map<std::uintptr_t, ze_module_handle_t> cached_modules_;
+  std::unordered_map<std::uintptr_t, std::uintptr_t> kernel_cached_modules_;
   std::unordered_map<std::uintptr_t, ze_sampler_handle_t> samplers_;
 
+  enum Engine : size_t { compute_engine, copy_engine, engine_count };
+
+  template <typename T> using PerEngine = std::array<T, engine_count>;
+
+  LevelZeroCommandListMode command_list_mode_ =
+      LevelZeroCommandListMode::pooled;
+  bool use_copy_engine_ = true;
+  std::vector<PerEngine<uint32_t>> queue_group_ordinals_;
+  std::vector<PerEngine<std::vector<ze_command_list_handle_t>>>
+      command_list_pools_;
+  std::vector<PerEngine<ze_command_list_handle_t>> immediate_command_lists_;
+
+  struct PendingEvent {
+    std::uintptr_t id = 0;
+    uint32_t index = 0;
+    ze_event_handle_t event = nullptr;
+    ze_command_list_handle_t command_list = nullptr;
+    bool awaited_by_other_engine = false;
+  };
+
+  std::vector<ze_event_pool_handle_t> event_pools_;
+  std::vector<std::vector<uint32_t>> free_event_indices_;
+  std::vector<PerEngine<std::deque<PendingEvent>>> pending_events_;
+  std::vector<std::vector<PendingEvent>> completed_events_;
+  std::uintptr_t next_event_id_ = 1;
+
+  std::unordered_map<std::uintptr_t, std::uintptr_t> buffer_events_;
+  std::unordered_map<std::uintptr_t, std::unordered_map<int, std::uintptr_t>>
+      kernel_buffers_;
+
+  struct RecordedGraph {
+    ze_command_list_handle_t command_list = nullptr;
+    bool closed = false;
+  };
+
+  std::unordered_map<std::uintptr_t, RecordedGraph> command_graphs_;
+
   std::vector<int> subdevice_offsets_;
   int root_devices_count_ = 0;
 
+  std::optional<DeviceInfo> device_info_;
+  std::string device_identity_;
+
   uint32_t ze_get_device_id() const;
 
+  void ze_create_command_queues(int device);
+  Engine ze_get_transfer_engine(int device) const;
+  ze_command_queue_handle_t ze_get_queue(int device, Engine engine) const;
+
+  ze_command_list_handle_t ze_acquire_command_list(int device, Engine engine);
+  void ze_execute_command_list(int device, Engine engine,
+                               ze_command_list_handle_t command_list);
+  void ze_release_command_list(int device, Engine engine,
+                               ze_command_list_handle_t command_list);
+
+  using AppendCommands = std::function<void(
+      ze_command_list_handle_t command_list, ze_event_handle_t signal_event,
+      uint32_t num_wait_events, ze_event_handle_t *wait_events)>;
+  Event ze_enqueue_commands(int device, Engine engine,
+                            const std::vector<std::uintptr_t> &buffers,
+                            const AppendCommands &append_commands);
+  PendingEvent *ze_find_pending_event(int device, Engine engine,
+                                      std::uintptr_t id);
+  ze_event_handle_t ze_create_event(int device, uint32_t *index);
+  void ze_destroy_event(int device, ze_event_handle_t event, uint32_t index);
+  void ze_retire_events(int device, Engine engine, size_t count);
+  void ze_append_to_graph(
+      const CommandGraph &graph,
+      const std::function<void(ze_command_list_handle_t command_list)>
+          &append_command);
+  void ze_append_launch_kernel(ze_command_list_handle_t command_list,
+                               const Kernel &kernel,
+                               std::array<size_t, 3> global_work_size,
+                               const std::array<size_t, 3> *local_work_size,
+                               ze_event_handle_t signal_event,
+                               uint32_t num_wait_events,
+                               ze_event_handle_t *wait_events);
+
+  ze_module_handle_t
+  ze_build_module(const std::string &source, const std::string &build_options,
+                  const std::string &program_type,
+                  const std::optional<std::string> &spirv_options, bool quiet);
+  void ze_release_cached_module(std::uintptr_t id);
+  void ze_release_kernel(std::uintptr_t id);
+  void ze_free_buffer(std::uintptr_t id);
+  bool ze_query_feature(Feature feature) const;
+  int ze_query_device_property(DeviceProperty property) const;
+
   std::string ze_get_module_build_log(
       const ze_module_build_log_handle_t &build_log_handle) const;
 
@@ -108,6 +251,16 @@ protected:
   ze_create_module(const std::string &source, const std::string &build_options,
                    const std::string &program_type,
                    const std::optional<std::string> &spirv_options, bool quiet);
+  ze_module_handle_t
+  ze_create_module_from_spirv(const std::vector<uint8_t> &spv,
+                              const std::string &build_options,
+                              const std::optional<std::string> &spirv_options,
+                              bool quiet);
+  ze_module_handle_t
+  ze_create_module_from_native_binary(const std::vector<uint8_t> &binary);
+  std::vector<uint8_t>
+  ze_get_module_native_binary(ze_module_handle_t module) const;
+  std::string ze_get_device_identity() const;
 };
 
 } // namespace cassian
@@ -35,6 +35,8 @@ LevelZeroWrapper::LevelZeroWrapper() {
 
   zeDriverGet = reinterpret_cast<ze_pfnDriverGet_t>(
       library_->get_function("zeDriverGet"));
+  zeDriverGetProperties = reinterpret_cast<ze_pfnDriverGetProperties_t>(
+      library_->get_function("zeDriverGetProperties"));
   zeDeviceGet = reinterpret_cast<ze_pfnDeviceGet_t>(
       library_->get_function("zeDeviceGet"));
   zeDeviceGetProperties = reinterpret_cast<ze_pfnDeviceGetProperties_t>(
@@ -60,12 +62,18 @@ LevelZeroWrapper::LevelZeroWrapper() {
       library_->get_function("zeCommandQueueSynchronize"));
   zeCommandListCreate = reinterpret_cast<ze_pfnCommandListCreate_t>(
       library_->get_function("zeCommandListCreate"));
+  zeCommandListCreateImmediate =
+      reinterpret_cast<ze_pfnCommandListCreateImmediate_t>(
+          library_->get_function("zeCommandListCreateImmediate"));
   zeCommandListReset = reinterpret_cast<ze_pfnCommandListReset_t>(
       library_->get_function("zeCommandListReset"));
   zeCommandListDestroy = reinterpret_cast<ze_pfnCommandListDestroy_t>(
       library_->get_function("zeCommandListDestroy"));
   zeCommandListClose = reinterpret_cast<ze_pfnCommandListClose_t>(
       library_->get_function("zeCommandListClose"));
+  zeCommandListAppendBarrier =
+      reinterpret_cast<ze_pfnCommandListAppendBarrier_t>(
+          library_->get_function("zeCommandListAppendBarrier"));
   zeModuleCreate = reinterpret_cast<ze_pfnModuleCreate_t>(
       library_->get_function("zeModuleCreate"));
   zeModuleDestroy = reinterpret_cast<ze_pfnModuleDestroy_t>(
@@ -89,6 +97,8 @@ LevelZeroWrapper::LevelZeroWrapper() {
       library_->get_function("zeMemAllocShared"));
   zeMemAllocDevice = reinterpret_cast<ze_pfnMemAllocDevice_t>(
       library_->get_function("zeMemAllocDevice"));
+  zeMemAllocHost = reinterpret_cast<ze_pfnMemAllocHost_t>(
+      library_->get_function("zeMemAllocHost"));
   zeMemFree =
       reinterpret_cast<ze_pfnMemFree_t>(library_->get_function("zeMemFree"));
   zeCommandListAppendMemoryCopy =
@@ -121,6 +131,19 @@ LevelZeroWrapper::LevelZeroWrapper() {
       library_->get_function("zeModuleGetNativeBinary"));
   zeDeviceGetSubDevices = reinterpret_cast<ze_pfnDeviceGetSubDevices_t>(
       library_->get_function("zeDeviceGetSubDevices"));
+  zeDeviceGetCommandQueueGroupProperties =
+      reinterpret_cast<ze_pfnDeviceGetCommandQueueGroupProperties_t>(
+          library_->get_function("zeDeviceGetCommandQueueGroupProperties"));
+  zeEventPoolCreate = reinterpret_cast<ze_pfnEventPoolCreate_t>(
+      library_->get_function("zeEventPoolCreate"));
+  zeEventPoolDestroy = reinterpret_cast<ze_pfnEventPoolDestroy_t>(
+      library_->get_function("zeEventPoolDestroy"));
+  zeEventCreate = reinterpret_cast<ze_pfnEventCreate_t>(
+      library_->get_function("zeEventCreate"));
+  zeEventDestroy = reinterpret_cast<ze_pfnEventDestroy_t>(
+      library_->get_function("zeEventDestroy"));
+  zeEventHostSynchronize = reinterpret_cast<ze_pfnEventHostSynchronize_t>(
+      library_->get_function("zeEventHostSynchronize"));
 
   try {
     zeCommandListAppendLaunchKernelWithParameters =
@@ -24,6 +24,7 @@ public:
 
   ze_pfnInit_t zeInit = nullptr;
   ze_pfnDriverGet_t zeDriverGet = nullptr;
+  ze_pfnDriverGetProperties_t zeDriverGetProperties = nullptr;
   ze_pfnInitDrivers_t zeInitDrivers = nullptr;
   ze_pfnDeviceGet_t zeDeviceGet = nullptr;
   ze_pfnDeviceGetProperties_t zeDeviceGetProperties = nullptr;
@@ -37,9 +38,11 @@ public:
       nullptr;
   ze_pfnCommandQueueSynchronize_t zeCommandQueueSynchronize = nullptr;
   ze_pfnCommandListCreate_t zeCommandListCreate = nullptr;
+  ze_pfnCommandListCreateImmediate_t zeCommandListCreateImmediate = nullptr;
   ze_pfnCommandListReset_t zeCommandListReset = nullptr;
   ze_pfnCommandListDestroy_t zeCommandListDestroy = nullptr;
   ze_pfnCommandListClose_t zeCommandListClose = nullptr;
+  ze_pfnCommandListAppendBarrier_t zeCommandListAppendBarrier = nullptr;
   ze_pfnModuleCreate_t zeModuleCreate = nullptr;
   ze_pfnModuleDestroy_t zeModuleDestroy = nullptr;
   ze_pfnModuleDynamicLink_t zeModuleDynamicLink = nullptr;
@@ -52,6 +55,7 @@ public:
       nullptr;
   ze_pfnMemAllocShared_t zeMemAllocShared = nullptr;
   ze_pfnMemAllocDevice_t zeMemAllocDevice = nullptr;
+  ze_pfnMemAllocHost_t zeMemAllocHost = nullptr;
   ze_pfnMemFree_t zeMemFree = nullptr;
   ze_pfnCommandListAppendMemoryCopy_t zeCommandListAppendMemoryCopy = nullptr;
   ze_pfnCommandListAppendImageCopyToMemory_t
@@ -68,6 +72,13 @@ public:
   ze_pfnImageViewCreateExp_t zeImageViewCreateExp = nullptr;
   ze_pfnModuleGetNativeBinary_t zeModuleGetNativeBinary = nullptr;
   ze_pfnDeviceGetSubDevices_t zeDeviceGetSubDevices = nullptr;
+  ze_pfnDeviceGetCommandQueueGroupProperties_t
+      zeDeviceGetCommandQueueGroupProperties = nullptr;
+  ze_pfnEventPoolCreate_t zeEventPoolCreate = nullptr;
+  ze_pfnEventPoolDestroy_t zeEventPoolDestroy = nullptr;
+  ze_pfnEventCreate_t zeEventCreate = nullptr;
+  ze_pfnEventDestroy_t zeEventDestroy = nullptr;
+  ze_pfnEventHostSynchronize_t zeEventHostSynchronize = nullptr;
   ze_pfnCommandListAppendLaunchKernelWithParameters_t
       zeCommandListAppendLaunchKernelWithParameters = nullptr;
 
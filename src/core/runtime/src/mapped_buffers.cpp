@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cassian/runtime/access_qualifier.hpp>
+#include <cassian/runtime/mapped_buffers.hpp>
+#include <cassian/runtime/memory_kind.hpp>
+#include <cassian/utility/utility.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace cassian {
+
+void *MappedBuffers::map(std::uintptr_t buffer, size_t size,
+                         MemoryKind memory_kind, void *allocation,
+                         AccessQualifier access, const ReadFunction &read) {
+  // Host and shared allocations are directly accessible by host
+  if (memory_kind != MemoryKind::device) {
+    return allocation;
+  }
+
+  auto &mapping = mappings_[buffer];
+  mapping.data.resize(size);
+  mapping.access = access;
+  if (access != AccessQualifier::write_only) {
+    read(mapping.data.data());
+  }
+  return mapping.data.data();
+}
+
+void MappedBuffers::unmap(std::uintptr_t buffer, const WriteFunction &write) {
+  auto it = mappings_.find(buffer);
+  if (it == mappings_.end()) {
+    return;
+  }
+
+  auto f = finally([&]() { mappings_.erase(it); });
+  if (it->second.access != AccessQualifier::read_only) {
+    write(it->second.data.data());
+  }
+}
+
+} // namespace cassian
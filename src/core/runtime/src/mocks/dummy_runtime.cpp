@@ -7,9 +7,13 @@
 
 #include <cassian/runtime/device_properties.hpp>
 #include <cassian/runtime/feature.hpp>
+#include <cassian/runtime/memory_kind.hpp>
 #include <cassian/runtime/mocks/dummy_runtime.hpp>
 #include <cassian/runtime/program_descriptor.hpp>
 #include <cassian/runtime/runtime.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace cassian {
 
@@ -19,10 +23,17 @@ int DummyRuntime::get_subdevice(int /*root_device*/, int /*subdevice*/) {
   return 0;
 }
 int DummyRuntime::get_subdevice_count(int /*root_device*/) { return 0; }
+int DummyRuntime::get_root_device_count() { return 1; }
 
-Buffer DummyRuntime::create_buffer(int /*device*/, const size_t /*size*/,
+Buffer DummyRuntime::create_buffer(int device, const size_t size,
                                    AccessQualifier /*access*/) {
-  return Buffer();
+  return Buffer(device, next_buffer_id_++, size);
+}
+
+Buffer DummyRuntime::create_buffer(int device, const size_t size,
+                                   AccessQualifier access,
+                                   MemoryKind /*memory_kind*/) {
+  return create_buffer(device, size, access);
 }
 
 Image DummyRuntime::create_image(const ImageDimensions /*dim*/,
@@ -54,7 +65,35 @@ void DummyRuntime::write_buffer(const Buffer & /*buffer*/,
 void DummyRuntime::write_image(const Image & /*image*/, const void * /*data*/) {
 }
 
-void DummyRuntime::release_buffer(const Buffer & /*buffer*/) {}
+Event DummyRuntime::enqueue_read_buffer(const Buffer &buffer, void * /*data*/) {
+  return Event(buffer.device, 0);
+}
+
+Event DummyRuntime::enqueue_write_buffer(const Buffer &buffer,
+                                         const void * /*data*/) {
+  return Event(buffer.device, 0);
+}
+
+void DummyRuntime::wait(const std::vector<Event> & /*events*/) {}
+
+void DummyRuntime::finish(int /*device*/) {}
+
+void *DummyRuntime::map_buffer(const Buffer &buffer,
+                               AccessQualifier /*access*/) {
+  auto &data = mapped_buffers_[buffer.id];
+  data.resize(buffer.size);
+  return data.data();
+}
+
+void DummyRuntime::unmap_buffer(const Buffer &buffer) {
+  mapped_buffers_.erase(buffer.id);
+}
+
+void DummyRuntime::release_buffer(const Buffer &buffer) {
+  mapped_buffers_.erase(buffer.id);
+}
+
+void DummyRuntime::trim_buffer_pool() {}
 
 void DummyRuntime::release_image(const Image & /*image*/) {}
 
@@ -93,6 +132,22 @@ void DummyRuntime::set_kernel_argument(const Kernel & /*kernel*/,
 
 void DummyRuntime::release_kernel(const Kernel & /*kernel*/) {}
 
+CommandGraph DummyRuntime::create_command_graph(int device) {
+  return CommandGraph(device, 0);
+}
+
+void DummyRuntime::append_write_buffer(const CommandGraph & /*graph*/,
+                                       const Buffer & /*buffer*/,
+                                       const void * /*data*/) {}
+
+void DummyRuntime::append_read_buffer(const CommandGraph & /*graph*/,
+                                      const Buffer & /*buffer*/,
+                                      void * /*data*/) {}
+
+void DummyRuntime::run_command_graph(const CommandGraph & /*graph*/) {}
+
+void DummyRuntime::release_command_graph(const CommandGraph & /*graph*/) {}
+
 bool DummyRuntime::is_feature_supported(const Feature /*feature*/) const {
   return true;
 }
@@ -108,6 +163,18 @@ void DummyRuntime::run_kernel_common(
     std::array<size_t, 3> /*global_work_size*/,
     const std::array<size_t, 3> * /*local_work_size*/) {}
 
+Event DummyRuntime::enqueue_run_kernel_common(
+    int device, const Kernel & /*kernel*/,
+    std::array<size_t, 3> /*global_work_size*/,
+    const std::array<size_t, 3> * /*local_work_size*/) {
+  return Event(device, 0);
+}
+
+void DummyRuntime::append_run_kernel_common(
+    const CommandGraph & /*graph*/, const Kernel & /*kernel*/,
+    std::array<size_t, 3> /*global_work_size*/,
+    const std::array<size_t, 3> * /*local_work_size*/) {}
+
 std::vector<uint8_t> DummyRuntime::create_program_and_get_native_binary(
     const std::string & /*source*/, const std::string & /*build_options*/,
     const std::string & /*program_type*/,
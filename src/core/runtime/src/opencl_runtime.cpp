@@ -20,10 +20,15 @@
 
 #include <cassian/logging/logging.hpp>
 #include <cassian/offline_compiler/offline_compiler.hpp>
+#include <cassian/runtime/device_info.hpp>
 #include <cassian/runtime/device_properties.hpp>
 #include <cassian/runtime/feature.hpp>
 #include <cassian/runtime/image_properties.hpp>
+#include <cassian/runtime/kernel_cache.hpp>
+#include <cassian/runtime/memory_kind.hpp>
 #include <cassian/runtime/opencl_utils.hpp>
+#include <cassian/runtime/precompiled_kernels.hpp>
+#include <cassian/runtime/program_binary_cache.hpp>
 #include <cassian/runtime/program_descriptor.hpp>
 #include <cassian/runtime/property_checks.hpp>
 #include <cassian/runtime/runtime.hpp>
@@ -33,7 +38,39 @@
 #include <opencl_wrapper.hpp>
 
 namespace cassian {
+namespace {
+const cl_event *get_wait_list(const std::vector<cl_event> &events) {
+  return events.empty() ? nullptr : events.data();
+}
+
+cl_uint get_work_dim(const std::array<size_t, 3> &global_work_size) {
+  cl_uint work_dim = (global_work_size[1] > 1U) ? 2 : 1U;
+  return (global_work_size[2] > 1U) ? 3 : work_dim;
+}
+} // namespace
+
+OpenCLRuntime::OpenCLRuntime(OpenCLQueueMode queue_mode)
+    : queue_mode_(queue_mode) {}
+
 OpenCLRuntime::~OpenCLRuntime() {
+  for (const auto &[id, kernel] : kernels_) {
+    wrapper_.clReleaseKernel(kernel);
+  }
+  for (const auto id : kernel_cache_.clear()) {
+    wrapper_.clReleaseProgram(programs_.at(id));
+  }
+  for (const auto id : buffer_pool_.trim()) {
+    wrapper_.clReleaseMemObject(buffers_.at(id));
+  }
+  for (const auto &event : events_) {
+    wrapper_.clReleaseEvent(event.second.second);
+  }
+  for (const auto &event : memory_object_events_) {
+    wrapper_.clReleaseEvent(event.second.second);
+  }
+  for (const auto &[id, recorded] : command_graphs_) {
+    cl_release_graph(recorded);
+  }
   for (cl_command_queue queue : queues_) {
     if (queue != nullptr) {
       wrapper_.clReleaseCommandQueue(queue);
@@ -88,11 +125,7 @@ void OpenCLRuntime::initialize() {
     throw RuntimeException("Failed to create OpenCL context");
   }
 
-  queues_.push_back(wrapper_.clCreateCommandQueueWithProperties(
-      contexts_[0], devices_[0], nullptr, &result));
-  if (result != CL_SUCCESS) {
-    throw RuntimeException("Failed to create OpenCL command queue");
-  }
+  queues_.push_back(cl_create_command_queue(0));
 
   std::string extension_string;
 
@@ -115,7 +148,17 @@ void OpenCLRuntime::initialize() {
   std::istringstream iss(extension_string);
   extensions_.insert(std::istream_iterator<std::string>(iss),
                      std::istream_iterator<std::string>());
+  if (extensions_.contains("cl_khr_command_buffer")) {
+    wrapper_.load_command_buffer_functions(platform);
+  }
   root_devices_count_ = devices_.size();
+
+  device_info_ = DeviceInfo::query(
+      [this](DeviceProperty property) {
+        return cl_query_device_property(property);
+      },
+      [this](Feature feature) { return cl_query_feature(feature); });
+  device_identity_ = cl_get_device_identity();
 }
 
 void OpenCLRuntime::initialize_subdevices() {
@@ -161,15 +204,7 @@ void OpenCLRuntime::initialize_subdevices() {
       }
 
       queues_[subdevice_offsets_[i] + j] =
-          wrapper_.clCreateCommandQueueWithProperties(
-              contexts_[subdevice_offsets_[i] + j],
-              devices_[subdevice_offsets_[i] + j], nullptr, &result);
-      if (result != CL_SUCCESS) {
-        throw RuntimeException(
-            "Failed to create OpenCL command queue for device "
-            "number: " +
-            (subdevice_offsets_[i] + j));
-      }
+          cl_create_command_queue(subdevice_offsets_[i] + j);
     }
   }
 }
@@ -194,14 +229,44 @@ int OpenCLRuntime::get_subdevice_count(int root_device) {
   return subdevice_count;
 }
 
+int OpenCLRuntime::get_root_device_count() {
+  cl_platform_id platform = nullptr;
+  cl_int result =
+      wrapper_.clGetDeviceInfo(devices_[0], CL_DEVICE_PLATFORM,
+                               sizeof(platform), &platform, nullptr);
+  if (result != CL_SUCCESS) {
+    throw RuntimeException("Failed to get OpenCL device platform");
+  }
+
+  cl_uint number_of_devices = 0;
+  result = wrapper_.clGetDeviceIDs(platform, CL_DEVICE_TYPE_ALL, 0, nullptr,
+                                   &number_of_devices);
+  if (result != CL_SUCCESS) {
+    throw RuntimeException("Failed to get number of available OpenCL devices");
+  }
+  return static_cast<int>(number_of_devices);
+}
+
 Buffer OpenCLRuntime::create_buffer(int device, const size_t size,
                                     AccessQualifier access) {
+  return create_buffer(device, size, access, MemoryKind::device);
+}
+
+Buffer OpenCLRuntime::create_buffer(int device, const size_t size,
+                                    AccessQualifier access,
+                                    MemoryKind memory_kind) {
   if (device < 0 || device >= devices_.size()) {
     throw RuntimeException("Invalid device");
   }
 
+  if (const auto pooled =
+          buffer_pool_.acquire(device, size, access, memory_kind)) {
+    return {device, *pooled, size};
+  }
+
   cl_int result = CL_SUCCESS;
-  const cl_mem_flags flags = append_access_qualifier_flags(0, access);
+  cl_mem_flags flags = append_memory_kind_flags(0, memory_kind);
+  flags = append_access_qualifier_flags(flags, access);
 
   cl_mem buffer =
       wrapper_.clCreateBuffer(contexts_[device], flags, size, nullptr, &result);
@@ -212,6 +277,7 @@ Buffer OpenCLRuntime::create_buffer(int device, const size_t size,
 
   auto id = reinterpret_cast<std::uintptr_t>(buffer);
   buffers_[id] = buffer;
+  buffer_pool_.insert(id, device, size, access, memory_kind);
 
   return {device, id, size};
 }
@@ -356,8 +422,11 @@ Sampler OpenCLRuntime::create_sampler(SamplerCoordinates coordinates,
 
 void OpenCLRuntime::read_buffer(const Buffer &buffer, void *data) {
   cl_mem b = buffers_.at(buffer.id);
+  const auto wait_list = cl_get_dependencies({b});
   cl_int result = wrapper_.clEnqueueReadBuffer(
-      queues_[buffer.device], b, 1, 0, buffer.size, data, 0, nullptr, nullptr);
+      queues_[buffer.device], b, 1, 0, buffer.size, data,
+      static_cast<cl_uint>(wait_list.size()), get_wait_list(wait_list),
+      nullptr);
   if (result != CL_SUCCESS) {
     throw RuntimeException("Failed to read OpenCL buffer");
   }
@@ -367,37 +436,178 @@ void OpenCLRuntime::read_image(const Image &image, void *data) {
   cl_mem src_image = images_.at(image.id);
   const size_t region[] = {image.dim.width, image.dim.height, image.dim.depth};
   const size_t origin[] = {0, 0, 0};
-  cl_int result =
-      wrapper_.clEnqueueReadImage(queues_[0], src_image, 1, origin, region, 0,
-                                  0, data, 0, nullptr, nullptr);
+  const auto wait_list = cl_get_dependencies({src_image});
+  cl_int result = wrapper_.clEnqueueReadImage(
+      queues_[0], src_image, 1, origin, region, 0, 0, data,
+      static_cast<cl_uint>(wait_list.size()), get_wait_list(wait_list),
+      nullptr);
   if (result != CL_SUCCESS) {
     throw RuntimeException("Failed to read OpenCL image");
   }
 }
 
 void OpenCLRuntime::write_buffer(const Buffer &buffer, const void *data) {
-  cl_mem b = buffers_.at(buffer.id);
-  cl_int result = wrapper_.clEnqueueWriteBuffer(
-      queues_[0], b, 1, 0, buffer.size, data, 0, nullptr, nullptr);
-  if (result != CL_SUCCESS) {
-    throw RuntimeException("Failed to write to OpenCL buffer");
-  }
+  // Blocking write only guarantees that data can be reused, so the event
+  // orders later commands on out-of-order queues
+  wait({enqueue_write_buffer(buffer, data)});
 }
 
 void OpenCLRuntime::write_image(const Image &image, const void *data) {
   cl_mem i = images_.at(image.id);
   const size_t region[] = {image.dim.width, image.dim.height, image.dim.depth};
   const size_t origin[] = {0, 0, 0};
-  cl_int result = wrapper_.clEnqueueWriteImage(queues_[0], i, 1, origin, region,
-                                               0, 0, data, 0, nullptr, nullptr);
+  const auto wait_list = cl_get_dependencies({i});
+  cl_event event = nullptr;
+  cl_int result = wrapper_.clEnqueueWriteImage(
+      queues_[0], i, 1, origin, region, 0, 0, data,
+      static_cast<cl_uint>(wait_list.size()), get_wait_list(wait_list),
+      &event);
   if (result != CL_SUCCESS) {
     throw RuntimeException("Failed to write to OpenCL image");
   }
+  cl_set_last_use(0, {i}, event);
+  wrapper_.clReleaseEvent(event);
 }
 
-void OpenCLRuntime::release_buffer(const Buffer &buffer) {
+Event OpenCLRuntime::enqueue_read_buffer(const Buffer &buffer, void *data) {
+  cl_mem b = buffers_.at(buffer.id);
+  const auto wait_list = cl_get_dependencies({b});
+  cl_event event = nullptr;
+  cl_int result = wrapper_.clEnqueueReadBuffer(
+      queues_[buffer.device], b, 0, 0, buffer.size, data,
+      static_cast<cl_uint>(wait_list.size()), get_wait_list(wait_list),
+      &event);
+  if (result != CL_SUCCESS) {
+    throw RuntimeException("Failed to enqueue OpenCL buffer read");
+  }
+  cl_set_last_use(buffer.device, {b}, event);
+  return cl_track_event(buffer.device, event);
+}
+
+Event OpenCLRuntime::enqueue_write_buffer(const Buffer &buffer,
+                                          const void *data) {
+  cl_mem b = buffers_.at(buffer.id);
+  const auto wait_list = cl_get_dependencies({b});
+  cl_event event = nullptr;
+  cl_int result = wrapper_.clEnqueueWriteBuffer(
+      queues_[buffer.device], b, 0, 0, buffer.size, data,
+      static_cast<cl_uint>(wait_list.size()), get_wait_list(wait_list),
+      &event);
+  if (result != CL_SUCCESS) {
+    throw RuntimeException("Failed to enqueue OpenCL buffer write");
+  }
+  cl_set_last_use(buffer.device, {b}, event);
+  return cl_track_event(buffer.device, event);
+}
+
+void OpenCLRuntime::wait(const std::vector<Event> &events) {
+  std::vector<cl_event> cl_events;
+  cl_events.reserve(events.size());
+  for (const auto &event : events) {
+    auto it = events_.find(event.id);
+    if (it != events_.end()) {
+      cl_events.push_back(it->second.second);
+      events_.erase(it);
+    }
+  }
+  if (cl_events.empty()) {
+    return;
+  }
+
+  auto f = finally([&]() {
+    for (cl_event event : cl_events) {
+      wrapper_.clReleaseEvent(event);
+    }
+  });
+
+  cl_int result =
+      wrapper_.clWaitForEvents(static_cast<cl_uint>(cl_events.size()),
+                               cl_events.data());
+  if (result != CL_SUCCESS) {
+    throw RuntimeException("Failed to wait for OpenCL events");
+  }
+}
+
+void OpenCLRuntime::finish(int device) {
+  if (device < 0 || device >= devices_.size()) {
+    throw RuntimeException("Invalid device");
+  }
+
+  cl_int result = wrapper_.clFinish(queues_[device]);
+  if (result != CL_SUCCESS) {
+    throw RuntimeException("Failed to finish OpenCL queue");
+  }
+
+  for (auto it = events_.begin(); it != events_.end();) {
+    if (it->second.first == device) {
+      wrapper_.clReleaseEvent(it->second.second);
+      it = events_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  for (auto it = memory_object_events_.begin();
+       it != memory_object_events_.end();) {
+    if (it->second.first == device) {
+      wrapper_.clReleaseEvent(it->second.second);
+      it = memory_object_events_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void *OpenCLRuntime::map_buffer(const Buffer &buffer,
+                                AccessQualifier access) {
   cl_mem b = buffers_.at(buffer.id);
-  buffers_.erase(buffer.id);
+  const auto wait_list = cl_get_dependencies({b});
+  cl_int result = CL_SUCCESS;
+  void *data = wrapper_.clEnqueueMapBuffer(
+      queues_[buffer.device], b, 1, cl_get_map_flags(access), 0, buffer.size,
+      static_cast<cl_uint>(wait_list.size()), get_wait_list(wait_list),
+      nullptr, &result);
+  if (result != CL_SUCCESS) {
+    throw RuntimeException("Failed to map OpenCL buffer");
+  }
+  mapped_buffers_[buffer.id] = data;
+  return data;
+}
+
+void OpenCLRuntime::unmap_buffer(const Buffer &buffer) {
+  cl_mem b = buffers_.at(buffer.id);
+  void *data = mapped_buffers_.at(buffer.id);
+  mapped_buffers_.erase(buffer.id);
+
+  cl_event event = nullptr;
+  cl_int result = wrapper_.clEnqueueUnmapMemObject(
+      queues_[buffer.device], b, data, 0, nullptr, &event);
+  if (result != CL_SUCCESS) {
+    throw RuntimeException("Failed to unmap OpenCL buffer");
+  }
+  cl_set_last_use(buffer.device, {b}, event);
+  wrapper_.clReleaseEvent(event);
+}
+
+void OpenCLRuntime::release_buffer(const Buffer &buffer) {
+  // Pooled buffer must not stay mapped when it is handed out again
+  if (mapped_buffers_.contains(buffer.id)) {
+    unmap_buffer(buffer);
+  }
+  for (const auto id : buffer_pool_.release(buffer.id)) {
+    cl_release_buffer(id);
+  }
+}
+
+void OpenCLRuntime::trim_buffer_pool() {
+  for (const auto id : buffer_pool_.trim()) {
+    cl_release_buffer(id);
+  }
+}
+
+void OpenCLRuntime::cl_release_buffer(std::uintptr_t id) {
+  cl_mem b = buffers_.at(id);
+  buffers_.erase(id);
+  cl_release_last_use(b);
 
   cl_int result = wrapper_.clReleaseMemObject(b);
   if (result != CL_SUCCESS) {
@@ -408,6 +618,7 @@ void OpenCLRuntime::release_buffer(const Buffer &buffer) {
 void OpenCLRuntime::release_image(const Image &image) {
   cl_mem i = images_.at(image.id);
   images_.erase(image.id);
+  cl_release_last_use(i);
   cl_int result = wrapper_.clReleaseMemObject(i);
   if (result != CL_SUCCESS) {
     throw RuntimeException("Failed to release OpenCL image");
@@ -427,10 +638,65 @@ Kernel OpenCLRuntime::create_kernel(
     const std::string &kernel_name, const std::string &source,
     const std::string &build_options, const std::string &program_type,
     const std::optional<std::string> &spirv_options, bool quiet) {
+  const auto program_key =
+      kernel_cache_key(source, build_options, program_type, spirv_options);
+  std::uintptr_t program_id = 0;
+  const auto cached_program = kernel_cache_.acquire(program_key);
+  if (cached_program.has_value()) {
+    program_id = cached_program.value();
+  } else {
+    cl_program program = cl_build_program(source, build_options, program_type,
+                                          spirv_options, quiet);
+    program_id = reinterpret_cast<std::uintptr_t>(program);
+    programs_[program_id] = program;
+    kernel_cache_.insert(program_key, program_id);
+  }
+
+  // Every kernel is a separate object, so arguments set by previous users of
+  // the program are never seen
   cl_int result = CL_SUCCESS;
+  cl_kernel kernel = wrapper_.clCreateKernel(programs_.at(program_id),
+                                             kernel_name.c_str(), &result);
+  if (result != CL_SUCCESS) {
+    cl_release_program(program_id);
+    throw RuntimeException("Failed to create OpenCL kernel");
+  }
 
-  cl_program program =
-      cl_create_program(source, build_options, program_type, quiet);
+  auto id = reinterpret_cast<std::uintptr_t>(kernel);
+  kernels_[id] = kernel;
+  kernel_programs_[id] = program_id;
+
+  return Kernel(id);
+}
+
+cl_program OpenCLRuntime::cl_build_program(
+    const std::string &source, const std::string &build_options,
+    const std::string &program_type,
+    const std::optional<std::string> &spirv_options, bool quiet) {
+  std::string cache_key;
+  cl_program program = nullptr;
+  if (precompiled_kernels_ != nullptr &&
+      PrecompiledKernels::is_applicable(program_type, spirv_options)) {
+    const auto binary = precompiled_kernels_->find(
+        get_device_property(DeviceProperty::ip_version), source,
+        build_options);
+    if (binary.has_value()) {
+      program = cl_create_program_from_binary(binary.value());
+    }
+  }
+  if (program == nullptr && program_binary_cache_ != nullptr) {
+    cache_key = program_binary_cache_key(
+        {name(), device_identity_, program_type, build_options,
+         spirv_options.value_or(""), source});
+    const auto binary = program_binary_cache_->load(cache_key);
+    if (binary.has_value()) {
+      program = cl_create_program_from_binary(binary.value());
+    }
+  }
+  const bool cached = program != nullptr;
+  if (!cached) {
+    program = cl_create_program(source, build_options, program_type, quiet);
+  }
 
   const char *options = build_options.c_str();
   if (program_type == "spirv") {
@@ -445,8 +711,8 @@ Kernel OpenCLRuntime::create_kernel(
   logging::debug() << "SPIR-V options: " << spirv_options.value_or("") << '\n';
   logging::debug() << "Final build options: " << options << '\n';
 
-  result = wrapper_.clBuildProgram(program, 1, &devices_[0], options, nullptr,
-                                   nullptr);
+  cl_int result = wrapper_.clBuildProgram(program, 1, &devices_[0], options,
+                                          nullptr, nullptr);
   if (result != CL_SUCCESS) {
     if (!quiet) {
       const auto build_log = cl_get_program_build_info(program);
@@ -455,21 +721,11 @@ Kernel OpenCLRuntime::create_kernel(
     throw RuntimeException("Failed to build OpenCL program");
   }
 
-  cl_kernel kernel =
-      wrapper_.clCreateKernel(program, kernel_name.c_str(), &result);
-  if (result != CL_SUCCESS) {
-    throw RuntimeException("Failed to create OpenCL kernel");
-  }
-
-  result = wrapper_.clReleaseProgram(program);
-  if (result != CL_SUCCESS) {
-    throw RuntimeException("Failed to release OpenCL program");
+  if (program_binary_cache_ != nullptr && !cached) {
+    program_binary_cache_->store(cache_key, cl_get_program_binary(program));
   }
 
-  auto id = reinterpret_cast<std::uintptr_t>(kernel);
-  kernels_[id] = kernel;
-
-  return Kernel(id);
+  return program;
 }
 
 Kernel OpenCLRuntime::create_kernel_from_multiple_programs(
@@ -533,6 +789,7 @@ void OpenCLRuntime::set_kernel_argument(const Kernel &kernel,
                                         const Buffer &buffer) {
   cl_mem b = buffers_.at(buffer.id);
   set_kernel_argument(kernel, argument_index, sizeof(b), &b);
+  kernel_memory_objects_[kernel.id][argument_index] = b;
 }
 
 void OpenCLRuntime::set_kernel_argument(const Kernel &kernel,
@@ -540,6 +797,7 @@ void OpenCLRuntime::set_kernel_argument(const Kernel &kernel,
                                         const Image &image) {
   cl_mem i = images_.at(image.id);
   set_kernel_argument(kernel, argument_index, sizeof(i), &i);
+  kernel_memory_objects_[kernel.id][argument_index] = i;
 }
 
 void OpenCLRuntime::set_kernel_argument(const Kernel &kernel,
@@ -559,57 +817,279 @@ void OpenCLRuntime::set_kernel_argument(const Kernel &kernel,
   if (result != CL_SUCCESS) {
     throw RuntimeException("Failed to set OpenCL kernel argument");
   }
+
+  auto it = kernel_memory_objects_.find(kernel.id);
+  if (it != kernel_memory_objects_.end()) {
+    it->second.erase(argument_index);
+  }
 }
 
 void OpenCLRuntime::run_kernel_common(
     int device, const Kernel &kernel,
     const std::array<size_t, 3> global_work_size,
     const std::array<size_t, 3> *local_work_size) {
+  cl_enqueue_kernel(device, kernel, global_work_size, local_work_size,
+                    nullptr);
+
+  cl_int result = wrapper_.clFinish(queues_[device]);
+  if (result != CL_SUCCESS) {
+    throw RuntimeException("Failed to finish OpenCL queue");
+  }
+}
+
+Event OpenCLRuntime::enqueue_run_kernel_common(
+    int device, const Kernel &kernel,
+    const std::array<size_t, 3> global_work_size,
+    const std::array<size_t, 3> *local_work_size) {
+  cl_event event = nullptr;
+  cl_enqueue_kernel(device, kernel, global_work_size, local_work_size, &event);
+  return cl_track_event(device, event);
+}
+
+void OpenCLRuntime::append_run_kernel_common(
+    const CommandGraph &graph, const Kernel &kernel,
+    const std::array<size_t, 3> global_work_size,
+    const std::array<size_t, 3> *local_work_size) {
+  RecordedGraph &recorded = cl_get_recording_graph(graph);
+  cl_kernel k = kernels_.at(kernel.id);
+  const cl_uint work_dim = get_work_dim(global_work_size);
+  const std::array<size_t, 3> local_ws =
+      cl_get_local_work_size(global_work_size, local_work_size);
+
+  cl_int result = CL_SUCCESS;
+  // Command buffers are recorded for in-order queues only, as their queue
+  // properties must match
+  if (wrapper_.clCreateCommandBufferKHR != nullptr &&
+      queue_mode_ == OpenCLQueueMode::in_order) {
+    auto &steps = recorded.steps;
+    if (steps.empty() ||
+        steps.back().type != GraphStep::Type::command_buffer) {
+      GraphStep step;
+      step.type = GraphStep::Type::command_buffer;
+      step.command_buffer = wrapper_.clCreateCommandBufferKHR(
+          1, &queues_[graph.device], nullptr, &result);
+      if (result != CL_SUCCESS) {
+        throw RuntimeException("Failed to create OpenCL command buffer");
+      }
+      steps.push_back(step);
+    }
+
+    // Commands in a command buffer may overlap unless chained by sync points
+    GraphStep &step = steps.back();
+    const cl_uint num_sync_points = step.sync_point.has_value() ? 1 : 0;
+    cl_sync_point sync_point = 0;
+    result = wrapper_.clCommandNDRangeKernelKHR(
+        step.command_buffer, nullptr, nullptr, k, work_dim, nullptr,
+        global_work_size.data(), local_ws.data(), num_sync_points,
+        step.sync_point.has_value() ? &step.sync_point.value() : nullptr,
+        &sync_point, nullptr);
+    if (result != CL_SUCCESS) {
+      throw RuntimeException(
+          "Failed to record OpenCL ND range kernel in command buffer");
+    }
+    step.sync_point = sync_point;
+    return;
+  }
+
+  if (wrapper_.clCloneKernel == nullptr) {
+    throw RuntimeException(
+        "Command graphs require cl_khr_command_buffer or OpenCL 2.1");
+  }
+
+  // Clone captures current kernel arguments
+  GraphStep step;
+  step.type = GraphStep::Type::run_kernel;
+  step.kernel = wrapper_.clCloneKernel(k, &result);
+  if (result != CL_SUCCESS) {
+    throw RuntimeException("Failed to clone OpenCL kernel");
+  }
+  step.work_dim = work_dim;
+  step.global_work_size = global_work_size;
+  step.local_work_size = local_ws;
+  recorded.steps.push_back(step);
+}
+
+void OpenCLRuntime::cl_enqueue_kernel(
+    int device, const Kernel &kernel,
+    const std::array<size_t, 3> global_work_size,
+    const std::array<size_t, 3> *local_work_size, cl_event *event) {
   if (device < 0 || device >= devices_.size()) {
     throw RuntimeException("Invalid device");
   }
 
   cl_kernel k = kernels_.at(kernel.id);
-  cl_uint work_dim = (global_work_size[1] > 1U) ? 2 : 1U;
-  work_dim = (global_work_size[2] > 1U) ? 3 : work_dim;
+  const cl_uint work_dim = get_work_dim(global_work_size);
 
   std::array<size_t, 3> global_work_offset = {0, 0, 0};
-  std::array<size_t, 3> local_ws = {1, 1, 1};
-
-  if (local_work_size != nullptr) {
-    local_ws = *local_work_size;
-  } else {
-    const std::array<size_t, 3> max_limits = {
-        static_cast<size_t>(
-            get_device_property(DeviceProperty::max_group_size_x)),
-        static_cast<size_t>(
-            get_device_property(DeviceProperty::max_group_size_y)),
-        static_cast<size_t>(
-            get_device_property(DeviceProperty::max_group_size_z))};
-    const auto max_common_size = static_cast<size_t>(
-        get_device_property(DeviceProperty::max_total_group_size));
-    local_ws =
-        get_max_local_work_size(global_work_size, max_limits, max_common_size);
-  }
+  const std::array<size_t, 3> local_ws =
+      cl_get_local_work_size(global_work_size, local_work_size);
   logging::debug() << "Running kernel with global_work_size = "
                    << to_string(global_work_size)
                    << " and local_work_size = " << to_string(local_ws) << '\n';
+
+  std::vector<cl_mem> memory_objects;
+  auto it = kernel_memory_objects_.find(kernel.id);
+  if (it != kernel_memory_objects_.end()) {
+    for (const auto &[argument_index, memory_object] : it->second) {
+      memory_objects.push_back(memory_object);
+    }
+  }
+  const auto wait_list = cl_get_dependencies(memory_objects);
+
   cl_int result = wrapper_.clEnqueueNDRangeKernel(
       queues_[device], k, work_dim, global_work_offset.data(),
-      global_work_size.data(), local_ws.data(), 0, nullptr, nullptr);
+      global_work_size.data(), local_ws.data(),
+      static_cast<cl_uint>(wait_list.size()), get_wait_list(wait_list), event);
   if (result != CL_SUCCESS) {
     throw RuntimeException("Failed to enqueue OpenCL ND range kernel");
   }
+  if (event != nullptr) {
+    cl_set_last_use(device, memory_objects, *event);
+  }
+}
+
+std::array<size_t, 3> OpenCLRuntime::cl_get_local_work_size(
+    const std::array<size_t, 3> global_work_size,
+    const std::array<size_t, 3> *local_work_size) const {
+  if (local_work_size != nullptr) {
+    return *local_work_size;
+  }
+
+  const std::array<size_t, 3> max_limits = {
+      static_cast<size_t>(
+          get_device_property(DeviceProperty::max_group_size_x)),
+      static_cast<size_t>(
+          get_device_property(DeviceProperty::max_group_size_y)),
+      static_cast<size_t>(
+          get_device_property(DeviceProperty::max_group_size_z))};
+  const auto max_common_size = static_cast<size_t>(
+      get_device_property(DeviceProperty::max_total_group_size));
+  return get_max_local_work_size(global_work_size, max_limits,
+                                 max_common_size);
+}
+
+Event OpenCLRuntime::cl_track_event(int device, cl_event event) {
+  const std::uintptr_t id = next_event_id_++;
+  events_[id] = {device, event};
+  return {device, id};
+}
+
+OpenCLRuntime::RecordedGraph &
+OpenCLRuntime::cl_get_recording_graph(const CommandGraph &graph) {
+  RecordedGraph &recorded = command_graphs_.at(graph.id);
+  if (recorded.finalized) {
+    throw RuntimeException("Command graph has already been run");
+  }
+  return recorded;
+}
+
+void OpenCLRuntime::cl_release_graph(const RecordedGraph &recorded) {
+  for (const auto &step : recorded.steps) {
+    if (step.kernel != nullptr) {
+      wrapper_.clReleaseKernel(step.kernel);
+    }
+    if (step.command_buffer != nullptr) {
+      wrapper_.clReleaseCommandBufferKHR(step.command_buffer);
+    }
+  }
+}
+
+cl_command_queue OpenCLRuntime::cl_create_command_queue(const int device) {
+  std::vector<cl_queue_properties> properties;
+  if (queue_mode_ == OpenCLQueueMode::out_of_order) {
+    const auto queue_properties =
+        cl_get_device_property_at_index<cl_command_queue_properties>(
+            devices_[device], CL_DEVICE_QUEUE_ON_HOST_PROPERTIES, 0, 0);
+    if ((queue_properties & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) != 0) {
+      properties = {CL_QUEUE_PROPERTIES,
+                    CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, 0};
+    } else {
+      logging::warning() << "Out-of-order OpenCL command queues are not "
+                            "supported, using in-order queue\n";
+    }
+  }
 
-  result = wrapper_.clFinish(queues_[device]);
+  cl_int result = CL_SUCCESS;
+  cl_command_queue queue = wrapper_.clCreateCommandQueueWithProperties(
+      contexts_[device], devices_[device],
+      properties.empty() ? nullptr : properties.data(), &result);
   if (result != CL_SUCCESS) {
-    throw RuntimeException("Failed to finish OpenCL queue");
+    throw RuntimeException("Failed to create OpenCL command queue");
+  }
+  return queue;
+}
+
+std::vector<cl_event> OpenCLRuntime::cl_get_dependencies(
+    const std::vector<cl_mem> &memory_objects) const {
+  std::vector<cl_event> events;
+  for (cl_mem memory_object : memory_objects) {
+    auto it = memory_object_events_.find(memory_object);
+    if (it == memory_object_events_.end()) {
+      continue;
+    }
+    cl_event event = it->second.second;
+    if (std::find(events.begin(), events.end(), event) == events.end()) {
+      events.push_back(event);
+    }
+  }
+  return events;
+}
+
+void OpenCLRuntime::cl_set_last_use(int device,
+                                    const std::vector<cl_mem> &memory_objects,
+                                    cl_event event) {
+  // In-order queues already execute commands in submission order
+  if (queue_mode_ != OpenCLQueueMode::out_of_order) {
+    return;
+  }
+
+  for (cl_mem memory_object : memory_objects) {
+    cl_int result = wrapper_.clRetainEvent(event);
+    if (result != CL_SUCCESS) {
+      throw RuntimeException("Failed to retain OpenCL event");
+    }
+    auto [it, inserted] =
+        memory_object_events_.try_emplace(memory_object, device, event);
+    if (!inserted) {
+      wrapper_.clReleaseEvent(it->second.second);
+      it->second = {device, event};
+    }
+  }
+}
+
+void OpenCLRuntime::cl_release_last_use(cl_mem memory_object) {
+  auto it = memory_object_events_.find(memory_object);
+  if (it != memory_object_events_.end()) {
+    wrapper_.clReleaseEvent(it->second.second);
+    memory_object_events_.erase(it);
   }
 }
 
 void OpenCLRuntime::release_kernel(const Kernel &kernel) {
-  cl_kernel k = kernels_.at(kernel.id);
-  kernels_.erase(kernel.id);
+  cl_release_kernel(kernel.id);
+  auto it = kernel_programs_.find(kernel.id);
+  if (it != kernel_programs_.end()) {
+    const std::uintptr_t program = it->second;
+    kernel_programs_.erase(it);
+    cl_release_program(program);
+  }
+}
+
+void OpenCLRuntime::cl_release_program(std::uintptr_t id) {
+  for (const auto evicted : kernel_cache_.release(id)) {
+    cl_program p = programs_.at(evicted);
+    programs_.erase(evicted);
+    cl_int result = wrapper_.clReleaseProgram(p);
+    if (result != CL_SUCCESS) {
+      throw RuntimeException("Failed to release OpenCL program");
+    }
+  }
+}
+
+void OpenCLRuntime::cl_release_kernel(std::uintptr_t id) {
+  cl_kernel k = kernels_.at(id);
+  kernels_.erase(id);
+  kernel_memory_objects_.erase(id);
 
   cl_int result = wrapper_.clReleaseKernel(k);
   if (result != CL_SUCCESS) {
@@ -617,7 +1097,131 @@ void OpenCLRuntime::release_kernel(const Kernel &kernel) {
   }
 }
 
+CommandGraph OpenCLRuntime::create_command_graph(int device) {
+  if (device < 0 || device >= devices_.size()) {
+    throw RuntimeException("Invalid device");
+  }
+
+  const std::uintptr_t id = next_command_graph_id_++;
+  command_graphs_[id] = {};
+  return {device, id};
+}
+
+void OpenCLRuntime::append_write_buffer(const CommandGraph &graph,
+                                        const Buffer &buffer,
+                                        const void *data) {
+  RecordedGraph &recorded = cl_get_recording_graph(graph);
+  GraphStep step;
+  step.type = GraphStep::Type::write_buffer;
+  step.memory_object = buffers_.at(buffer.id);
+  step.size = buffer.size;
+  step.source = data;
+  recorded.steps.push_back(step);
+}
+
+void OpenCLRuntime::append_read_buffer(const CommandGraph &graph,
+                                       const Buffer &buffer, void *data) {
+  RecordedGraph &recorded = cl_get_recording_graph(graph);
+  GraphStep step;
+  step.type = GraphStep::Type::read_buffer;
+  step.memory_object = buffers_.at(buffer.id);
+  step.size = buffer.size;
+  step.destination = data;
+  recorded.steps.push_back(step);
+}
+
+void OpenCLRuntime::run_command_graph(const CommandGraph &graph) {
+  RecordedGraph &recorded = command_graphs_.at(graph.id);
+
+  cl_int result = CL_SUCCESS;
+  if (!recorded.finalized) {
+    for (const auto &step : recorded.steps) {
+      if (step.type != GraphStep::Type::command_buffer) {
+        continue;
+      }
+      result = wrapper_.clFinalizeCommandBufferKHR(step.command_buffer);
+      if (result != CL_SUCCESS) {
+        throw RuntimeException("Failed to finalize OpenCL command buffer");
+      }
+    }
+    recorded.finalized = true;
+  }
+
+  // Keep graph commands ordered after previously enqueued ones
+  finish(graph.device);
+
+  cl_command_queue queue = queues_[graph.device];
+  std::vector<cl_event> events;
+  events.reserve(recorded.steps.size());
+  auto f = finally([&]() {
+    for (cl_event event : events) {
+      wrapper_.clReleaseEvent(event);
+    }
+  });
+
+  for (const auto &step : recorded.steps) {
+    // Each step waits for the previous one, as the queue may be out-of-order
+    const cl_uint num_wait_events = events.empty() ? 0 : 1;
+    const cl_event *wait_list = events.empty() ? nullptr : &events.back();
+    cl_event event = nullptr;
+    switch (step.type) {
+    case GraphStep::Type::write_buffer:
+      result = wrapper_.clEnqueueWriteBuffer(
+          queue, step.memory_object, 0, 0, step.size, step.source,
+          num_wait_events, wait_list, &event);
+      break;
+    case GraphStep::Type::read_buffer:
+      result = wrapper_.clEnqueueReadBuffer(
+          queue, step.memory_object, 0, 0, step.size, step.destination,
+          num_wait_events, wait_list, &event);
+      break;
+    case GraphStep::Type::run_kernel:
+      result = wrapper_.clEnqueueNDRangeKernel(
+          queue, step.kernel, step.work_dim, nullptr,
+          step.global_work_size.data(), step.local_work_size.data(),
+          num_wait_events, wait_list, &event);
+      break;
+    case GraphStep::Type::command_buffer:
+      result = wrapper_.clEnqueueCommandBufferKHR(
+          1, &queue, step.command_buffer, num_wait_events, wait_list, &event);
+      break;
+    }
+    if (result != CL_SUCCESS) {
+      throw RuntimeException("Failed to enqueue OpenCL command graph");
+    }
+    events.push_back(event);
+  }
+
+  if (events.empty()) {
+    return;
+  }
+  result = wrapper_.clWaitForEvents(1, &events.back());
+  if (result != CL_SUCCESS) {
+    throw RuntimeException("Failed to wait for OpenCL events");
+  }
+}
+
+void OpenCLRuntime::release_command_graph(const CommandGraph &graph) {
+  const RecordedGraph recorded = command_graphs_.at(graph.id);
+  command_graphs_.erase(graph.id);
+  cl_release_graph(recorded);
+}
+
 bool OpenCLRuntime::is_feature_supported(const Feature feature) const {
+  if (device_info_.has_value()) {
+    return device_info_->is_feature_supported(feature);
+  }
+  return cl_query_feature(feature);
+}
+
+int OpenCLRuntime::get_device_property(const DeviceProperty property) const {
+  if (device_info_.has_value()) {
+    return device_info_->get_device_property(property);
+  }
+  return cl_query_device_property(property);
+}
+
+bool OpenCLRuntime::cl_query_feature(const Feature feature) const {
   switch (feature) {
   case Feature::fp16:
     return extensions_.contains("cl_khr_fp16");
@@ -772,7 +1376,8 @@ bool OpenCLRuntime::is_feature_supported(const Feature feature) const {
   }
 }
 
-int OpenCLRuntime::get_device_property(const DeviceProperty property) const {
+int OpenCLRuntime::cl_query_device_property(
+    const DeviceProperty property) const {
   switch (property) {
   case DeviceProperty::max_group_size_x:
     return static_cast<int>(cl_get_device_property_at_index<size_t>(
@@ -956,8 +1561,19 @@ std::vector<uint8_t> OpenCLRuntime::create_program_and_get_native_binary(
     }
     throw RuntimeException("Failed to build OpenCL program");
   }
+  auto binary = cl_get_program_binary(program);
+
+  result = wrapper_.clReleaseProgram(program);
+  if (result != CL_SUCCESS) {
+    throw RuntimeException("Failed to release OpenCL program");
+  }
+  return binary;
+}
+
+std::vector<uint8_t>
+OpenCLRuntime::cl_get_program_binary(const cl_program &program) const {
   cl_uint num_devices_associated_with_program = 0;
-  result = wrapper_.clGetProgramInfo(
+  cl_int result = wrapper_.clGetProgramInfo(
       program, CL_PROGRAM_NUM_DEVICES, sizeof(cl_uint),
       &num_devices_associated_with_program, nullptr);
   if (CL_SUCCESS != result) {
@@ -981,9 +1597,8 @@ std::vector<uint8_t> OpenCLRuntime::create_program_and_get_native_binary(
         "Failed to get CL_PROGRAM_DEVICES from clGetProgramInfo");
   }
 
-  std::vector<cl_device_id>::iterator it;
-  it = std::find(devices_associated_with_program.begin(),
-                 devices_associated_with_program.end(), devices_[0]);
+  auto it = std::find(devices_associated_with_program.begin(),
+                      devices_associated_with_program.end(), devices_[0]);
   if (it == devices_associated_with_program.end()) {
     throw RuntimeException(
         "Given device not associated with compiled program.");
@@ -1001,26 +1616,52 @@ std::vector<uint8_t> OpenCLRuntime::create_program_and_get_native_binary(
   }
 
   std::vector<std::vector<uint8_t>> all_programs_bytes;
-  size_t all_programs_sizes = 0;
+  std::vector<uint8_t *> all_programs_pointers;
   for (auto &each_size : binary_sizes) {
-    all_programs_sizes += each_size;
-    std::vector<uint8_t> allocate_bytes;
-    allocate_bytes.resize(each_size);
-    all_programs_bytes.push_back(allocate_bytes);
+    all_programs_bytes.emplace_back(each_size);
   }
-  result = wrapper_.clGetProgramInfo(program, CL_PROGRAM_BINARIES,
-                                     all_programs_sizes,
-                                     all_programs_bytes.data(), nullptr);
+  for (auto &each_program_bytes : all_programs_bytes) {
+    all_programs_pointers.push_back(each_program_bytes.data());
+  }
+  result = wrapper_.clGetProgramInfo(
+      program, CL_PROGRAM_BINARIES,
+      sizeof(uint8_t *) * all_programs_pointers.size(),
+      all_programs_pointers.data(), nullptr);
 
   if (result != CL_SUCCESS) {
     throw RuntimeException(
         "Failed to get CL_PROGRAM_BINARIES from clGetProgramInfo");
   }
-  result = wrapper_.clReleaseProgram(program);
+  return all_programs_bytes[device_index];
+}
 
-  if (result != CL_SUCCESS) {
-    throw RuntimeException("Failed to release OpenCL program");
+cl_program OpenCLRuntime::cl_create_program_from_binary(
+    const std::vector<uint8_t> &binary) {
+  const unsigned char *binary_data = binary.data();
+  const size_t binary_size = binary.size();
+  cl_int binary_status = CL_SUCCESS;
+  cl_int result = CL_SUCCESS;
+  cl_program program = wrapper_.clCreateProgramWithBinary(
+      contexts_[0], 1, &devices_[0], &binary_size, &binary_data,
+      &binary_status, &result);
+  if (result != CL_SUCCESS || binary_status != CL_SUCCESS) {
+    // Stale cache entries, e.g. from a different driver, are rebuilt
+    logging::debug() << "Failed to create OpenCL program from binary\n";
+    if (program != nullptr) {
+      wrapper_.clReleaseProgram(program);
+    }
+    return nullptr;
   }
-  return all_programs_bytes[device_index];
+  return program;
+}
+
+std::string OpenCLRuntime::cl_get_device_identity() const {
+  const auto device_name =
+      cl_get_device_property<char>(devices_[0], CL_DEVICE_NAME);
+  const auto driver_version =
+      cl_get_device_property<char>(devices_[0], CL_DRIVER_VERSION);
+  return std::string(device_name.data()) + ";" +
+         std::string(driver_version.data()) + ";" +
+         std::to_string(get_device_property(DeviceProperty::ip_version));
 }
 } // namespace cassian
@@ -11,34 +11,60 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <CL/cl.h>
 #include <CL/cl_platform.h>
 
 #include <cassian/runtime/access_qualifier.hpp>
+#include <cassian/runtime/device_info.hpp>
 #include <cassian/runtime/device_properties.hpp>
 #include <cassian/runtime/feature.hpp>
+#include <cassian/runtime/memory_kind.hpp>
 #include <cassian/runtime/program_descriptor.hpp>
 #include <cassian/runtime/runtime.hpp>
+#include <cassian/runtime/runtime_caches.hpp>
 
 #include "opencl_wrapper.hpp"
 
 namespace cassian {
-class OpenCLRuntime : public Runtime {
+
+/**
+ * Execution mode of OpenCL command queues.
+ */
+enum class OpenCLQueueMode {
+  /**
+   * In-order queue, one per device.
+   */
+  in_order,
+  /**
+   * Out-of-order queue, one per device. Commands using the same memory object
+   * are ordered with events.
+   */
+  out_of_order
+};
+
+class OpenCLRuntime : public Runtime, public RuntimeCaches {
 public:
+  OpenCLRuntime() = default;
+  explicit OpenCLRuntime(OpenCLQueueMode queue_mode);
   void initialize() override;
   void initialize_subdevices() override;
   ~OpenCLRuntime();
 
   int get_subdevice(int root_device, int subdevice) override;
   int get_subdevice_count(int root_device) override;
+  int get_root_device_count() override;
   Buffer create_buffer(int device, size_t size,
                        AccessQualifier access) override;
+  Buffer create_buffer(int device, size_t size, AccessQualifier access,
+                       MemoryKind memory_kind) override;
   Image create_image(const ImageDimensions dim, const ImageType type,
                      const ImageFormat format, const ImageChannelOrder order,
                      AccessQualifier access) override;
@@ -51,7 +77,14 @@ public:
   void read_image(const Image &image, void *data) override;
   void write_buffer(const Buffer &buffer, const void *data) override;
   void write_image(const Image &image, const void *data) override;
+  Event enqueue_read_buffer(const Buffer &buffer, void *data) override;
+  Event enqueue_write_buffer(const Buffer &buffer, const void *data) override;
+  void wait(const std::vector<Event> &events) override;
+  void finish(int device) override;
+  void *map_buffer(const Buffer &buffer, AccessQualifier access) override;
+  void unmap_buffer(const Buffer &buffer) override;
   void release_buffer(const Buffer &buffer) override;
+  void trim_buffer_pool() override;
   void release_image(const Image &image) override;
   void release_sampler(const Sampler &sampler) override;
 
@@ -73,6 +106,14 @@ public:
                            const Sampler &sampler) override;
   void release_kernel(const Kernel &kernel) override;
 
+  CommandGraph create_command_graph(int device) override;
+  void append_write_buffer(const CommandGraph &graph, const Buffer &buffer,
+                           const void *data) override;
+  void append_read_buffer(const CommandGraph &graph, const Buffer &buffer,
+                          void *data) override;
+  void run_command_graph(const CommandGraph &graph) override;
+  void release_command_graph(const CommandGraph &graph) override;
+
   bool is_feature_supported(Feature feature) const override;
   int get_device_property(DeviceProperty property) const override;
   std::string name() const override;
@@ -87,6 +128,13 @@ protected:
   void run_kernel_common(int device, const Kernel &kernel,
                          std::array<size_t, 3> global_work_size,
                          const std::array<size_t, 3> *local_work_size) override;
+  Event enqueue_run_kernel_common(
+      int device, const Kernel &kernel, std::array<size_t, 3> global_work_size,
+      const std::array<size_t, 3> *local_work_size) override;
+  void append_run_kernel_common(
+      const CommandGraph &graph, const Kernel &kernel,
+      std::array<size_t, 3> global_work_size,
+      const std::array<size_t, 3> *local_work_size) override;
 
   OpenCLWrapper wrapper_;
 
@@ -95,15 +143,52 @@ protected:
   std::vector<cl_command_queue> queues_;
 
   std::unordered_map<std::uintptr_t, cl_mem> buffers_;
+  std::unordered_map<std::uintptr_t, void *> mapped_buffers_;
   std::unordered_map<std::uintptr_t, cl_mem> images_;
   std::unordered_map<std::uintptr_t, cl_kernel> kernels_;
+  std::unordered_map<std::uintptr_t, cl_program> programs_;
+  std::unordered_map<std::uintptr_t, std::uintptr_t> kernel_programs_;
   std::unordered_map<std::uintptr_t, cl_sampler> samplers_;
+  std::unordered_map<std::uintptr_t, std::pair<int, cl_event>> events_;
+  std::uintptr_t next_event_id_ = 1;
+
+  OpenCLQueueMode queue_mode_ = OpenCLQueueMode::in_order;
+  std::unordered_map<cl_mem, std::pair<int, cl_event>> memory_object_events_;
+  std::unordered_map<std::uintptr_t, std::unordered_map<int, cl_mem>>
+      kernel_memory_objects_;
+
+  struct GraphStep {
+    enum class Type { write_buffer, read_buffer, run_kernel, command_buffer };
+
+    Type type = Type::run_kernel;
+    cl_mem memory_object = nullptr;
+    size_t size = 0;
+    const void *source = nullptr;
+    void *destination = nullptr;
+    cl_kernel kernel = nullptr;
+    cl_uint work_dim = 1;
+    std::array<size_t, 3> global_work_size = {1, 1, 1};
+    std::array<size_t, 3> local_work_size = {1, 1, 1};
+    cl_command_buffer command_buffer = nullptr;
+    std::optional<cl_sync_point> sync_point;
+  };
+
+  struct RecordedGraph {
+    std::vector<GraphStep> steps;
+    bool finalized = false;
+  };
+
+  std::unordered_map<std::uintptr_t, RecordedGraph> command_graphs_;
+  std::uintptr_t next_command_graph_id_ = 1;
 
   std::unordered_set<std::string> extensions_;
 
   std::vector<int> subdevice_offsets_;
   int root_devices_count_ = 0;
 
+  std::optional<DeviceInfo> device_info_;
+  std::string device_identity_;
+
   template <class T>
   std::vector<T> cl_get_device_property(cl_device_id device,
                                         cl_device_info param_name) const {
@@ -146,9 +231,38 @@ protected:
   }
 
   std::string cl_get_program_build_info(const cl_program &program) const;
+  cl_command_queue cl_create_command_queue(int device);
+  std::vector<cl_event>
+  cl_get_dependencies(const std::vector<cl_mem> &memory_objects) const;
+  void cl_set_last_use(int device, const std::vector<cl_mem> &memory_objects,
+                       cl_event event);
+  void cl_release_last_use(cl_mem memory_object);
+  std::array<size_t, 3>
+  cl_get_local_work_size(std::array<size_t, 3> global_work_size,
+                         const std::array<size_t, 3> *local_work_size) const;
+  void cl_enqueue_kernel(int device, const Kernel &kernel,
+                         std::array<size_t, 3> global_work_size,
+                         const std::array<size_t, 3> *local_work_size,
+                         cl_event *event);
+  Event cl_track_event(int device, cl_event event);
+  RecordedGraph &cl_get_recording_graph(const CommandGraph &graph);
+  void cl_release_graph(const RecordedGraph &recorded);
   cl_program cl_create_program(const std::string &source,
                                const std::string &compile_options,
                                const std::string &program_type, bool quiet);
+  bool cl_query_feature(Feature feature) const;
+  int cl_query_device_property(DeviceProperty property) const;
+  cl_program cl_build_program(const std::string &source,
+                              const std::string &build_options,
+                              const std::string &program_type,
+                              const std::optional<std::string> &spirv_options,
+                              bool quiet);
+  void cl_release_program(std::uintptr_t id);
+  void cl_release_kernel(std::uintptr_t id);
+  void cl_release_buffer(std::uintptr_t id);
+  cl_program cl_create_program_from_binary(const std::vector<uint8_t> &binary);
+  std::vector<uint8_t> cl_get_program_binary(const cl_program &program) const;
+  std::string cl_get_device_identity() const;
 };
 
 } // namespace cassian
@@ -41,6 +41,8 @@ OpenCLWrapper::OpenCLWrapper() {
       library_->get_function("clCreateProgramWithSource"));
   clCreateProgramWithIL = reinterpret_cast<clCreateProgramWithIL_t *>(
       library_->get_function("clCreateProgramWithIL"));
+  clCreateProgramWithBinary = reinterpret_cast<clCreateProgramWithBinary_t *>(
+      library_->get_function("clCreateProgramWithBinary"));
   clReleaseProgram = reinterpret_cast<clReleaseProgram_t *>(
       library_->get_function("clReleaseProgram"));
   clBuildProgram = reinterpret_cast<clBuildProgram_t *>(
@@ -54,12 +56,22 @@ OpenCLWrapper::OpenCLWrapper() {
   clSetKernelArg = reinterpret_cast<clSetKernelArg_t *>(
       library_->get_function("clSetKernelArg"));
   clFinish = reinterpret_cast<clFinish_t *>(library_->get_function("clFinish"));
+  clWaitForEvents = reinterpret_cast<clWaitForEvents_t *>(
+      library_->get_function("clWaitForEvents"));
+  clRetainEvent = reinterpret_cast<clRetainEvent_t *>(
+      library_->get_function("clRetainEvent"));
+  clReleaseEvent = reinterpret_cast<clReleaseEvent_t *>(
+      library_->get_function("clReleaseEvent"));
   clEnqueueReadBuffer = reinterpret_cast<clEnqueueReadBuffer_t *>(
       library_->get_function("clEnqueueReadBuffer"));
   clEnqueueReadImage = reinterpret_cast<clEnqueueReadImage_t *>(
       library_->get_function("clEnqueueReadImage"));
   clEnqueueWriteImage = reinterpret_cast<clEnqueueWriteImage_t *>(
       library_->get_function("clEnqueueWriteImage"));
+  clEnqueueMapBuffer = reinterpret_cast<clEnqueueMapBuffer_t *>(
+      library_->get_function("clEnqueueMapBuffer"));
+  clEnqueueUnmapMemObject = reinterpret_cast<clEnqueueUnmapMemObject_t *>(
+      library_->get_function("clEnqueueUnmapMemObject"));
   clEnqueueWriteBuffer = reinterpret_cast<clEnqueueWriteBuffer_t *>(
       library_->get_function("clEnqueueWriteBuffer"));
   clEnqueueNDRangeKernel = reinterpret_cast<clEnqueueNDRangeKernel_t *>(
@@ -80,5 +92,44 @@ OpenCLWrapper::OpenCLWrapper() {
       library_->get_function("clGetProgramInfo"));
   clCreateSubDevices = reinterpret_cast<clCreateSubDevices_t *>(
       library_->get_function("clCreateSubDevices"));
+  clGetExtensionFunctionAddressForPlatform =
+      reinterpret_cast<clGetExtensionFunctionAddressForPlatform_t *>(
+          library_->get_function("clGetExtensionFunctionAddressForPlatform"));
+
+  try {
+    clCloneKernel = reinterpret_cast<clCloneKernel_t *>(
+        library_->get_function("clCloneKernel"));
+  } catch (LibraryFunctionNotFoundException &e) {
+    clCloneKernel = nullptr;
+  }
+}
+
+void OpenCLWrapper::load_command_buffer_functions(cl_platform_id platform) {
+  auto get_function = [&](const char *name) {
+    return clGetExtensionFunctionAddressForPlatform(platform, name);
+  };
+  clCreateCommandBufferKHR = reinterpret_cast<clCreateCommandBufferKHR_t *>(
+      get_function("clCreateCommandBufferKHR"));
+  clFinalizeCommandBufferKHR = reinterpret_cast<clFinalizeCommandBufferKHR_t *>(
+      get_function("clFinalizeCommandBufferKHR"));
+  clReleaseCommandBufferKHR = reinterpret_cast<clReleaseCommandBufferKHR_t *>(
+      get_function("clReleaseCommandBufferKHR"));
+  clEnqueueCommandBufferKHR = reinterpret_cast<clEnqueueCommandBufferKHR_t *>(
+      get_function("clEnqueueCommandBufferKHR"));
+  clCommandNDRangeKernelKHR = reinterpret_cast<clCommandNDRangeKernelKHR_t *>(
+      get_function("clCommandNDRangeKernelKHR"));
+
+  // Functions are used only if the whole subset is available
+  if (clCreateCommandBufferKHR == nullptr ||
+      clFinalizeCommandBufferKHR == nullptr ||
+      clReleaseCommandBufferKHR == nullptr ||
+      clEnqueueCommandBufferKHR == nullptr ||
+      clCommandNDRangeKernelKHR == nullptr) {
+    clCreateCommandBufferKHR = nullptr;
+    clFinalizeCommandBufferKHR = nullptr;
+    clReleaseCommandBufferKHR = nullptr;
+    clEnqueueCommandBufferKHR = nullptr;
+    clCommandNDRangeKernelKHR = nullptr;
+  }
 }
 } // namespace cassian
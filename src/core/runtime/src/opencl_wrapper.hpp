@@ -27,6 +27,32 @@ typedef cl_bitfield cl_device_fp_atomic_capabilities_ext;
 #define CL_DEVICE_LOCAL_FP_ATOMIC_MIN_MAX_EXT (1 << 18)
 
 namespace cassian {
+
+// Subset of cl_khr_command_buffer, declared here as older OpenCL headers do not
+// provide it
+struct _cl_command_buffer;
+typedef struct _cl_command_buffer *cl_command_buffer;
+typedef cl_uint cl_sync_point;
+
+typedef cl_command_buffer CL_API_CALL
+clCreateCommandBufferKHR_t(cl_uint num_queues, const cl_command_queue *queues,
+                           const cl_ulong *properties, cl_int *errcode_ret);
+typedef cl_int CL_API_CALL
+clFinalizeCommandBufferKHR_t(cl_command_buffer command_buffer);
+typedef cl_int CL_API_CALL
+clReleaseCommandBufferKHR_t(cl_command_buffer command_buffer);
+typedef cl_int CL_API_CALL clEnqueueCommandBufferKHR_t(
+    cl_uint num_queues, cl_command_queue *queues,
+    cl_command_buffer command_buffer, cl_uint num_events_in_wait_list,
+    const cl_event *event_wait_list, cl_event *event);
+typedef cl_int CL_API_CALL clCommandNDRangeKernelKHR_t(
+    cl_command_buffer command_buffer, cl_command_queue command_queue,
+    const cl_ulong *properties, cl_kernel kernel, cl_uint work_dim,
+    const size_t *global_work_offset, const size_t *global_work_size,
+    const size_t *local_work_size, cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point *sync_point_wait_list, cl_sync_point *sync_point,
+    void **mutable_handle);
+
 class OpenCLWrapper {
 public:
   OpenCLWrapper();
@@ -47,6 +73,7 @@ public:
   clReleaseMemObject_t *clReleaseMemObject = nullptr;
   clCreateProgramWithSource_t *clCreateProgramWithSource = nullptr;
   clCreateProgramWithIL_t *clCreateProgramWithIL = nullptr;
+  clCreateProgramWithBinary_t *clCreateProgramWithBinary = nullptr;
   clReleaseProgram_t *clReleaseProgram = nullptr;
   clBuildProgram_t *clBuildProgram = nullptr;
   clGetProgramBuildInfo_t *clGetProgramBuildInfo = nullptr;
@@ -54,11 +81,16 @@ public:
   clReleaseKernel_t *clReleaseKernel = nullptr;
   clSetKernelArg_t *clSetKernelArg = nullptr;
   clFinish_t *clFinish = nullptr;
+  clWaitForEvents_t *clWaitForEvents = nullptr;
+  clRetainEvent_t *clRetainEvent = nullptr;
+  clReleaseEvent_t *clReleaseEvent = nullptr;
   clEnqueueReadBuffer_t *clEnqueueReadBuffer = nullptr;
   clEnqueueWriteBuffer_t *clEnqueueWriteBuffer = nullptr;
   clEnqueueNDRangeKernel_t *clEnqueueNDRangeKernel = nullptr;
   clEnqueueReadImage_t *clEnqueueReadImage = nullptr;
   clEnqueueWriteImage_t *clEnqueueWriteImage = nullptr;
+  clEnqueueMapBuffer_t *clEnqueueMapBuffer = nullptr;
+  clEnqueueUnmapMemObject_t *clEnqueueUnmapMemObject = nullptr;
   clReleaseContext_t *clReleaseContext = nullptr;
   clReleaseCommandQueue_t *clReleaseCommandQueue = nullptr;
   clCreateSampler_t *clCreateSampler = nullptr;
@@ -67,6 +99,16 @@ public:
   clLinkProgram_t *clLinkProgram = nullptr;
   clGetProgramInfo_t *clGetProgramInfo = nullptr;
   clCreateSubDevices_t *clCreateSubDevices = nullptr;
+  clGetExtensionFunctionAddressForPlatform_t
+      *clGetExtensionFunctionAddressForPlatform = nullptr;
+  clCloneKernel_t *clCloneKernel = nullptr;
+  clCreateCommandBufferKHR_t *clCreateCommandBufferKHR = nullptr;
+  clFinalizeCommandBufferKHR_t *clFinalizeCommandBufferKHR = nullptr;
+  clReleaseCommandBufferKHR_t *clReleaseCommandBufferKHR = nullptr;
+  clEnqueueCommandBufferKHR_t *clEnqueueCommandBufferKHR = nullptr;
+  clCommandNDRangeKernelKHR_t *clCommandNDRangeKernelKHR = nullptr;
+
+  void load_command_buffer_functions(cl_platform_id platform);
 
 private:
   std::unique_ptr<Library> library_;
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <algorithm>
+#include <cassian/runtime/precompiled_kernels.hpp>
+#include <cassian/runtime/runtime.hpp>
+#include <cassian/utility/utility.hpp>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cassian {
+
+PrecompiledKernels::PrecompiledKernels(const std::string &index_path) {
+  std::ifstream stream(index_path);
+  if (!stream.good()) {
+    throw RuntimeException("Failed to read precompiled kernels index: " +
+                           index_path);
+  }
+
+  const fs::path directory = fs::path(index_path).parent_path();
+  std::string line;
+  while (std::getline(stream, line)) {
+    std::vector<std::string> fields;
+    size_t begin = 0;
+    for (int i = 0; i < 3; i++) {
+      const size_t end = line.find('\t', begin);
+      if (end == std::string::npos) {
+        break;
+      }
+      fields.push_back(line.substr(begin, end - begin));
+      begin = end + 1;
+    }
+    if (fields.size() != 3) {
+      continue;
+    }
+
+    Entry entry;
+    entry.device = fields[0];
+    entry.source_path = (directory / fields[1]).string();
+    entry.binary_path = (directory / fields[2]).string();
+    entry.build_options = normalize_build_options(line.substr(begin));
+    entries_.push_back(entry);
+  }
+}
+
+std::optional<std::vector<uint8_t>>
+PrecompiledKernels::find(int ip_version, const std::string &source,
+                         const std::string &build_options) {
+  const std::string device = std::to_string(ip_version);
+  const std::string options = normalize_build_options(build_options);
+  for (const auto &entry : entries_) {
+    if (entry.device != device || entry.build_options != options) {
+      continue;
+    }
+    auto it = sources_.find(entry.source_path);
+    if (it == sources_.end()) {
+      it = sources_
+               .emplace(entry.source_path, load_text_file(entry.source_path))
+               .first;
+    }
+    if (it->second != source) {
+      continue;
+    }
+
+    // Binaries which failed to compile are stored as empty files
+    auto binary = load_binary_file(entry.binary_path);
+    if (binary.empty()) {
+      return std::nullopt;
+    }
+    return binary;
+  }
+  return std::nullopt;
+}
+
+size_t PrecompiledKernels::size() const { return entries_.size(); }
+
+bool PrecompiledKernels::is_applicable(
+    const std::string &program_type,
+    const std::optional<std::string> &spirv_options) {
+  return (program_type == "source" || program_type == "spirv") &&
+         !spirv_options.has_value();
+}
+
+std::string normalize_build_options(const std::string &build_options) {
+  std::vector<std::string> options;
+  std::string option;
+  bool quoted = false;
+  bool has_option = false;
+  for (const char c : build_options) {
+    if (c == '"') {
+      quoted = !quoted;
+      has_option = true;
+    } else if (!quoted && std::isspace(static_cast<unsigned char>(c)) != 0) {
+      if (has_option) {
+        options.push_back(option);
+        option.clear();
+        has_option = false;
+      }
+    } else {
+      option += c;
+      has_option = true;
+    }
+  }
+  if (has_option) {
+    options.push_back(option);
+  }
+
+  std::string normalized;
+  for (const auto &o : options) {
+    if (!normalized.empty()) {
+      normalized += ' ';
+    }
+    const bool has_space =
+        std::any_of(o.begin(), o.end(), [](unsigned char c) {
+          return std::isspace(c) != 0;
+        });
+    normalized += has_space ? '"' + o + '"' : o;
+  }
+  return normalized;
+}
+
+} // namespace cassian
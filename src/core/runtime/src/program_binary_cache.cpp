@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cassian/logging/logging.hpp>
+#include <cassian/runtime/program_binary_cache.hpp>
+#include <cassian/runtime/runtime.hpp>
+#include <cassian/utility/utility.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace cassian {
+
+ProgramBinaryCache::ProgramBinaryCache(std::string directory)
+    : directory_(std::move(directory)) {
+  std::error_code error;
+  fs::create_directories(directory_, error);
+  if (error) {
+    throw RuntimeException("Failed to create kernel cache directory: " +
+                           directory_);
+  }
+}
+
+ProgramBinaryCache::~ProgramBinaryCache() {
+  if (hits_ + misses_ > 0) {
+    logging::info() << "Kernel cache: " << hits_ << " hits, " << misses_
+                    << " misses\n";
+  }
+}
+
+std::optional<std::vector<uint8_t>>
+ProgramBinaryCache::load(const std::string &key) {
+  auto binary = load_cache_entry(entry_path(key), key);
+  if (binary.has_value()) {
+    hits_++;
+  } else {
+    misses_++;
+  }
+  return binary;
+}
+
+void ProgramBinaryCache::store(const std::string &key,
+                               const std::vector<uint8_t> &binary) {
+  const std::string path = entry_path(key);
+  if (!save_cache_entry(path, key, binary)) {
+    logging::warning() << "Failed to store kernel cache entry: " << path
+                       << '\n';
+  }
+}
+
+size_t ProgramBinaryCache::hits() const { return hits_; }
+
+size_t ProgramBinaryCache::misses() const { return misses_; }
+
+std::string ProgramBinaryCache::entry_path(const std::string &key) const {
+  std::stringstream ss;
+  ss << std::hex << fnv1a_hash(key) << ".bin";
+  return (fs::path(directory_) / ss.str()).string();
+}
+
+std::string
+program_binary_cache_key(const std::vector<std::string> &components) {
+  std::string key;
+  for (const auto &component : components) {
+    key += std::to_string(component.size());
+    key += ':';
+    key += component;
+  }
+  return key;
+}
+
+} // namespace cassian
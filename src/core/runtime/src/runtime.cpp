@@ -5,12 +5,16 @@
  *
  */
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include <cassian/fp_types/bfloat16.hpp>
 #include <cassian/fp_types/half.hpp>
+#include <cassian/runtime/access_qualifier.hpp>
+#include <cassian/runtime/memory_kind.hpp>
 #include <cassian/runtime/runtime.hpp>
 
 namespace cassian {
@@ -92,6 +96,92 @@ void Runtime::write_buffer_from_vector(const Buffer &buffer,
 
 Sampler::Sampler(std::uintptr_t id) : id(id) {}
 
+Event::Event(int device, std::uintptr_t id) : device(device), id(id) {}
+
+CommandGraph::CommandGraph(int device, std::uintptr_t id)
+    : device(device), id(id) {}
+
+int Runtime::get_root_device_count() { return 1; }
+
+Buffer Runtime::create_buffer(int device, size_t size, AccessQualifier access,
+                              MemoryKind memory_kind) {
+  if (memory_kind != MemoryKind::device) {
+    throw RuntimeException("Memory kind is not supported by runtime: " +
+                           name());
+  }
+  return create_buffer(device, size, access);
+}
+
+Event Runtime::enqueue_read_buffer(const Buffer &buffer, void *data) {
+  read_buffer(buffer, data);
+  return Event(buffer.device, 0);
+}
+
+Event Runtime::enqueue_write_buffer(const Buffer &buffer, const void *data) {
+  write_buffer(buffer, data);
+  return Event(buffer.device, 0);
+}
+
+void Runtime::wait(const std::vector<Event> & /*events*/) {}
+
+void Runtime::finish(int /*device*/) {}
+
+void *Runtime::map_buffer(const Buffer & /*buffer*/,
+                          AccessQualifier /*access*/) {
+  throw RuntimeException("Buffer mapping is not supported by runtime: " +
+                         name());
+}
+
+void Runtime::unmap_buffer(const Buffer & /*buffer*/) {
+  throw RuntimeException("Buffer mapping is not supported by runtime: " +
+                         name());
+}
+
+void Runtime::trim_buffer_pool() {}
+
+CommandGraph Runtime::create_command_graph(int /*device*/) {
+  throw RuntimeException("Command graphs are not supported by runtime: " +
+                         name());
+}
+
+void Runtime::append_write_buffer(const CommandGraph & /*graph*/,
+                                  const Buffer & /*buffer*/,
+                                  const void * /*data*/) {
+  throw RuntimeException("Command graphs are not supported by runtime: " +
+                         name());
+}
+
+void Runtime::append_read_buffer(const CommandGraph & /*graph*/,
+                                 const Buffer & /*buffer*/, void * /*data*/) {
+  throw RuntimeException("Command graphs are not supported by runtime: " +
+                         name());
+}
+
+void Runtime::run_command_graph(const CommandGraph & /*graph*/) {
+  throw RuntimeException("Command graphs are not supported by runtime: " +
+                         name());
+}
+
+void Runtime::release_command_graph(const CommandGraph & /*graph*/) {
+  throw RuntimeException("Command graphs are not supported by runtime: " +
+                         name());
+}
+
+Event Runtime::enqueue_run_kernel_common(
+    int device, const Kernel &kernel, std::array<size_t, 3> global_work_size,
+    const std::array<size_t, 3> *local_work_size) {
+  run_kernel_common(device, kernel, global_work_size, local_work_size);
+  return Event(device, 0);
+}
+
+void Runtime::append_run_kernel_common(
+    const CommandGraph & /*graph*/, const Kernel & /*kernel*/,
+    std::array<size_t, 3> /*global_work_size*/,
+    const std::array<size_t, 3> * /*local_work_size*/) {
+  throw RuntimeException("Command graphs are not supported by runtime: " +
+                         name());
+}
+
 template <> std::string to_cm_string<int8_t>() { return "char"; }
 template <> std::string to_cm_string<int16_t>() { return "short"; }
 template <> std::string to_cm_string<int32_t>() { return "int"; }
@@ -9,8 +9,11 @@
 #define CASSIAN_SYSTEM_FACTORY_HPP
 
 #include <cassian/system/library.hpp>
+#include <cassian/system/process.hpp>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 /**
  * Cassian namespace.
@@ -32,5 +35,24 @@ namespace cassian {
  */
 std::unique_ptr<Library> load_library(const std::string &name);
 
+/**
+ * Start a child process.
+ *
+ * Child process inherits environment of the calling process extended by
+ * `environment` variables.
+ *
+ * @param[in] arguments path to an executable followed by its arguments.
+ * @param[in] environment additional environment variables.
+ * @param[in] output_path file to redirect standard output and error to. Output
+ * is inherited if empty.
+ * @returns pointer to an object implementing cassian::Process interface.
+ * @throws cassian::ProcessException Thrown if process could not be started.
+ * @note process is waited for when pointer is freed.
+ */
+std::unique_ptr<Process> start_process(
+    const std::vector<std::string> &arguments,
+    const std::vector<std::pair<std::string, std::string>> &environment = {},
+    const std::string &output_path = std::string());
+
 } // namespace cassian
 #endif
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_SYSTEM_PROCESS_HPP
+#define CASSIAN_SYSTEM_PROCESS_HPP
+
+#include <stdexcept>
+
+/**
+ * Cassian namespace.
+ */
+namespace cassian {
+
+/**
+ * Interface for a system specific, child process management.
+ */
+class Process {
+public:
+  /**
+   * Default constructor.
+   */
+  Process() = default;
+
+  /**
+   * Virtual destructor.
+   */
+  virtual ~Process() = default;
+
+  /**
+   * Wait for the process to finish.
+   *
+   * @returns process exit code.
+   * @throws cassian::ProcessException Thrown if waiting for the process
+   * failed.
+   */
+  virtual int wait() = 0;
+
+  /**
+   * Forcibly stop the process. Process must still be waited for. Does nothing
+   * if the process has already been waited for.
+   */
+  virtual void terminate() = 0;
+
+private:
+  Process(const Process &) = default;
+  Process(Process &&) = default;
+  Process &operator=(const Process &) = default;
+  Process &operator=(Process &&) = default;
+};
+
+/**
+ * Exception class used when a process cannot be started or waited for.
+ */
+class ProcessException : public std::runtime_error {
+  using std::runtime_error::runtime_error;
+};
+
+} // namespace cassian
+#endif
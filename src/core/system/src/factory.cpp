@@ -7,13 +7,18 @@
 
 #include <cassian/system/factory.hpp>
 #include <cassian/system/library.hpp>
+#include <cassian/system/process.hpp>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #if defined(_WIN32)
 #include <library_windows.hpp>
+#include <process_windows.hpp>
 #elif defined(__linux__)
 #include <library_linux.hpp>
+#include <process_linux.hpp>
 #endif
 
 namespace cassian {
@@ -26,4 +31,15 @@ std::unique_ptr<Library> load_library(const std::string &name) {
 #endif
 }
 
+std::unique_ptr<Process> start_process(
+    const std::vector<std::string> &arguments,
+    const std::vector<std::pair<std::string, std::string>> &environment,
+    const std::string &output_path) {
+#if defined(_WIN32)
+  return std::make_unique<ProcessWindows>(arguments, environment, output_path);
+#elif defined(__linux__)
+  return std::make_unique<ProcessLinux>(arguments, environment, output_path);
+#endif
+}
+
 } // namespace cassian
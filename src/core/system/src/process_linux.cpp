@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <algorithm>
+#include <cassian/system/process.hpp>
+#include <cerrno>
+#include <cstdlib>
+#include <fcntl.h>
+#include <process_linux.hpp>
+#include <signal.h>
+#include <string>
+#include <string_view>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace cassian {
+
+ProcessLinux::ProcessLinux(
+    const std::vector<std::string> &arguments,
+    const std::vector<std::pair<std::string, std::string>> &environment,
+    const std::string &output_path) {
+  if (arguments.empty()) {
+    throw ProcessException("Failed to start process: empty command");
+  }
+
+  // Prepare everything before fork, only async-signal-safe calls are allowed
+  // in the child.
+  std::vector<char *> argv;
+  argv.reserve(arguments.size() + 1);
+  for (const auto &argument : arguments) {
+    argv.push_back(const_cast<char *>(argument.c_str()));
+  }
+  argv.push_back(nullptr);
+
+  // Inherited variables are dropped if overridden, duplicates would make the
+  // child read the parent's value
+  std::vector<std::string> variables;
+  for (char **variable = environ; *variable != nullptr; variable++) {
+    const std::string_view inherited(*variable);
+    const auto name = inherited.substr(0, inherited.find('='));
+    const bool overridden = std::any_of(
+        environment.begin(), environment.end(),
+        [&](const auto &entry) { return entry.first == name; });
+    if (!overridden) {
+      variables.emplace_back(inherited);
+    }
+  }
+  for (const auto &[name, value] : environment) {
+    variables.push_back(name + "=" + value);
+  }
+  std::vector<char *> envp;
+  envp.reserve(variables.size() + 1);
+  for (const auto &variable : variables) {
+    envp.push_back(const_cast<char *>(variable.c_str()));
+  }
+  envp.push_back(nullptr);
+
+  // Processes may be started from several threads at once, so the descriptor
+  // must not leak into children forked by other threads. dup2 clears the flag
+  // on standard streams of this child.
+  int output = -1;
+  if (!output_path.empty()) {
+    output = open(output_path.c_str(),
+                  O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (output == -1) {
+      throw ProcessException("Failed to open process output: " + output_path);
+    }
+  }
+
+  pid_ = fork();
+  if (pid_ == 0) {
+    if (output != -1) {
+      dup2(output, STDOUT_FILENO);
+      dup2(output, STDERR_FILENO);
+      close(output);
+    }
+    execve(argv[0], argv.data(), envp.data());
+    _exit(127);
+  }
+  if (output != -1) {
+    close(output);
+  }
+  if (pid_ == -1) {
+    throw ProcessException("Failed to start process: " + arguments[0]);
+  }
+}
+
+ProcessLinux::~ProcessLinux() {
+  if (pid_ != -1) {
+    waitpid(pid_, nullptr, 0);
+  }
+}
+
+int ProcessLinux::wait() {
+  if (pid_ == -1) {
+    return exit_code_;
+  }
+
+  int status = 0;
+  pid_t result = -1;
+  do {
+    result = waitpid(pid_, &status, 0);
+  } while (result == -1 && errno == EINTR);
+  if (result == -1) {
+    throw ProcessException("Failed to wait for process");
+  }
+  pid_ = -1;
+
+  if (WIFEXITED(status)) {
+    exit_code_ = WEXITSTATUS(status);
+  } else {
+    exit_code_ = 128 + WTERMSIG(status);
+  }
+  return exit_code_;
+}
+
+void ProcessLinux::terminate() {
+  if (pid_ != -1) {
+    kill(pid_, SIGKILL);
+  }
+}
+
+} // namespace cassian
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_SYSTEM_PROCESS_LINUX_HPP
+#define CASSIAN_SYSTEM_PROCESS_LINUX_HPP
+
+#include <cassian/system/process.hpp>
+#include <string>
+#include <sys/types.h>
+#include <utility>
+#include <vector>
+
+namespace cassian {
+class ProcessLinux : public Process {
+public:
+  ProcessLinux() = delete;
+  ProcessLinux(
+      const std::vector<std::string> &arguments,
+      const std::vector<std::pair<std::string, std::string>> &environment,
+      const std::string &output_path);
+  ProcessLinux(const ProcessLinux &) = delete;
+  ProcessLinux(ProcessLinux &&) = delete;
+  ~ProcessLinux();
+  ProcessLinux &operator=(const ProcessLinux &) = delete;
+  ProcessLinux &operator=(ProcessLinux &&) = delete;
+
+  int wait() override;
+  void terminate() override;
+
+private:
+  pid_t pid_ = -1;
+  int exit_code_ = 0;
+};
+
+} // namespace cassian
+#endif
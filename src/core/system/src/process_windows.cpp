@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <algorithm>
+#include <cassian/system/process.hpp>
+#include <cctype>
+#include <map>
+#include <process_windows.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+#include <windows.h>
+
+namespace cassian {
+
+namespace {
+
+std::string quote_argument(const std::string &argument) {
+  if (!argument.empty() &&
+      argument.find_first_of(" \t\"") == std::string::npos) {
+    return argument;
+  }
+  std::string quoted = "\"";
+  size_t backslashes = 0;
+  for (const char c : argument) {
+    if (c == '\\') {
+      backslashes++;
+      continue;
+    }
+    if (c == '"') {
+      quoted.append(backslashes * 2 + 1, '\\');
+    } else {
+      quoted.append(backslashes, '\\');
+    }
+    backslashes = 0;
+    quoted.push_back(c);
+  }
+  quoted.append(backslashes * 2, '\\');
+  quoted.push_back('"');
+  return quoted;
+}
+
+// Environment block must be sorted by name, ignoring case
+struct VariableNameLess {
+  bool operator()(const std::string &a, const std::string &b) const {
+    return std::lexicographical_compare(
+        a.begin(), a.end(), b.begin(), b.end(), [](char x, char y) {
+          return std::toupper(static_cast<unsigned char>(x)) <
+                 std::toupper(static_cast<unsigned char>(y));
+        });
+  }
+};
+
+} // namespace
+
+ProcessWindows::ProcessWindows(
+    const std::vector<std::string> &arguments,
+    const std::vector<std::pair<std::string, std::string>> &environment,
+    const std::string &output_path) {
+  if (arguments.empty()) {
+    throw ProcessException("Failed to start process: empty command");
+  }
+
+  std::string command_line;
+  for (const auto &argument : arguments) {
+    if (!command_line.empty()) {
+      command_line.push_back(' ');
+    }
+    command_line += quote_argument(argument);
+  }
+
+  // Overrides replace inherited variables, names are case insensitive
+  std::map<std::string, std::string, VariableNameLess> variables;
+  char *strings = GetEnvironmentStringsA();
+  for (const char *variable = strings; *variable != '\0';
+       variable += std::string(variable).size() + 1) {
+    const std::string inherited(variable);
+    // Names of hidden per-drive variables start with '='
+    const auto separator = inherited.find('=', 1);
+    variables[inherited.substr(0, separator)] =
+        separator == std::string::npos ? "" : inherited.substr(separator + 1);
+  }
+  FreeEnvironmentStringsA(strings);
+  for (const auto &[name, value] : environment) {
+    variables[name] = value;
+  }
+
+  std::string environment_block;
+  for (const auto &[name, value] : variables) {
+    environment_block += name + "=" + value;
+    environment_block.push_back('\0');
+  }
+  environment_block.push_back('\0');
+
+  STARTUPINFOA startup_info = {};
+  startup_info.cb = sizeof(startup_info);
+  HANDLE output = INVALID_HANDLE_VALUE;
+  if (!output_path.empty()) {
+    SECURITY_ATTRIBUTES attributes = {};
+    attributes.nLength = sizeof(attributes);
+    attributes.bInheritHandle = TRUE;
+    output = CreateFileA(output_path.c_str(), GENERIC_WRITE, FILE_SHARE_READ,
+                         &attributes, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL,
+                         NULL);
+    if (output == INVALID_HANDLE_VALUE) {
+      throw ProcessException("Failed to open process output: " + output_path);
+    }
+    startup_info.dwFlags = STARTF_USESTDHANDLES;
+    startup_info.hStdInput = GetStdHandle(STD_INPUT_HANDLE);
+    startup_info.hStdOutput = output;
+    startup_info.hStdError = output;
+  }
+
+  PROCESS_INFORMATION process_information = {};
+  const BOOL created = CreateProcessA(
+      NULL, command_line.data(), NULL, NULL, TRUE, 0,
+      environment_block.data(), NULL, &startup_info, &process_information);
+  if (output != INVALID_HANDLE_VALUE) {
+    CloseHandle(output);
+  }
+  if (created == FALSE) {
+    throw ProcessException("Failed to start process: " + arguments[0]);
+  }
+  CloseHandle(process_information.hThread);
+  process_ = process_information.hProcess;
+}
+
+ProcessWindows::~ProcessWindows() {
+  if (process_ != NULL) {
+    WaitForSingleObject(process_, INFINITE);
+    CloseHandle(process_);
+  }
+}
+
+int ProcessWindows::wait() {
+  if (process_ == NULL) {
+    return exit_code_;
+  }
+
+  if (WaitForSingleObject(process_, INFINITE) != WAIT_OBJECT_0) {
+    throw ProcessException("Failed to wait for process");
+  }
+  DWORD exit_code = 0;
+  GetExitCodeProcess(process_, &exit_code);
+  CloseHandle(process_);
+  process_ = NULL;
+  exit_code_ = static_cast<int>(exit_code);
+  return exit_code_;
+}
+
+void ProcessWindows::terminate() {
+  if (process_ != NULL) {
+    TerminateProcess(process_, 1);
+  }
+}
+
+} // namespace cassian
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_SYSTEM_PROCESS_WINDOWS_HPP
+#define CASSIAN_SYSTEM_PROCESS_WINDOWS_HPP
+
+#include <cassian/system/process.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+#include <windows.h>
+
+namespace cassian {
+class ProcessWindows : public Process {
+public:
+  ProcessWindows() = delete;
+  ProcessWindows(
+      const std::vector<std::string> &arguments,
+      const std::vector<std::pair<std::string, std::string>> &environment,
+      const std::string &output_path);
+  ProcessWindows(const ProcessWindows &) = delete;
+  ProcessWindows(ProcessWindows &&) = delete;
+  ~ProcessWindows();
+  ProcessWindows &operator=(const ProcessWindows &) = delete;
+  ProcessWindows &operator=(ProcessWindows &&) = delete;
+
+  int wait() override;
+  void terminate() override;
+
+private:
+  HANDLE process_ = NULL;
+  int exit_code_ = 0;
+};
+
+} // namespace cassian
+#endif
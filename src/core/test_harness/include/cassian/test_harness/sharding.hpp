@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_TEST_HARNESS_SHARDING_HPP
+#define CASSIAN_TEST_HARNESS_SHARDING_HPP
+
+#include <cassian/cli/cli.hpp>
+#include <cassian/runtime/runtime.hpp>
+#include <cassian/test_harness/test_config.hpp>
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace cassian {
+
+/**
+ * Get devices available for sharded test execution.
+ *
+ * Devices are described by ZE_AFFINITY_MASK values, a root device ("0") or a
+ * root device subdevice ("0.1"). Subdevices are used for each root device that
+ * is partitioned.
+ *
+ * @param[in] runtime initialized runtime, its subdevices are initialized.
+ * @returns device affinity masks.
+ * @throws cassian::RuntimeException Thrown if runtime encountered a fatal
+ * error.
+ */
+std::vector<std::string> get_shard_devices(Runtime *runtime);
+
+/**
+ * Get Catch2 arguments for a shard child process.
+ *
+ * Options are forwarded, e.g. reporter and section filters. Test specs and
+ * input files are dropped, test cases of the shard are passed in a separate
+ * input file. Output file "dir/report.xml" is replaced by
+ * "dir/report_shard<shard>.xml", so each shard writes its own report.
+ *
+ * @param[in] arguments Catch2 arguments without the program name.
+ * @param[in] shard shard index.
+ * @returns arguments for the shard.
+ */
+std::vector<std::string>
+get_shard_catch_arguments(const std::vector<std::string> &arguments,
+                          size_t shard);
+
+/**
+ * Distribute test cases between shards in a round-robin fashion.
+ *
+ * @param[in] test_cases test case names.
+ * @param[in] shard_count number of shards.
+ * @returns test case names for each shard.
+ */
+std::vector<std::vector<std::string>>
+split_test_cases(const std::vector<std::string> &test_cases,
+                 size_t shard_count);
+
+/**
+ * Run test cases in child processes, one per device.
+ *
+ * Test cases are split between all devices returned by get_shard_devices.
+ * Each shard runs in a child process restricted to its device with
+ * ZE_AFFINITY_MASK. Cassian arguments and Catch2 arguments adjusted with
+ * get_shard_catch_arguments are forwarded to child processes. Output of each
+ * shard is printed as soon as it finishes, followed by test case and
+ * assertion totals merged across shards once all of them are done. Reporter
+ * output files requested with `-o` are written per shard, as reporter formats
+ * like XML cannot be concatenated.
+ *
+ * @param[in] parser parsed command line.
+ * @param[in] runtime initialized runtime.
+ * @param[in] test_cases test case names.
+ * @param[in] catch_arguments Catch2 arguments without the program name.
+ * @returns sum of child process exit codes, clamped to 255.
+ * @throws cassian::RuntimeException Thrown if child process could not be
+ * started.
+ */
+int run_shards(const CommandLineParser &parser, Runtime *runtime,
+               const std::vector<std::string> &test_cases,
+               const std::vector<std::string> &catch_arguments);
+
+/**
+ * Run Catch2 test session.
+ *
+ * If `--dump-features` is enabled, features of the device are printed with
+ * dump_features and no test case is run. If `--shard-across-devices` is
+ * enabled, test cases matching the command line are run with run_shards.
+ *
+ * @tparam SESSION Catch2 session type, available only in a translation unit
+ * defining CATCH_CONFIG_RUNNER.
+ * @param[in] session Catch2 session.
+ * @param[in] parser parsed command line.
+ * @param[in] runtime initialized runtime.
+ * @param[in] argc argument count remaining after cassian arguments parsing.
+ * @param[in] argv argument vector remaining after cassian arguments parsing.
+ * @returns Catch2 exit code, non-zero if any test failed.
+ */
+template <typename SESSION>
+int run_test_session(SESSION &session, const CommandLineParser &parser,
+                     Runtime *runtime, int argc, char *argv[]) {
+  if (!parser.list_requested() && parser.get_bool("--dump-features")) {
+    dump_features(runtime, parser.get<std::string>("--program-type"));
+    return 0;
+  }
+  if (parser.list_requested() || !parser.get_bool("--shard-across-devices")) {
+    return session.run(argc, argv);
+  }
+
+  const int result = session.applyCommandLine(argc, argv);
+  if (result != 0 || session.configData().showHelp) {
+    return result;
+  }
+
+  const auto &config = session.config();
+  std::vector<std::string> test_cases;
+  for (const auto &test_case : Catch::filterTests(
+           Catch::getAllTestCasesSorted(config), config.testSpec(), config)) {
+    test_cases.push_back(test_case.name);
+  }
+  return run_shards(parser, runtime, test_cases,
+                    std::vector<std::string>(argv + 1, argv + argc));
+}
+
+} // namespace cassian
+
+#endif
@@ -20,6 +20,8 @@ class TestConfigBase {
 public:
   TestConfigBase() = default;
   explicit TestConfigBase(const cassian::CommandLineParser &parser);
+  TestConfigBase(std::unique_ptr<cassian::Runtime> runtime,
+                 std::string program_type);
   TestConfigBase(const TestConfigBase &) = delete;
   TestConfigBase(TestConfigBase &&) = delete;
   ~TestConfigBase() = default;
@@ -34,6 +36,8 @@ protected:
   std::string program_type_ = "";
 };
 
+void dump_features(Runtime *runtime, const std::string &program_type);
+
 void add_harness_arguments(CommandLineParser *parser);
 
 } // namespace cassian
@@ -0,0 +1,357 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Listener interfaces are needed to collect shard totals
+#define CATCH_CONFIG_EXTERNAL_INTERFACES
+
+#include <algorithm>
+#include <cassian/cli/cli.hpp>
+#include <cassian/logging/logging.hpp>
+#include <cassian/runtime/runtime.hpp>
+#include <cassian/system/factory.hpp>
+#include <cassian/system/process.hpp>
+#include <cassian/test_harness/sharding.hpp>
+#include <cassian/utility/utility.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace cassian {
+
+namespace {
+
+// Path of a file the child process writes its Catch2 totals to
+constexpr char shard_totals_variable[] = "CASSIAN_SHARD_TOTALS_FILE";
+
+class ShardTotalsListener : public Catch::TestEventListenerBase {
+public:
+  using TestEventListenerBase::TestEventListenerBase;
+
+  void testRunEnded(const Catch::TestRunStats &stats) override {
+    const char *path = std::getenv(shard_totals_variable);
+    if (path == nullptr) {
+      return;
+    }
+    std::ofstream file(path);
+    const auto &totals = stats.totals;
+    file << totals.testCases.passed << ' ' << totals.testCases.failed << ' '
+         << totals.assertions.passed << ' ' << totals.assertions.failed
+         << '\n';
+  }
+};
+
+CATCH_REGISTER_LISTENER(ShardTotalsListener)
+
+struct ShardTotals {
+  uint64_t test_cases_passed = 0;
+  uint64_t test_cases_failed = 0;
+  uint64_t assertions_passed = 0;
+  uint64_t assertions_failed = 0;
+};
+
+struct FinishedShard {
+  size_t index = 0;
+  int exit_code = 0;
+  std::string error;
+};
+
+std::optional<ShardTotals> read_shard_totals(const fs::path &path) {
+  std::ifstream file(path);
+  ShardTotals totals;
+  if (!(file >> totals.test_cases_passed >> totals.test_cases_failed >>
+        totals.assertions_passed >> totals.assertions_failed)) {
+    return std::nullopt;
+  }
+  return totals;
+}
+
+void write_test_cases(const fs::path &path,
+                      const std::vector<std::string> &test_cases) {
+  std::ofstream file(path);
+  if (!file.good()) {
+    throw RuntimeException("Failed to write shard test cases: " +
+                           path.string());
+  }
+  for (const auto &test_case : test_cases) {
+    // Names are quoted by Catch2, only backslashes have to be escaped.
+    std::string escaped;
+    for (const char c : test_case) {
+      if (c == '\\') {
+        escaped.push_back('\\');
+      }
+      escaped.push_back(c);
+    }
+    file << '"' << escaped << "\"\n";
+  }
+}
+
+std::vector<std::string>
+get_shard_command(const CommandLineParser &parser,
+                  const std::vector<std::string> &catch_arguments,
+                  const fs::path &test_cases_path) {
+  std::vector<std::string> command = {get_application_path().string()};
+  for (const auto &[name, value] : parser.get_arguments()) {
+    command.push_back(name);
+    command.push_back(name == "--shard-across-devices" ? "false" : value);
+  }
+  command.insert(command.end(), catch_arguments.begin(),
+                 catch_arguments.end());
+  command.emplace_back("--input-file");
+  command.push_back(test_cases_path.string());
+  return command;
+}
+
+} // namespace
+
+std::vector<std::string> get_shard_devices(Runtime *runtime) {
+  runtime->initialize_subdevices();
+  const int root_device_count = runtime->get_root_device_count();
+
+  std::vector<std::string> devices;
+  for (int i = 0; i < root_device_count; i++) {
+    const int subdevice_count = runtime->get_subdevice_count(i);
+    if (subdevice_count > 1) {
+      for (int j = 0; j < subdevice_count; j++) {
+        devices.push_back(std::to_string(i) + "." + std::to_string(j));
+      }
+    } else {
+      devices.push_back(std::to_string(i));
+    }
+  }
+  return devices;
+}
+
+std::vector<std::string>
+get_shard_catch_arguments(const std::vector<std::string> &arguments,
+                          size_t shard) {
+  // Catch2 options followed by a value, other arguments not starting with a
+  // dash are test specs
+  static const std::set<std::string> value_options = {
+      "-x",
+      "--abortx",
+      "-w",
+      "--warn",
+      "-r",
+      "--reporter",
+      "-o",
+      "--out",
+      "-n",
+      "--name",
+      "-d",
+      "--durations",
+      "-D",
+      "--min-duration",
+      "-f",
+      "--input-file",
+      "-c",
+      "--section",
+      "--order",
+      "--rng-seed",
+      "--use-colour",
+      "--wait-for-keypress",
+      "--benchmark-samples",
+      "--benchmark-resamples",
+      "--benchmark-confidence-interval",
+      "--benchmark-warmup-time",
+      "-v",
+      "--verbosity",
+  };
+
+  std::vector<std::string> shard_arguments;
+  for (size_t i = 0; i < arguments.size(); i++) {
+    const std::string &argument = arguments[i];
+    // Test specs are replaced by the shard input file
+    if (argument.size() < 2 || argument[0] != '-') {
+      continue;
+    }
+
+    std::string name = argument;
+    std::optional<std::string> value;
+    const auto separator = argument.find_first_of(":=");
+    if (separator != std::string::npos) {
+      name = argument.substr(0, separator);
+      value = argument.substr(separator + 1);
+    } else if (value_options.count(name) != 0 && i + 1 < arguments.size()) {
+      value = arguments[++i];
+    }
+
+    if (name == "-f" || name == "--input-file") {
+      continue;
+    }
+    if ((name == "-o" || name == "--out") && value.has_value() &&
+        !value->empty() && value->front() != '%') {
+      const fs::path path(value.value());
+      value = (path.parent_path() /
+               (path.stem().string() + "_shard" + std::to_string(shard) +
+                path.extension().string()))
+                  .string();
+    }
+    shard_arguments.push_back(name);
+    if (value.has_value()) {
+      shard_arguments.push_back(value.value());
+    }
+  }
+  return shard_arguments;
+}
+
+std::vector<std::vector<std::string>>
+split_test_cases(const std::vector<std::string> &test_cases,
+                 size_t shard_count) {
+  std::vector<std::vector<std::string>> shards(shard_count);
+  if (shard_count == 0) {
+    return shards;
+  }
+  for (size_t i = 0; i < test_cases.size(); i++) {
+    shards[i % shard_count].push_back(test_cases[i]);
+  }
+  return shards;
+}
+
+int run_shards(const CommandLineParser &parser, Runtime *runtime,
+               const std::vector<std::string> &test_cases,
+               const std::vector<std::string> &catch_arguments) {
+  const auto devices = get_shard_devices(runtime);
+  const auto shards = split_test_cases(test_cases, devices.size());
+  logging::info() << "Sharding " << test_cases.size() << " test cases across "
+                  << devices.size() << " devices\n";
+
+  const fs::path directory =
+      fs::temp_directory_path() /
+      ("cassian_shards_" + std::to_string(std::random_device()()));
+  fs::create_directories(directory);
+
+  std::vector<std::pair<size_t, std::unique_ptr<Process>>> processes;
+  // Shards started before a failure are stopped, and their processes are
+  // waited for on destruction, before the directory is removed
+  auto cleanup = finally([&]() {
+    for (auto &[i, process] : processes) {
+      process->terminate();
+    }
+    processes.clear();
+    std::error_code error;
+    fs::remove_all(directory, error);
+  });
+  for (size_t i = 0; i < shards.size(); i++) {
+    if (shards[i].empty()) {
+      continue;
+    }
+    const auto test_cases_path =
+        directory / ("shard_" + std::to_string(i) + ".txt");
+    const auto output_path =
+        directory / ("shard_" + std::to_string(i) + ".log");
+    const auto totals_path =
+        directory / ("shard_" + std::to_string(i) + ".totals");
+    write_test_cases(test_cases_path, shards[i]);
+    const auto command = get_shard_command(
+        parser, get_shard_catch_arguments(catch_arguments, i),
+        test_cases_path);
+    try {
+      processes.emplace_back(
+          i, start_process(command,
+                           {{"ZE_AFFINITY_MASK", devices[i]},
+                            {shard_totals_variable, totals_path.string()}},
+                           output_path.string()));
+    } catch (const ProcessException &e) {
+      throw RuntimeException(e.what());
+    }
+  }
+
+  // Wait for every shard in its own thread, so logs are printed in
+  // completion order instead of shard order
+  std::mutex finished_mutex;
+  std::condition_variable shard_finished;
+  std::deque<FinishedShard> finished_shards;
+  std::vector<std::thread> waiters;
+  auto join_waiters = finally([&]() {
+    for (auto &waiter : waiters) {
+      waiter.join();
+    }
+  });
+  waiters.reserve(processes.size());
+  for (auto &[i, process] : processes) {
+    waiters.emplace_back([&, i = i, process = process.get()] {
+      FinishedShard shard = {i, 1, ""};
+      try {
+        shard.exit_code = process->wait();
+      } catch (const ProcessException &e) {
+        shard.error = e.what();
+      }
+      {
+        std::lock_guard<std::mutex> lock(finished_mutex);
+        finished_shards.push_back(shard);
+      }
+      shard_finished.notify_one();
+    });
+  }
+
+  int failed = 0;
+  ShardTotals totals;
+  for (size_t finished = 0; finished < processes.size(); finished++) {
+    FinishedShard shard;
+    {
+      std::unique_lock<std::mutex> lock(finished_mutex);
+      shard_finished.wait(lock, [&] { return !finished_shards.empty(); });
+      shard = finished_shards.front();
+      finished_shards.pop_front();
+    }
+    const size_t i = shard.index;
+    const auto output_path =
+        directory / ("shard_" + std::to_string(i) + ".log");
+    std::cout << "Shard " << i << " (ZE_AFFINITY_MASK=" << devices[i]
+              << "):\n";
+    std::ifstream output(output_path);
+    std::cout << output.rdbuf() << std::flush;
+    if (!shard.error.empty()) {
+      logging::error() << "Shard " << i << ": " << shard.error << '\n';
+    }
+    if (shard.exit_code != 0) {
+      logging::error() << "Shard " << i << " failed with exit code "
+                       << shard.exit_code << '\n';
+      failed += shard.exit_code;
+    }
+
+    const auto shard_totals = read_shard_totals(
+        directory / ("shard_" + std::to_string(i) + ".totals"));
+    if (!shard_totals.has_value()) {
+      logging::error() << "Shard " << i << " did not report totals\n";
+      failed = std::max(failed, 1);
+      continue;
+    }
+    totals.test_cases_passed += shard_totals->test_cases_passed;
+    totals.test_cases_failed += shard_totals->test_cases_failed;
+    totals.assertions_passed += shard_totals->assertions_passed;
+    totals.assertions_failed += shard_totals->assertions_failed;
+  }
+
+  std::cout << "All shards: "
+            << totals.test_cases_passed + totals.test_cases_failed
+            << " test cases (" << totals.test_cases_passed << " passed, "
+            << totals.test_cases_failed << " failed), "
+            << totals.assertions_passed + totals.assertions_failed
+            << " assertions (" << totals.assertions_passed << " passed, "
+            << totals.assertions_failed << " failed)\n"
+            << std::flush;
+  return std::min(failed, 255);
+}
+
+} // namespace cassian
@@ -7,12 +7,17 @@
 
 #include <cassian/cli/cli.hpp>
 #include <cassian/logging/logging.hpp>
+#include <cassian/reference/reference_store.hpp>
 #include <cassian/runtime/factory.hpp>
+#include <cassian/runtime/feature.hpp>
+#include <cassian/runtime/openclc_utils.hpp>
 #include <cassian/runtime/runtime.hpp>
 #include <cassian/test_harness/test_config.hpp>
+#include <cassian/utility/parallel.hpp>
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <utility>
 
 namespace cassian {
 
@@ -42,10 +47,21 @@ public:
   logging::LogLevel log_level_;
 };
 
+// OpenCL C is compiled from source only by OpenCL runtime, SPIR-V is
+// generated by the offline compiler for both runtimes
+bool compiles_openclc(const Runtime *runtime, const std::string &program_type) {
+  return program_type == "spirv" ||
+         (program_type == "source" && runtime->name() == "OCL");
+}
+
+std::string to_status(bool supported) {
+  return supported ? "supported" : "unsupported";
+}
+
 } // namespace
 
 TestConfigBase::TestConfigBase(const CommandLineParser &parser) {
-  runtime_ = create_runtime(parser.get<std::string>("--runtime"));
+  runtime_ = create_runtime(parser);
   if (!parser.list_requested()) {
     runtime_->initialize();
   }
@@ -55,15 +71,57 @@ TestConfigBase::TestConfigBase(const CommandLineParser &parser) {
   logging::set_threshold(log_level);
 
   program_type_ = parser.get<std::string>("--program-type");
+
+  // Number of hardware threads is used by default
+  if (parser.get<std::string>("--host-threads") != "auto") {
+    set_host_thread_count(parser.get_unsigned("--host-threads", 1));
+  }
+
+  set_reference_store(ReferenceStore(
+      parser.get<std::string>("--reference-cache-dir"),
+      parser.get_bool("--rebuild-reference-cache")));
 }
 
+TestConfigBase::TestConfigBase(std::unique_ptr<Runtime> runtime,
+                               std::string program_type)
+    : runtime_(std::move(runtime)), program_type_(std::move(program_type)) {}
+
 Runtime *TestConfigBase::runtime() const { return runtime_.get(); }
 std::string TestConfigBase::program_type() const { return program_type_; }
 
+void dump_features(Runtime *runtime, const std::string &program_type) {
+  for (int i = 0; i < static_cast<int>(Feature::count); i++) {
+    const auto feature = static_cast<Feature>(i);
+    std::string status;
+    try {
+      status = to_status(runtime->is_feature_supported(feature));
+    } catch (const RuntimeException &e) {
+      status = e.what();
+    }
+    logging::info() << "Feature " << to_string(feature) << ": " << status
+                    << '\n';
+  }
+
+  if (!compiles_openclc(runtime, program_type)) {
+    return;
+  }
+  for (const auto &macro : get_openclc_optional_features()) {
+    const bool supported =
+        check_optional_openclc_feature_support(runtime, program_type, macro);
+    logging::info() << "OpenCL C feature " << macro << ": "
+                    << to_status(supported) << '\n';
+  }
+}
+
 void add_harness_arguments(CommandLineParser *parser) {
   add_runtime_arguments(parser);
 
   parser->add_argument("--logging-level", "info");
+  parser->add_argument("--dump-features", "false");
+  parser->add_argument("--shard-across-devices", "false");
+  parser->add_argument("--host-threads", "auto");
+  parser->add_argument("--reference-cache-dir", "");
+  parser->add_argument("--rebuild-reference-cache", "false");
 }
 
 } // namespace cassian
\ No newline at end of file
@@ -16,10 +16,14 @@
 #include <cassian/runtime/openclc_types.hpp>
 #include <cassian/utility/utility.hpp>
 #include <cassian/vector/vector.hpp>
+#include <array>
 #include <catch2/catch.hpp>
+#include <cmath>
+#include <cstddef>
 #include <cstring>
 #include <iomanip>
 #include <limits>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -48,11 +52,16 @@ template <class T,
           class U = std::conditional_t<(sizeof(T) <= 4), uint32_t, uint64_t>>
 inline std::enable_if_t<std::is_floating_point_v<T>, std::string>
 raw_bits(const T &v) {
-  U bits{};
-  std::memcpy(&bits, &v, sizeof(T));
   std::ostringstream os;
-  os << "0x" << std::hex << std::uppercase << std::setw(sizeof(T) * 2)
-     << std::setfill('0') << bits;
+  if constexpr (sizeof(T) > sizeof(U)) {
+    // Extended precision types have no integer of matching size
+    os << std::hexfloat << v;
+  } else {
+    U bits{};
+    std::memcpy(&bits, &v, sizeof(T));
+    os << "0x" << std::hex << std::uppercase << std::setw(sizeof(T) * 2)
+       << std::setfill('0') << bits;
+  }
   return os.str();
 }
 
@@ -494,6 +503,245 @@ private:
   }
 };
 
+/**
+ * Upper bounds of the ULP distance histogram buckets collected by
+ * UlpAccumulator. Distances above the last bound and non-finite distances are
+ * counted in an additional, last bucket.
+ */
+inline constexpr std::array<double, 8> ulp_histogram_bounds = {
+    0.0, 0.5, 1.0, 2.0, 4.0, 16.0, 256.0, 65536.0};
+
+/**
+ * Element rejected by UlpAccumulator.
+ */
+template <typename RESULT_TYPE, typename REFERENCE_TYPE> struct UlpFailure {
+  /**
+   * Index of the element.
+   */
+  size_t index = 0;
+  /**
+   * Vector component of the element, 0 for scalars.
+   */
+  int component = 0;
+  /**
+   * Result value.
+   */
+  RESULT_TYPE result{};
+  /**
+   * Reference value.
+   */
+  REFERENCE_TYPE reference{};
+  /**
+   * ULP distance between result and reference.
+   */
+  REFERENCE_TYPE ulp_distance{};
+};
+
+/**
+ * Accumulates ULP comparison statistics over one or more chunks of results.
+ *
+ * Uses the same matching rules as UlpComparator, but does not copy the
+ * compared data. Only the first max_failures rejected elements are stored.
+ *
+ * @tparam OUTPUT_TYPE result type, scalar or vector.
+ * @tparam REFERENCE_TYPE reference type, scalar or vector.
+ */
+template <class OUTPUT_TYPE, class REFERENCE_TYPE> class UlpAccumulator {
+public:
+  using result_scalar_type = scalar_type_v<OUTPUT_TYPE>;
+  using reference_scalar_type = scalar_type_v<REFERENCE_TYPE>;
+  using failure_type = UlpFailure<result_scalar_type, reference_scalar_type>;
+
+  /**
+   * Construct empty accumulator.
+   *
+   * @param[in] max_failures number of rejected elements to keep for
+   * diagnostics.
+   */
+  explicit UlpAccumulator(size_t max_failures = 16)
+      : max_failures_(max_failures) {}
+
+  /**
+   * Compare a chunk of results.
+   *
+   * @param[in] result results.
+   * @param[in] reference reference values, one per result.
+   * @param[in] ulp_values allowed ULP distance, one per result.
+   * @param[in] first_index index of the first element of the chunk.
+   * @throws std::invalid_argument Thrown if sizes do not match.
+   */
+  void accumulate(std::span<const OUTPUT_TYPE> result,
+                  std::span<const REFERENCE_TYPE> reference,
+                  std::span<const reference_scalar_type> ulp_values,
+                  size_t first_index = 0) {
+    if (reference.size() != result.size() ||
+        ulp_values.size() != result.size()) {
+      throw std::invalid_argument("Result and reference sizes differ");
+    }
+    for (size_t i = 0; i < result.size(); i++) {
+      accumulate_element(result[i], reference[i], ulp_values[i],
+                         first_index + i);
+    }
+  }
+
+  /**
+   * Compare a chunk of results with a single allowed ULP distance.
+   *
+   * @param[in] result results.
+   * @param[in] reference reference values, one per result.
+   * @param[in] ulp_value allowed ULP distance.
+   * @param[in] first_index index of the first element of the chunk.
+   * @throws std::invalid_argument Thrown if sizes do not match.
+   */
+  void accumulate(std::span<const OUTPUT_TYPE> result,
+                  std::span<const REFERENCE_TYPE> reference,
+                  reference_scalar_type ulp_value, size_t first_index = 0) {
+    if (reference.size() != result.size()) {
+      throw std::invalid_argument("Result and reference sizes differ");
+    }
+    for (size_t i = 0; i < result.size(); i++) {
+      accumulate_element(result[i], reference[i], ulp_value, first_index + i);
+    }
+  }
+
+  /**
+   * @returns true if no element has been rejected.
+   */
+  bool passed() const { return failure_count_ == 0; }
+
+  /**
+   * @returns number of compared scalar values.
+   */
+  size_t compared_count() const { return compared_count_; }
+
+  /**
+   * @returns number of rejected scalar values.
+   */
+  size_t failure_count() const { return failure_count_; }
+
+  /**
+   * @returns largest ULP distance, NaN if any distance was NaN.
+   */
+  reference_scalar_type max_ulp() const { return max_ulp_; }
+
+  /**
+   * @returns mean of finite ULP distances.
+   */
+  double mean_ulp() const {
+    return finite_count_ == 0 ? 0.0 : ulp_sum_ / finite_count_;
+  }
+
+  /**
+   * @returns number of values per ulp_histogram_bounds bucket.
+   */
+  const std::array<size_t, ulp_histogram_bounds.size() + 1> &
+  histogram() const {
+    return histogram_;
+  }
+
+  /**
+   * @returns first rejected elements.
+   */
+  const std::vector<failure_type> &failures() const { return failures_; }
+
+  /**
+   * @returns human readable summary with the stored rejected elements.
+   */
+  std::string describe() const {
+    std::stringstream os;
+    os.precision(std::numeric_limits<double>::max_digits10);
+    os << "\nCompared: " << compared_count_ << ", failed: " << failure_count_;
+    os << "\nMax ULP: " << max_ulp_ << ", mean ULP: " << mean_ulp();
+    os << "\nULP histogram: {";
+    for (size_t i = 0; i < histogram_.size(); i++) {
+      if (i < ulp_histogram_bounds.size()) {
+        os << "<=" << ulp_histogram_bounds[i];
+      } else {
+        os << ">" << ulp_histogram_bounds.back();
+      }
+      os << ": " << histogram_[i] << (i + 1 < histogram_.size() ? ", " : "");
+    }
+    os << '}';
+    if (!failures_.empty()) {
+      os << "\nFirst " << failures_.size() << " failures:";
+      for (const auto &failure : failures_) {
+        os << "\n[" << failure.index;
+        if constexpr (is_vector_v<OUTPUT_TYPE>) {
+          os << "][" << failure.component;
+        }
+        os << "] Result: " << detail_hex_fmt::dec_hex_pair(failure.result)
+           << ", Reference: "
+           << detail_hex_fmt::dec_hex_pair(failure.reference)
+           << ", ULP distance: " << failure.ulp_distance;
+      }
+    }
+    return os.str();
+  }
+
+private:
+  size_t max_failures_ = 0;
+  size_t compared_count_ = 0;
+  size_t failure_count_ = 0;
+  size_t finite_count_ = 0;
+  double ulp_sum_ = 0.0;
+  reference_scalar_type max_ulp_{};
+  std::array<size_t, ulp_histogram_bounds.size() + 1> histogram_{};
+  std::vector<failure_type> failures_;
+
+  void accumulate_element(const OUTPUT_TYPE &result,
+                          const REFERENCE_TYPE &reference,
+                          const reference_scalar_type ulp_value,
+                          const size_t index) {
+    if constexpr (is_vector_v<OUTPUT_TYPE>) {
+      for (int j = 0; j < result.size(); j++) {
+        accumulate_value(result[j], reference[j], ulp_value, index, j);
+      }
+    } else {
+      accumulate_value(result, reference, ulp_value, index, 0);
+    }
+  }
+
+  void accumulate_value(const result_scalar_type result,
+                        const reference_scalar_type reference,
+                        const reference_scalar_type ulp_value,
+                        const size_t index, const int component) {
+    using std::isnan;
+    compared_count_++;
+    reference_scalar_type distance{};
+    if constexpr (is_floating_point_v<result_scalar_type>) {
+      if (!(isnan(result) && isnan(reference)) &&
+          result != static_cast<result_scalar_type>(reference)) {
+        distance = calculate_ulp_distance(result, reference);
+      }
+    } else {
+      distance = calculate_ulp_distance(result, reference);
+    }
+
+    const auto value = static_cast<double>(distance);
+    size_t bucket = 0;
+    while (bucket < ulp_histogram_bounds.size() &&
+           !(value <= ulp_histogram_bounds[bucket])) {
+      bucket++;
+    }
+    histogram_[bucket]++;
+    if (std::isfinite(value)) {
+      ulp_sum_ += value;
+      finite_count_++;
+    }
+    // NaN maximum is sticky, later finite distances must not replace it
+    if (!isnan(max_ulp_) && !(distance <= max_ulp_)) {
+      max_ulp_ = distance;
+    }
+
+    if (!match_results_ulp(result, reference, ulp_value)) {
+      failure_count_++;
+      if (failures_.size() < max_failures_) {
+        failures_.push_back({index, component, result, reference, distance});
+      }
+    }
+  }
+};
+
 } // namespace cassian
 
 #endif
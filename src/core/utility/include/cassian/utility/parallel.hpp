@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_UTILITY_PARALLEL_HPP
+#define CASSIAN_UTILITY_PARALLEL_HPP
+
+#include <cstddef>
+#include <functional>
+
+/**
+ * Cassian namespace.
+ */
+namespace cassian {
+
+/**
+ * Set number of host threads used by parallel_for.
+ *
+ * @param[in] count thread count, 0 selects number of hardware threads.
+ */
+void set_host_thread_count(size_t count);
+
+/**
+ * Get number of host threads used by parallel_for.
+ *
+ * @returns thread count.
+ */
+size_t get_host_thread_count();
+
+/**
+ * Process range [0, size) on the host thread pool.
+ *
+ * Range is split into chunks of `grain_size` indices which are picked up by
+ * idle threads, including the calling one. Each index is processed exactly
+ * once, so results written per index do not depend on the thread count.
+ * Nested calls run serially on the calling thread.
+ *
+ * @param[in] size number of indices.
+ * @param[in] body function processing indices [begin, end).
+ * @param[in] grain_size number of indices processed by a single call to
+ * `body`.
+ * @throws Rethrows first exception thrown by `body`, remaining chunks are
+ * skipped.
+ */
+void parallel_for(size_t size,
+                  const std::function<void(size_t begin, size_t end)> &body,
+                  size_t grain_size = 1024);
+
+} // namespace cassian
+#endif
@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <cstring>
 #include <filesystem>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -59,6 +60,69 @@ std::vector<uint8_t> load_binary_file(const std::string &file_path);
 void save_binary_file(const std::vector<uint8_t> &data,
                       const std::string &file_path);
 
+/**
+ * Save binary file atomically.
+ *
+ * Data is written to a unique temporary file which is then renamed, so
+ * concurrent readers never observe a partially written file.
+ *
+ * @param[in] data bytes to save.
+ * @param[in] file_path path to output file.
+ * @returns true if file was saved.
+ */
+bool save_binary_file_atomic(const std::vector<uint8_t> &data,
+                             const std::string &file_path);
+
+/**
+ * Load cache entry saved with save_cache_entry.
+ *
+ * @param[in] file_path path to an entry file.
+ * @param[in] key key the entry has to be stored with.
+ * @returns entry data or std::nullopt if file does not exist or stores a
+ * different key.
+ */
+std::optional<std::vector<uint8_t>>
+load_cache_entry(const std::string &file_path, const std::string &key);
+
+/**
+ * Save cache entry atomically.
+ *
+ * Key is stored along with data, so that entries whose file names collide are
+ * told apart by load_cache_entry.
+ *
+ * @param[in] file_path path to an entry file.
+ * @param[in] key entry key.
+ * @param[in] data bytes to save.
+ * @returns true if entry was saved.
+ */
+bool save_cache_entry(const std::string &file_path, const std::string &key,
+                      const std::vector<uint8_t> &data);
+
+/**
+ * Initial value of 64-bit FNV-1a hash.
+ */
+constexpr uint64_t fnv1a_offset_basis = 0xcbf29ce484222325U;
+
+/**
+ * Compute 64-bit FNV-1a hash.
+ *
+ * @param[in] data bytes to hash.
+ * @returns hash.
+ */
+uint64_t fnv1a_hash(const std::string &data);
+
+/**
+ * Compute 64-bit FNV-1a hash of raw data.
+ *
+ * @param[in] data data to hash.
+ * @param[in] size size of data in bytes.
+ * @param[in] seed initial hash value, hash of previous data allows hashing
+ * several buffers.
+ * @returns hash.
+ */
+uint64_t fnv1a_hash(const void *data, size_t size,
+                    uint64_t seed = fnv1a_offset_basis);
+
 /**
  * Combine bytes from multiple elements into single, larger element.
  *
@@ -106,6 +170,15 @@ std::vector<OUT> split_bytes(const IN input) {
  */
 fs::path get_application_directory();
 
+/**
+ * Get application executable path.
+ *
+ * @returns full path to an application executable.
+ * @throws cassian::PathNotFoundException Thrown if application path logic
+ * returns an error
+ */
+fs::path get_application_path();
+
 /**
  * Exception class used when a given application path is not found in the
  * installation directory.
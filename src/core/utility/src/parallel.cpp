@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cassian/utility/parallel.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cassian {
+
+namespace {
+
+thread_local bool inside_parallel_for = false;
+
+struct Job {
+  const std::function<void(size_t, size_t)> *body = nullptr;
+  size_t size = 0;
+  size_t grain_size = 0;
+  std::atomic<size_t> next{0};
+  std::mutex error_mutex;
+  std::exception_ptr error;
+};
+
+void execute(Job &job) {
+  const bool was_inside = inside_parallel_for;
+  inside_parallel_for = true;
+  while (true) {
+    const size_t begin = job.next.fetch_add(job.grain_size);
+    if (begin >= job.size) {
+      break;
+    }
+    const size_t end = std::min(begin + job.grain_size, job.size);
+    try {
+      (*job.body)(begin, end);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(job.error_mutex);
+      if (!job.error) {
+        job.error = std::current_exception();
+      }
+      job.next = job.size;
+    }
+  }
+  inside_parallel_for = was_inside;
+}
+
+class HostThreadPool {
+public:
+  explicit HostThreadPool(size_t thread_count) {
+    for (size_t i = 1; i < thread_count; i++) {
+      workers_.emplace_back([this] { work(); });
+    }
+  }
+  HostThreadPool(const HostThreadPool &) = delete;
+  HostThreadPool(HostThreadPool &&) = delete;
+  ~HostThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    job_ready_.notify_all();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+  HostThreadPool &operator=(const HostThreadPool &) = delete;
+  HostThreadPool &operator=(HostThreadPool &&) = delete;
+
+  size_t thread_count() const { return workers_.size() + 1; }
+
+  void run(Job &job) {
+    std::lock_guard<std::mutex> run_lock(run_mutex_);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      job_ = &job;
+      finished_ = 0;
+      generation_++;
+    }
+    job_ready_.notify_all();
+    execute(job);
+    std::unique_lock<std::mutex> lock(mutex_);
+    job_done_.wait(lock, [this] { return finished_ == workers_.size(); });
+    job_ = nullptr;
+  }
+
+private:
+  void work() {
+    uint64_t seen_generation = 0;
+    while (true) {
+      Job *job = nullptr;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        job_ready_.wait(lock, [&] {
+          return stop_ || generation_ != seen_generation;
+        });
+        if (stop_) {
+          return;
+        }
+        seen_generation = generation_;
+        job = job_;
+      }
+      execute(*job);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished_++;
+      }
+      job_done_.notify_all();
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::mutex run_mutex_;
+  std::mutex mutex_;
+  std::condition_variable job_ready_;
+  std::condition_variable job_done_;
+  Job *job_ = nullptr;
+  uint64_t generation_ = 0;
+  size_t finished_ = 0;
+  bool stop_ = false;
+};
+
+std::mutex pool_mutex;
+size_t requested_thread_count = 0;
+std::shared_ptr<HostThreadPool> pool;
+
+size_t resolve_thread_count(size_t count) {
+  if (count == 0) {
+    count = std::thread::hardware_concurrency();
+  }
+  return std::max<size_t>(count, 1);
+}
+
+std::shared_ptr<HostThreadPool> get_pool() {
+  std::lock_guard<std::mutex> lock(pool_mutex);
+  if (!pool) {
+    pool = std::make_shared<HostThreadPool>(
+        resolve_thread_count(requested_thread_count));
+  }
+  return pool;
+}
+
+} // namespace
+
+void set_host_thread_count(size_t count) {
+  std::lock_guard<std::mutex> lock(pool_mutex);
+  requested_thread_count = count;
+  pool.reset();
+}
+
+size_t get_host_thread_count() {
+  std::lock_guard<std::mutex> lock(pool_mutex);
+  return resolve_thread_count(requested_thread_count);
+}
+
+void parallel_for(size_t size,
+                  const std::function<void(size_t begin, size_t end)> &body,
+                  size_t grain_size) {
+  grain_size = std::max<size_t>(grain_size, 1);
+  if (size == 0) {
+    return;
+  }
+  if (inside_parallel_for || size <= grain_size ||
+      get_host_thread_count() == 1) {
+    body(0, size);
+    return;
+  }
+
+  Job job;
+  job.body = &body;
+  job.size = size;
+  job.grain_size = grain_size;
+  get_pool()->run(job);
+  if (job.error) {
+    std::rethrow_exception(job.error);
+  }
+}
+
+} // namespace cassian
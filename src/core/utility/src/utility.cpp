@@ -10,9 +10,13 @@
 #include <climits>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iterator>
+#include <optional>
+#include <random>
 #include <string>
+#include <system_error>
 #include <vector>
 #if defined(_WIN32)
 #include <windows.h>
@@ -66,7 +70,78 @@ void save_binary_file(const std::vector<uint8_t> &data,
                sizeof(uint8_t) * data.size());
 }
 
+bool save_binary_file_atomic(const std::vector<uint8_t> &data,
+                             const std::string &file_path) {
+  const std::string temporary_path =
+      file_path + ".tmp" + std::to_string(std::random_device()());
+  std::error_code error;
+  {
+    std::ofstream stream(temporary_path, std::ios::out | std::ios::binary);
+    stream.write(reinterpret_cast<const char *>(data.data()),
+                 sizeof(uint8_t) * data.size());
+    if (!stream) {
+      stream.close();
+      fs::remove(temporary_path, error);
+      return false;
+    }
+  }
+
+  fs::rename(temporary_path, file_path, error);
+  if (error) {
+    fs::remove(temporary_path, error);
+    return false;
+  }
+  return true;
+}
+
+std::optional<std::vector<uint8_t>>
+load_cache_entry(const std::string &file_path, const std::string &key) {
+  // Entry layout: key size, key, data
+  const std::vector<uint8_t> entry = load_binary_file(file_path);
+
+  uint64_t key_size = 0;
+  if (entry.size() >= sizeof(key_size)) {
+    std::memcpy(&key_size, entry.data(), sizeof(key_size));
+  }
+  const size_t header_size = sizeof(key_size) + key.size();
+  if (entry.size() <= header_size || key_size != key.size() ||
+      std::memcmp(entry.data() + sizeof(key_size), key.data(), key.size()) !=
+          0) {
+    return std::nullopt;
+  }
+  return std::vector<uint8_t>(entry.begin() + header_size, entry.end());
+}
+
+bool save_cache_entry(const std::string &file_path, const std::string &key,
+                      const std::vector<uint8_t> &data) {
+  const uint64_t key_size = key.size();
+  std::vector<uint8_t> entry(sizeof(key_size) + key.size() + data.size());
+  std::memcpy(entry.data(), &key_size, sizeof(key_size));
+  std::memcpy(entry.data() + sizeof(key_size), key.data(), key.size());
+  std::memcpy(entry.data() + sizeof(key_size) + key.size(), data.data(),
+              data.size());
+  return save_binary_file_atomic(entry, file_path);
+}
+
+uint64_t fnv1a_hash(const std::string &data) {
+  return fnv1a_hash(data.data(), data.size());
+}
+
+uint64_t fnv1a_hash(const void *data, size_t size, uint64_t seed) {
+  const auto *bytes = static_cast<const uint8_t *>(data);
+  uint64_t hash = seed;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3U;
+  }
+  return hash;
+}
+
 fs::path get_application_directory() {
+  return get_application_path().parent_path();
+}
+
+fs::path get_application_path() {
 #if defined(_WIN32)
   char result[MAX_PATH];
   const auto count = GetModuleFileName(NULL, result, MAX_PATH);
@@ -75,10 +150,9 @@ fs::path get_application_directory() {
   const auto count = readlink("/proc/self/exe", result, PATH_MAX);
 #endif
   if (count > 0) {
-    fs::path app_dir = std::string(result, count);
-    return app_dir.parent_path();
+    return std::string(result, count);
   }
-  throw PathNotFoundException("Failed to find application directory");
+  throw PathNotFoundException("Failed to find application path");
 }
 
 std::string get_asset(const std::string &asset_path) {
@@ -8,6 +8,7 @@
 #include <cassian/catch2_utils/catch2_utils.hpp>
 #include <cassian/logging/logging.hpp>
 #include <cassian/random/random.hpp>
+#include <cassian/reference/reference_store.hpp>
 #include <cassian/runtime/openclc_type_tuples.hpp>
 #include <cassian/runtime/openclc_types.hpp>
 #include <cassian/runtime/runtime.hpp>
@@ -18,6 +19,7 @@
 #include <catch2/catch.hpp>
 #include <common.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <enum_definitions.hpp>
 #include <geometric_functions.hpp>
 #include <map>
@@ -88,20 +90,25 @@ void run_section(const T &oclc_function, const std::vector<INPUT_TYPE> &input_a,
   ca::logging::debug() << "Build options: " << build_options << '\n';
   ca::logging::debug() << "Input A: " << ca::to_string(input_a) << '\n';
   ca::logging::debug() << "Input B: " << ca::to_string(input_b) << '\n';
-  auto reference_vector = std::vector<OUTPUT_TYPE>(work_size);
-  for (auto j = 0; j < work_size; j++) {
-    if (oclc_function.get_arg_num() == 2) {
-      reference_vector[j] =
-          oclc_function.calculate_reference(input_a[j], input_b[j]);
-    } else {
-      reference_vector[j] = oclc_function.calculate_reference(input_a[j]);
-    }
-  }
+  const auto key = ca::make_reference_key(
+      build_options, oclc_function.get_output_type_name(),
+      ca::hash_inputs(input_a, input_b));
+  const auto reference_vector = ca::get_reference_store().fetch<OUTPUT_TYPE>(
+      key, work_size, [&](std::vector<OUTPUT_TYPE> &reference) {
+        for (auto j = 0; j < work_size; j++) {
+          if (oclc_function.get_arg_num() == 2) {
+            reference[j] =
+                oclc_function.calculate_reference(input_a[j], input_b[j]);
+          } else {
+            reference[j] = oclc_function.calculate_reference(input_a[j]);
+          }
+        }
+      });
   const std::vector<OUTPUT_TYPE> result = test_gentype<OUTPUT_TYPE, INPUT_TYPE>(
       input_a, input_b, build_options, config);
   REQUIRE_THAT(result, (UlpComparator<OUTPUT_TYPE, INPUT_TYPE,
                                       cassian::scalar_type_v<INPUT_TYPE>>(
-                           result, reference_vector, input_a, input_b,
+                           result, reference_vector.span(), input_a, input_b,
                            oclc_function.get_function())));
 }
 
@@ -22,6 +22,7 @@
 #include <enum_definitions.hpp>
 #include <limits>
 #include <map>
+#include <span>
 #include <string>
 #include <variant>
 #include <vector>
@@ -52,6 +53,11 @@ public:
     }
   }
   auto get_function() const { return function; }
+  std::string get_output_type_name() const {
+    return output_type == OutputType::scalar
+               ? TEST_TYPE::scalar_type::type_name
+               : TEST_TYPE::type_name;
+  }
   std::string get_build_options(const std::string &function_string) const {
     std::stringstream ss;
     ss << "-DOUTPUT_TYPE="
@@ -267,14 +273,14 @@ bool match_results(const T &result, const T &reference, const T &ulp_value,
 
 template <typename OUTPUT_TYPE, typename INPUT_TYPE, typename SCALAR_TYPE>
 class UlpComparator : public Catch::MatcherBase<std::vector<OUTPUT_TYPE>> {
-  std::vector<OUTPUT_TYPE> reference;
+  std::span<const OUTPUT_TYPE> reference;
   std::vector<OUTPUT_TYPE> result;
   Function function;
   std::vector<SCALAR_TYPE> ulp_values;
 
 public:
   UlpComparator(const std::vector<OUTPUT_TYPE> &result,
-                const std::vector<OUTPUT_TYPE> &reference,
+                std::span<const OUTPUT_TYPE> reference,
                 const std::vector<INPUT_TYPE> &input_a,
                 const std::vector<INPUT_TYPE> &input_b,
                 const Function &function)
@@ -307,7 +313,9 @@ public:
       }
     }
     os << '}';
-    return "\nreference: " + input_to_string(reference) +
+    return "\nreference: " +
+           input_to_string(
+               std::vector<OUTPUT_TYPE>(reference.begin(), reference.end())) +
            "\nULP distance: " + os.str();
   }
 };
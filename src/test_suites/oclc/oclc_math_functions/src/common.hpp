@@ -27,6 +27,7 @@
 #include <limits>
 #include <numbers>
 #include <ostream>
+#include <reference_backend.hpp>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -133,7 +134,7 @@ void run_template_enum_test_case(
 template <typename TestType> auto test_name() {
   return std::string(TestType::type_name);
 }
-enum class SectionType : uint32_t { random, edge };
+enum class SectionType : uint32_t { random, edge, exhaustive };
 
 template <SectionType section_type>
 std::string create_section_name(const std::string_view &function_string,
@@ -145,6 +146,8 @@ std::string create_section_name(const std::string_view &function_string,
     ss << "random";
   } else if constexpr (SectionType::edge == section_type) {
     ss << "edge";
+  } else if constexpr (SectionType::exhaustive == section_type) {
+    ss << "exhaustive";
   }
   if (current_number + 1 < max_number) {
     ss << " " << std::to_string(current_number + 1);
@@ -179,92 +182,114 @@ auto randomize_input(const std::vector<T> &input) {
   return randomized_input;
 }
 
-template <typename T, typename Enable = void>
-struct ReplaceFloatingPointWithDouble {
+template <typename T, bool WIDE = false, typename Enable = void>
+struct ReplaceFloatingPointWithReference {
   using type = T;
 };
 
-template <typename T>
-using replace_fp_with_double_t =
-    typename ReplaceFloatingPointWithDouble<T>::type;
-
-template <typename T>
-struct ReplaceFloatingPointWithDouble<
-    T, std::enable_if_t<ca::is_floating_point_v<T>>> {
-  using type = double;
+template <typename T, bool WIDE = false>
+using replace_fp_with_reference_t =
+    typename ReplaceFloatingPointWithReference<T, WIDE>::type;
+
+// References are computed in double. Wide double references are computed in
+// long double instead, so that they keep extra bits over the tested result,
+// and are used only when a higher precision backend is selected.
+template <typename T, bool WIDE>
+struct ReplaceFloatingPointWithReference<
+    T, WIDE, std::enable_if_t<ca::is_floating_point_v<T>>> {
+  using type = std::conditional_t<WIDE && (sizeof(T) > sizeof(float)),
+                                  long double, double>;
 };
 
-template <typename T>
-struct ReplaceFloatingPointWithDouble<
-    T, std::enable_if_t<ca::is_vector_v<T> &&
-                        ca::is_floating_point_v<typename T::value_type>>> {
-  using type = typename ca::Vector<double, T::vector_size, T::size_in_memory>;
+template <typename T, bool WIDE>
+struct ReplaceFloatingPointWithReference<
+    T, WIDE,
+    std::enable_if_t<ca::is_vector_v<T> &&
+                     ca::is_floating_point_v<typename T::value_type>>> {
+  using type = typename ca::Vector<
+      replace_fp_with_reference_t<typename T::value_type, WIDE>,
+      T::vector_size, T::size_in_memory>;
 };
 
+template <typename T, bool WIDE = false>
+using reference_scalar_t =
+    ca::scalar_type_v<replace_fp_with_reference_t<T, WIDE>>;
+
+// Functions required to be exact are rounded once to double, rounding a long
+// double intermediate result again can differ from the correctly rounded one.
+template <typename T, bool WIDE = false>
+using exact_scalar_t =
+    std::conditional_t<std::is_same_v<ca::scalar_type_v<T>, double>, double,
+                       reference_scalar_t<T, WIDE>>;
+
 template <typename T> bool powr_special_case(T input_a, T input_b) {
   using std::isinf;
   return (input_a == 0 && input_b == 0) || (isinf(input_a) && input_b == 0) ||
          (input_a == 1 && isinf(input_b)) || (input_a == -1 && isinf(input_b));
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_acos(const T &input) {
-  using std::acos;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_acos(const T &input) {
+  using reference_math::acos;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = acos(static_cast<double>(input[i]));
+      result[i] = acos(static_cast<real_t>(input[i]));
     }
     return result;
   } else {
-    return acos(static_cast<double>(input));
+    return acos(static_cast<real_t>(input));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_acosh(const T &input) {
-  using std::acosh;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_acosh(const T &input) {
+  using reference_math::acosh;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = acosh(static_cast<double>(input[i]));
+      result[i] = acosh(static_cast<real_t>(input[i]));
     }
     return result;
   } else {
-    return acosh(static_cast<double>(input));
+    return acosh(static_cast<real_t>(input));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_asin(const T &input) {
-  using std::asin;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_asin(const T &input) {
+  using reference_math::asin;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = asin(static_cast<double>(input[i]));
+      result[i] = asin(static_cast<real_t>(input[i]));
     }
     return result;
   } else {
-    return asin(static_cast<double>(input));
+    return asin(static_cast<real_t>(input));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_asinh(const T &input) {
-  using std::asinh;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_asinh(const T &input) {
+  using reference_math::asinh;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = asinh(static_cast<double>(input[i]));
+      result[i] = asinh(static_cast<real_t>(input[i]));
     }
     return result;
   } else {
-    return asinh(static_cast<double>(input));
+    return asinh(static_cast<real_t>(input));
   }
 }
 
 template <typename T>
-replace_fp_with_double_t<T>
+replace_fp_with_reference_t<T>
 calculate_asinh_derived_check(const T &input, double ulp_tolerance = 4.0) {
   using scalar_type = ca::scalar_type_v<T>;
   using std::asinh;
@@ -290,7 +315,7 @@ calculate_asinh_derived_check(const T &input, double ulp_tolerance = 4.0) {
   const double min_safe_input = -max_safe_input;
 
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T> result{};
     for (auto i = 0; i < T::vector_size; i++) {
       double input_val = static_cast<double>(input[i]);
 
@@ -326,380 +351,261 @@ calculate_asinh_derived_check(const T &input, double ulp_tolerance = 4.0) {
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_acospi(const T &input) {
-  using std::acos;
-  double pi_value = std::numbers::pi;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_acospi(const T &input) {
+  using reference_math::acos;
+  using real_t = reference_scalar_t<T, WIDE>;
+  real_t pi_value = std::numbers::pi_v<real_t>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = acos(static_cast<double>(input[i])) / pi_value;
+      result[i] = acos(static_cast<real_t>(input[i])) / pi_value;
     }
     return result;
   } else {
-    return acos(static_cast<double>(input)) / pi_value;
+    return acos(static_cast<real_t>(input)) / pi_value;
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_asinpi(const T &input) {
-  using std::asin;
-  double pi_value = std::numbers::pi;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_asinpi(const T &input) {
+  using reference_math::asin;
+  using real_t = reference_scalar_t<T, WIDE>;
+  real_t pi_value = std::numbers::pi_v<real_t>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = asin(static_cast<double>(input[i])) / pi_value;
+      result[i] = asin(static_cast<real_t>(input[i])) / pi_value;
     }
     return result;
   } else {
-    return asin(static_cast<double>(input)) / pi_value;
+    return asin(static_cast<real_t>(input)) / pi_value;
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_atan(const T &input) {
-  using std::atan;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_atan(const T &input) {
+  using reference_math::atan;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = atan(static_cast<double>(input[i]));
+      result[i] = atan(static_cast<real_t>(input[i]));
     }
     return result;
   } else {
-    return atan(static_cast<double>(input));
+    return atan(static_cast<real_t>(input));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_atan2(const T &input_a,
-                                            const T &input_b) {
-  using std::atan2;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_atan2(const T &input_a,
+                                                     const T &input_b) {
+  using reference_math::atan2;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = atan2(static_cast<double>(input_a[i]),
-                        static_cast<double>(input_b[i]));
+      result[i] = atan2(static_cast<real_t>(input_a[i]),
+                        static_cast<real_t>(input_b[i]));
     }
     return result;
   } else {
-    return atan2(static_cast<double>(input_a), static_cast<double>(input_b));
+    return atan2(static_cast<real_t>(input_a), static_cast<real_t>(input_b));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_atanh(const T &input_a) {
-  using std::atanh;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_atanh(const T &input_a) {
+  using reference_math::atanh;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = atanh(static_cast<double>(input_a[i]));
+      result[i] = atanh(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return atanh(static_cast<double>(input_a));
+    return atanh(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_atanpi(const T &input_a) {
-  using std::atan;
-  double pi_value = std::numbers::pi;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_atanpi(const T &input_a) {
+  using reference_math::atan;
+  using real_t = reference_scalar_t<T, WIDE>;
+  real_t pi_value = std::numbers::pi_v<real_t>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = atan(static_cast<double>(input_a[i])) / pi_value;
+      result[i] = atan(static_cast<real_t>(input_a[i])) / pi_value;
     }
     return result;
   } else {
-    return atan(static_cast<double>(input_a)) / pi_value;
+    return atan(static_cast<real_t>(input_a)) / pi_value;
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_atan2pi(const T &input_a,
-                                              const T &input_b) {
-  using std::atan2;
-  double pi_value = std::numbers::pi;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_atan2pi(const T &input_a,
+                                                       const T &input_b) {
+  using reference_math::atan2;
+  using real_t = reference_scalar_t<T, WIDE>;
+  real_t pi_value = std::numbers::pi_v<real_t>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = atan2(static_cast<double>(input_a[i]),
-                        static_cast<double>(input_b[i])) /
+      result[i] = atan2(static_cast<real_t>(input_a[i]),
+                        static_cast<real_t>(input_b[i])) /
                   pi_value;
     }
     return result;
   } else {
-    return atan2(static_cast<double>(input_a), static_cast<double>(input_b)) /
+    return atan2(static_cast<real_t>(input_a), static_cast<real_t>(input_b)) /
            pi_value;
   }
 }
 
-// --- double-double helper (hi + lo) ---
-struct dd {
-  double hi;
-  double lo;
-};
-
-inline dd make_dd(double value) { return {value, 0.0}; }
-
-inline dd quick_two_sum(double lhs, double rhs) {
-  double sum = lhs + rhs;
-  double error = rhs - (sum - lhs);
-  return {sum, error};
-}
-
-inline dd two_sum(double lhs, double rhs) {
-  double sum = lhs + rhs;
-  double b_virtual = sum - lhs;
-  double error = (lhs - (sum - b_virtual)) + (rhs - b_virtual);
-  return {sum, error};
-}
-
-inline dd two_prod(double lhs, double rhs) {
-#if defined(__FMA__) || defined(__FMA) || defined(__FMA4__) || defined(__AVX2__)
-  double product = lhs * rhs;
-  double error = std::fma(lhs, rhs, -product);
-  return {product, error};
-#else
-  // Dekker split
-  constexpr double splitter = 134217729.0; // 2^27+1
-  double c_lhs = splitter * lhs;
-  double lhs_hi = c_lhs - (c_lhs - lhs);
-  double lhs_lo = lhs - lhs_hi;
-  double c_rhs = splitter * rhs;
-  double rhs_hi = c_rhs - (c_rhs - rhs);
-  double rhs_lo = rhs - rhs_hi;
-  double product = lhs * rhs;
-  double error =
-      ((lhs_hi * rhs_hi - product) + lhs_hi * rhs_lo + lhs_lo * rhs_hi) +
-      lhs_lo * rhs_lo;
-  return {product, error};
-#endif
-}
-
-inline dd normalize_dd(double high, double low) {
-  auto sum = quick_two_sum(high, low);
-  return {sum.hi, sum.lo};
-}
-
-inline dd add_dd(dd lhs, dd rhs) {
-  auto sum = two_sum(lhs.hi, rhs.hi);
-  double temp = lhs.lo + rhs.lo + sum.lo;
-  return quick_two_sum(sum.hi, temp);
-}
-
-inline dd sub_dd(dd lhs, dd rhs) {
-  auto sum = two_sum(lhs.hi, -rhs.hi);
-  double temp = lhs.lo - rhs.lo + sum.lo;
-  return quick_two_sum(sum.hi, temp);
-}
-
-inline dd mul_dd(dd lhs, dd rhs) {
-  auto prod = two_prod(lhs.hi, rhs.hi);
-  double temp = lhs.hi * rhs.lo + lhs.lo * rhs.hi + prod.lo;
-  return quick_two_sum(prod.hi, temp);
-}
-
-inline dd div_dd(dd lhs, dd rhs) {
-  double quotient = lhs.hi / rhs.hi;
-  auto prod = mul_dd({quotient, 0.0}, rhs);
-  double remainder = ((lhs.hi - prod.hi) - prod.lo) + lhs.lo;
-  double correction = remainder / rhs.hi;
-  return quick_two_sum(quotient, correction);
-}
-
-// High precision cube root using double-double Newton refinement.
-inline double cbrt_high_precision(double value) {
-  // Edge cases: preserve sign of zero, propagate NaN/Inf.
-  if (value == 0.0 || std::isnan(value) || std::isinf(value)) {
-    return value;
-  }
-  bool is_negative = value < 0.0;
-  double abs_value = is_negative ? -value : value;
-
-  // Decompose abs_value = mantissa * 2^exponent, mantissa in [0.5, 1)
-  int exponent;
-  double mantissa = std::frexp(abs_value, &exponent);
-
-  // Split exponent: exponent = 3*quotient + remainder, remainder in {
-  // -2,-1,0,1,2 } but frexp ensures mantissa in [0.5,1), so remainder will end
-  // up in {0,1,2}. Adjust so that after shifting mantissa stays ~O(1).
-  int quotient = exponent / 3;
-  int remainder = exponent - 3 * quotient; // 0,1,2
-  // Incorporate remainder by scaling mantissa.
-  // abs_value = (mantissa * 2^remainder) * 2^{3*quotient}; thus cbrt(abs_value)
-  // = cbrt(mantissa * 2^remainder) * 2^quotient
-  mantissa = std::ldexp(mantissa, remainder);
-
-  // Initial double precision approximation using std::cbrt for the adjusted
-  // mantissa.
-  double approx = std::cbrt(mantissa);
-
-  // Lift to double-double.
-  dd y_dd = make_dd(approx);
-  dd a_dd = make_dd(mantissa);
-
-  // Perform a few Newton iterations in double-double arithmetic.
-  // For f(y)=y^3 - a, iteration: y_{n+1} = y - (y^3 - a)/(3*y^2)
-  // Reformulated to reduce operations: y_{n+1} = (2*y + a/(y^2)) / 3.
-  // We'll do 3 iterations which should yield ~ 100+ bits then fold to double.
-  auto one_third = make_dd(1.0 / 3.0);
-
-  auto square_dd = [](dd v) { return mul_dd(v, v); };
-  auto cube_dd = [&](dd v) { return mul_dd(mul_dd(v, v), v); };
-
-  for (int i = 0; i < 3; ++i) {
-    dd y_sq = square_dd(y_dd);
-    // a / y^2
-    dd ratio = div_dd(a_dd, y_sq);
-    // 2*y
-    dd y_doubled = add_dd(y_dd, y_dd);
-    // (2*y + a/y^2)
-    dd numerator = add_dd(y_doubled, ratio);
-    // (2*y + a/y^2)/3
-    y_dd = mul_dd(numerator, one_third);
-  }
-
-  // Reattach 2^quotient
-  double high = std::ldexp(y_dd.hi, quotient);
-  double low = std::ldexp(y_dd.lo, quotient);
-  dd result_dd = normalize_dd(high, low);
-  double result = result_dd.hi + result_dd.lo;
-  return is_negative ? -result : result;
-}
-
-template <typename T>
-replace_fp_with_double_t<T> calculate_cbrt(const T &input_a) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_cbrt(const T &input_a) {
+  using reference_math::cbrt;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = cbrt_high_precision(static_cast<double>(input_a[i]));
+      result[i] = cbrt(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return cbrt_high_precision(static_cast<double>(input_a));
+    return cbrt(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_ceil(const T &input_a) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_ceil(const T &input_a) {
   using std::ceil;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = static_cast<double>(ceil(input_a[i]));
+      result[i] = static_cast<real_t>(ceil(input_a[i]));
     }
     return result;
   } else {
-    return static_cast<double>(ceil(input_a));
+    return static_cast<real_t>(ceil(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_copysign(const T &input_a,
-                                               const T &input_b) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_copysign(const T &input_a,
+                                                        const T &input_b) {
   using std::copysign;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = static_cast<double>(copysign(input_a[i], input_b[i]));
+      result[i] = static_cast<real_t>(copysign(input_a[i], input_b[i]));
     }
     return result;
   } else {
-    return static_cast<double>(copysign(input_a, input_b));
+    return static_cast<real_t>(copysign(input_a, input_b));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_sqrt(const T &input_a) {
-  using std::sqrt;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_sqrt(const T &input_a) {
+  using reference_math::sqrt;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = sqrt(static_cast<double>(input_a[i]));
+      result[i] = sqrt(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return sqrt(static_cast<double>(input_a));
+    return sqrt(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_cos(const T &input_a) {
-  using std::cos;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_cos(const T &input_a) {
+  using reference_math::cos;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = cos(static_cast<double>(input_a[i]));
+      result[i] = cos(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return cos(static_cast<double>(input_a));
+    return cos(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_cosh(const T &input_a) {
-  using std::cosh;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_cosh(const T &input_a) {
+  using reference_math::cosh;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = cosh(static_cast<double>(input_a[i]));
+      result[i] = cosh(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return cosh(static_cast<double>(input_a));
+    return cosh(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_cospi_impl(const T &input) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_cospi_impl(const T &input) {
+  using reference_math::cos;
   using std::abs;
-  using std::cos;
   using std::fabs;
   using std::fmod;
   using std::isinf;
-  const double pi_value = std::numbers::pi;
-  auto abs_mod = [](const double &x) { return fabs(fmod(x, 2.0)); };
-  double integer_part{};
-  const double fractional_part =
-      std::modf(static_cast<double>(input), &integer_part);
+  using real_t = reference_scalar_t<T, WIDE>;
+  const real_t pi_value = std::numbers::pi_v<real_t>;
+  auto abs_mod = [](const real_t &x) { return fabs(fmod(x, 2.0)); };
+  real_t integer_part{};
+  const real_t fractional_part =
+      std::modf(static_cast<real_t>(input), &integer_part);
   if (input == static_cast<T>(0.0)) {
     return 1.0;
   } else if (isinf(input)) {
-    return std::numeric_limits<double>::quiet_NaN();
-  } else if (abs_mod(static_cast<double>(input)) == 0.0) {
+    return std::numeric_limits<real_t>::quiet_NaN();
+  } else if (abs_mod(static_cast<real_t>(input)) == 0.0) {
     // Edge case not described in spec
     // makes the reference func closer to mathematical truth.
     return 1.0;
-  } else if (abs_mod(static_cast<double>(input)) == 1.0) {
+  } else if (abs_mod(static_cast<real_t>(input)) == 1.0) {
     // Same as case above.
     return -1.0;
   } else if (abs(fractional_part) == 0.5) {
     return +0.0;
   } else {
-    return cos(pi_value * static_cast<double>(input));
+    return cos(pi_value * static_cast<real_t>(input));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_cospi(const T &input) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_cospi(const T &input) {
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = calculate_cospi_impl(input[i]);
+      result[i] = calculate_cospi_impl<ca::scalar_type_v<T>, WIDE>(input[i]);
     }
     return result;
   } else {
-    return calculate_cospi_impl(input);
+    return calculate_cospi_impl<ca::scalar_type_v<T>, WIDE>(input);
   }
 }
 
-template <typename OUT, typename IN>
-replace_fp_with_double_t<OUT> calculate_ilogb(const IN &input_a) {
+template <typename OUT, typename IN, bool WIDE = false>
+replace_fp_with_reference_t<OUT, WIDE> calculate_ilogb(const IN &input_a) {
   using std::ilogb;
   if constexpr (ca::is_vector_v<IN>) {
-    replace_fp_with_double_t<OUT> result{};
+    replace_fp_with_reference_t<OUT, WIDE> result{};
     for (auto i = 0; i < IN::vector_size; i++) {
       result[i] = ilogb(input_a[i]);
     }
@@ -709,750 +615,802 @@ replace_fp_with_double_t<OUT> calculate_ilogb(const IN &input_a) {
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_erfc(const T &input_a) {
-  using std::erfc;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_erfc(const T &input_a) {
+  using reference_math::erfc;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = erfc(static_cast<double>(input_a[i]));
+      result[i] = erfc(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return erfc(static_cast<double>(input_a));
+    return erfc(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_erf(const T &input_a) {
-  using std::erf;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_erf(const T &input_a) {
+  using reference_math::erf;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = erf(static_cast<double>(input_a[i]));
+      result[i] = erf(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return erf(static_cast<double>(input_a));
+    return erf(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_exp(const T &input_a) {
-  using std::exp;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_exp(const T &input_a) {
+  using reference_math::exp;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = exp(static_cast<double>(input_a[i]));
+      result[i] = exp(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return exp(static_cast<double>(input_a));
+    return exp(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_exp2(const T &input_a) {
-  using std::exp2;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_exp2(const T &input_a) {
+  using reference_math::exp2;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = exp2(static_cast<double>(input_a[i]));
+      result[i] = exp2(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return exp2(static_cast<double>(input_a));
+    return exp2(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_exp10(const T &input_a) {
-  using std::pow;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_exp10(const T &input_a) {
+  using reference_math::pow;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = pow(10.0, static_cast<double>(input_a[i]));
+      result[i] = pow(real_t(10.0), static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return pow(10.0, static_cast<double>(input_a));
+    return pow(real_t(10.0), static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_expm1(const T &input_a) {
-  using std::expm1;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_expm1(const T &input_a) {
+  using reference_math::expm1;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = expm1(static_cast<double>(input_a[i]));
+      result[i] = expm1(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return expm1(static_cast<double>(input_a));
+    return expm1(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_fabs(const T &input_a) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_fabs(const T &input_a) {
   using std::fabs;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = static_cast<double>(fabs(input_a[i]));
+      result[i] = static_cast<real_t>(fabs(input_a[i]));
     }
     return result;
   } else {
-    return static_cast<double>(fabs(input_a));
+    return static_cast<real_t>(fabs(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_fdim(const T &input_a, const T &input_b) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_fdim(const T &input_a,
+                                                    const T &input_b) {
   using std::fdim;
+  using real_t = exact_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = fdim(static_cast<double>(input_a[i]),
-                       static_cast<double>(input_b[i]));
+      result[i] = fdim(static_cast<real_t>(input_a[i]),
+                       static_cast<real_t>(input_b[i]));
     }
     return result;
   } else {
-    return fdim(static_cast<double>(input_a), static_cast<double>(input_b));
+    return fdim(static_cast<real_t>(input_a), static_cast<real_t>(input_b));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_floor(const T &input_a) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_floor(const T &input_a) {
   using std::floor;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = floor(static_cast<double>(input_a[i]));
+      result[i] = floor(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return floor(static_cast<double>(input_a));
+    return floor(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_mad(const T &input_a, const T &input_b,
-                                          const T &input_c) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_mad(const T &input_a,
+                                                   const T &input_b,
+                                                   const T &input_c) {
+  using real_t = exact_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
       result[i] =
-          static_cast<double>(input_a[i]) * static_cast<double>(input_b[i]) +
-          static_cast<double>(input_c[i]);
+          static_cast<real_t>(input_a[i]) * static_cast<real_t>(input_b[i]) +
+          static_cast<real_t>(input_c[i]);
     }
     return result;
   } else {
-    return static_cast<double>(input_a) * static_cast<double>(input_b) +
-           static_cast<double>(input_c);
+    return static_cast<real_t>(input_a) * static_cast<real_t>(input_b) +
+           static_cast<real_t>(input_c);
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_maxmag(const T &input_a,
-                                             const T &input_b) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_maxmag(const T &input_a,
+                                                      const T &input_b) {
   using std::abs;
   using std::fmax;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
       if (abs(input_a[i]) > abs(input_b[i]))
-        result[i] = static_cast<double>(input_a[i]);
+        result[i] = static_cast<real_t>(input_a[i]);
       else if (abs(input_a[i]) < abs(input_b[i]))
-        result[i] = static_cast<double>(input_b[i]);
+        result[i] = static_cast<real_t>(input_b[i]);
       else
-        result[i] = fmax(static_cast<double>(input_a[i]),
-                         static_cast<double>(input_b[i]));
+        result[i] = fmax(static_cast<real_t>(input_a[i]),
+                         static_cast<real_t>(input_b[i]));
     }
     return result;
   } else {
     if (abs(input_a) > abs(input_b))
-      return static_cast<double>(input_a);
+      return static_cast<real_t>(input_a);
     else if (abs(input_a) < abs(input_b))
-      return static_cast<double>(input_b);
+      return static_cast<real_t>(input_b);
     else
-      return fmax(static_cast<double>(input_a), static_cast<double>(input_b));
+      return fmax(static_cast<real_t>(input_a), static_cast<real_t>(input_b));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_minmag(const T &input_a,
-                                             const T &input_b) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_minmag(const T &input_a,
+                                                      const T &input_b) {
   using std::abs;
   using std::fmin;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
       if (abs(input_a[i]) < abs(input_b[i]))
-        result[i] = static_cast<double>(input_a[i]);
+        result[i] = static_cast<real_t>(input_a[i]);
       else if (abs(input_a[i]) > abs(input_b[i]))
-        result[i] = static_cast<double>(input_b[i]);
+        result[i] = static_cast<real_t>(input_b[i]);
       else
-        result[i] = fmin(static_cast<double>(input_a[i]),
-                         static_cast<double>(input_b[i]));
+        result[i] = fmin(static_cast<real_t>(input_a[i]),
+                         static_cast<real_t>(input_b[i]));
     }
     return result;
   } else {
     if (abs(input_a) < abs(input_b))
-      return static_cast<double>(input_a);
+      return static_cast<real_t>(input_a);
     else if (abs(input_a) > abs(input_b))
-      return static_cast<double>(input_b);
+      return static_cast<real_t>(input_b);
     else
-      return static_cast<double>(fmin(input_a, input_b));
+      return static_cast<real_t>(fmin(input_a, input_b));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_nextafter(const T &input_a,
-                                                const T &input_b) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_nextafter(const T &input_a,
+                                                         const T &input_b) {
   using std::nextafter;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = static_cast<double>(nextafter(input_a[i], input_b[i]));
+      result[i] = static_cast<real_t>(nextafter(input_a[i], input_b[i]));
     }
     return result;
   } else {
-    return static_cast<double>(nextafter(input_a, input_b));
+    return static_cast<real_t>(nextafter(input_a, input_b));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_pow(const T &input_a, const T &input_b) {
-  using std::pow;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_pow(const T &input_a,
+                                                   const T &input_b) {
+  using reference_math::pow;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
       result[i] =
-          pow(static_cast<double>(input_a[i]), static_cast<double>(input_b[i]));
+          pow(static_cast<real_t>(input_a[i]), static_cast<real_t>(input_b[i]));
     }
     return result;
   } else {
-    return pow(static_cast<double>(input_a), static_cast<double>(input_b));
+    return pow(static_cast<real_t>(input_a), static_cast<real_t>(input_b));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_remainder(const T &input_a,
-                                                const T &input_b) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_remainder(const T &input_a,
+                                                         const T &input_b) {
   using std::remainder;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = remainder(static_cast<double>(input_a[i]),
-                            static_cast<double>(input_b[i]));
+      result[i] = remainder(static_cast<real_t>(input_a[i]),
+                            static_cast<real_t>(input_b[i]));
     }
     return result;
   } else {
-    return remainder(static_cast<double>(input_a),
-                     static_cast<double>(input_b));
+    return remainder(static_cast<real_t>(input_a),
+                     static_cast<real_t>(input_b));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_rint(const T &input_a) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_rint(const T &input_a) {
   using std::rint;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = static_cast<double>(rint(input_a[i]));
+      result[i] = static_cast<real_t>(rint(input_a[i]));
     }
     return result;
   } else {
-    return static_cast<double>(rint(input_a));
+    return static_cast<real_t>(rint(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_round(const T &input_a) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_round(const T &input_a) {
   using std::round;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = static_cast<double>(round(input_a[i]));
+      result[i] = static_cast<real_t>(round(input_a[i]));
     }
     return result;
   } else {
-    return static_cast<double>(round(input_a));
+    return static_cast<real_t>(round(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_rsqrt(const T &input_a) {
-  using std::sqrt;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_rsqrt(const T &input_a) {
+  using reference_math::sqrt;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = 1.0 / sqrt(static_cast<double>(input_a[i]));
+      result[i] = 1.0 / sqrt(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return 1.0 / sqrt(static_cast<double>(input_a));
+    return 1.0 / sqrt(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_sin(const T &input) {
-  using std::sin;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_sin(const T &input) {
+  using reference_math::sin;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = sin(static_cast<double>(input[i]));
+      result[i] = sin(static_cast<real_t>(input[i]));
     }
     return result;
   } else {
-    return sin(static_cast<double>(input));
+    return sin(static_cast<real_t>(input));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_sinh(const T &input) {
-  using std::sinh;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_sinh(const T &input) {
+  using reference_math::sinh;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = sinh(static_cast<double>(input[i]));
+      result[i] = sinh(static_cast<real_t>(input[i]));
     }
     return result;
   } else {
-    return sinh(static_cast<double>(input));
+    return sinh(static_cast<real_t>(input));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_sinpi_impl(const T &input) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_sinpi_impl(const T &input) {
+  using reference_math::sin;
   using std::copysign;
   using std::isinf;
-  using std::sin;
   using std::trunc;
-  const double pi_value = std::numbers::pi;
+  using real_t = reference_scalar_t<T, WIDE>;
+  const real_t pi_value = std::numbers::pi_v<real_t>;
   if (input == static_cast<T>(0.0)) {
-    return copysign(0.0, static_cast<double>(input));
+    return copysign(0.0, static_cast<real_t>(input));
   } else if (isinf(input)) {
-    return std::numeric_limits<double>::quiet_NaN();
+    return std::numeric_limits<real_t>::quiet_NaN();
   } else if (trunc(input) == input) {
-    return copysign(0.0, static_cast<double>(input));
+    return copysign(0.0, static_cast<real_t>(input));
   } else {
-    return sin(pi_value * static_cast<double>(input));
+    return sin(pi_value * static_cast<real_t>(input));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_sinpi(const T &input) {
-  const double pi_value = std::numbers::pi;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_sinpi(const T &input) {
+  using real_t = reference_scalar_t<T, WIDE>;
+  const real_t pi_value = std::numbers::pi_v<real_t>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = calculate_sinpi_impl(input[i]);
+      result[i] = calculate_sinpi_impl<ca::scalar_type_v<T>, WIDE>(input[i]);
     }
     return result;
   } else {
-    return calculate_sinpi_impl(input);
+    return calculate_sinpi_impl<ca::scalar_type_v<T>, WIDE>(input);
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_tan(const T &input) {
-  using std::tan;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_tan(const T &input) {
+  using reference_math::tan;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = tan(static_cast<double>(input[i]));
+      result[i] = tan(static_cast<real_t>(input[i]));
     }
     return result;
   } else {
-    return tan(static_cast<double>(input));
+    return tan(static_cast<real_t>(input));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_tanh(const T &input) {
-  using std::tanh;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_tanh(const T &input) {
+  using reference_math::tanh;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = tanh(static_cast<double>(input[i]));
+      result[i] = tanh(static_cast<real_t>(input[i]));
     }
     return result;
   } else {
-    return tanh(static_cast<double>(input));
+    return tanh(static_cast<real_t>(input));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_tanpi_impl(const T &input) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_tanpi_impl(const T &input) {
+  using reference_math::cos;
+  using reference_math::sin;
   using std::copysign;
-  using std::cos;
   using std::fabs;
   using std::fmod;
   using std::isinf;
-  using std::sin;
-  const double pi_value = std::numbers::pi;
-  auto abs_mod = [](const double &x) { return fabs(fmod(x, 2.0)); };
-  double integer_part{};
-  const double fractional_part =
-      std::modf(static_cast<double>(input), &integer_part);
+  using real_t = reference_scalar_t<T, WIDE>;
+  const real_t pi_value = std::numbers::pi_v<real_t>;
+  auto abs_mod = [](const real_t &x) { return fabs(fmod(x, 2.0)); };
+  real_t integer_part{};
+  const real_t fractional_part =
+      std::modf(static_cast<real_t>(input), &integer_part);
   if (input == static_cast<T>(0.0)) {
-    return copysign(0.0, static_cast<double>(input));
+    return copysign(0.0, static_cast<real_t>(input));
   } else if (isinf(input)) {
-    return std::numeric_limits<double>::quiet_NaN();
-  } else if (abs_mod(static_cast<double>(input)) == 0.0) {
-    return copysign(0.0, static_cast<double>(input));
-  } else if (abs_mod(static_cast<double>(input)) == 1.0) {
-    return copysign(0.0, -static_cast<double>(input));
-  } else if (abs_mod(static_cast<double>(input) - 0.5) == 0.0 &&
+    return std::numeric_limits<real_t>::quiet_NaN();
+  } else if (abs_mod(static_cast<real_t>(input)) == 0.0) {
+    return copysign(0.0, static_cast<real_t>(input));
+  } else if (abs_mod(static_cast<real_t>(input)) == 1.0) {
+    return copysign(0.0, -static_cast<real_t>(input));
+  } else if (abs_mod(static_cast<real_t>(input) - 0.5) == 0.0 &&
              fabs(fractional_part) == 0.5) {
-    return std::numeric_limits<double>::infinity();
-  } else if (abs_mod(static_cast<double>(input) - 0.5) == 1.0 &&
+    return std::numeric_limits<real_t>::infinity();
+  } else if (abs_mod(static_cast<real_t>(input) - 0.5) == 1.0 &&
              fabs(fractional_part) == 0.5) {
-    return -std::numeric_limits<double>::infinity();
+    return -std::numeric_limits<real_t>::infinity();
   } else {
-    return sin(pi_value * static_cast<double>(input)) /
-           cos(pi_value * static_cast<double>(input));
+    return sin(pi_value * static_cast<real_t>(input)) /
+           cos(pi_value * static_cast<real_t>(input));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_tanpi(const T &input) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_tanpi(const T &input) {
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = calculate_tanpi_impl(input[i]);
+      result[i] = calculate_tanpi_impl<ca::scalar_type_v<T>, WIDE>(input[i]);
     }
     return result;
   } else {
-    return calculate_tanpi_impl(input);
+    return calculate_tanpi_impl<ca::scalar_type_v<T>, WIDE>(input);
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_tgamma(const T &input) {
-  using std::tgamma;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_tgamma(const T &input) {
+  using reference_math::tgamma;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = tgamma(static_cast<double>(input[i]));
+      result[i] = tgamma(static_cast<real_t>(input[i]));
     }
     return result;
   } else {
-    return tgamma(static_cast<double>(input));
+    return tgamma(static_cast<real_t>(input));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_trunc(const T &input) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_trunc(const T &input) {
   using std::trunc;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = static_cast<double>(trunc(input[i]));
+      result[i] = static_cast<real_t>(trunc(input[i]));
     }
     return result;
   } else {
-    return static_cast<double>(trunc(input));
+    return static_cast<real_t>(trunc(input));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_divide(const T &input_a,
-                                             const T &input_b) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_divide(const T &input_a,
+                                                      const T &input_b) {
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
       result[i] =
-          static_cast<double>(input_a[i]) / static_cast<double>(input_b[i]);
+          static_cast<real_t>(input_a[i]) / static_cast<real_t>(input_b[i]);
     }
     return result;
   } else {
-    return static_cast<double>(input_a) / static_cast<double>(input_b);
+    return static_cast<real_t>(input_a) / static_cast<real_t>(input_b);
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_recip(const T &input) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_recip(const T &input) {
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = 1.0 / static_cast<double>(input[i]);
+      result[i] = 1.0 / static_cast<real_t>(input[i]);
     }
     return result;
   } else {
-    return 1.0 / static_cast<double>(input);
+    return 1.0 / static_cast<real_t>(input);
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_fma(const T &input_a, const T &input_b,
-                                          const T &input_c) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_fma(const T &input_a,
+                                                   const T &input_b,
+                                                   const T &input_c) {
   using std::fma;
+  using real_t = exact_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
       result[i] =
-          fma(static_cast<double>(input_a[i]), static_cast<double>(input_b[i]),
-              static_cast<double>(input_c[i]));
+          fma(static_cast<real_t>(input_a[i]), static_cast<real_t>(input_b[i]),
+              static_cast<real_t>(input_c[i]));
     }
     return result;
   } else {
-    return fma(static_cast<double>(input_a), static_cast<double>(input_b),
-               static_cast<double>(input_c));
+    return fma(static_cast<real_t>(input_a), static_cast<real_t>(input_b),
+               static_cast<real_t>(input_c));
   }
 }
 
-template <typename T, typename T_1 = T>
-replace_fp_with_double_t<T> calculate_fmax(const T &input_a,
-                                           const T_1 &input_b) {
+template <typename T, typename T_1 = T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_fmax(const T &input_a,
+                                                    const T_1 &input_b) {
   using std::fmax;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
       if constexpr (ca::is_vector_v<T_1>) {
-        result[i] = fmax(static_cast<double>(input_a[i]),
-                         static_cast<double>(input_b[i]));
+        result[i] = fmax(static_cast<real_t>(input_a[i]),
+                         static_cast<real_t>(input_b[i]));
       } else {
         result[i] =
-            fmax(static_cast<double>(input_a[i]), static_cast<double>(input_b));
+            fmax(static_cast<real_t>(input_a[i]), static_cast<real_t>(input_b));
       }
     }
     return result;
   } else {
-    return fmax(static_cast<double>(input_a), static_cast<double>(input_b));
+    return fmax(static_cast<real_t>(input_a), static_cast<real_t>(input_b));
   }
 }
 
-template <typename T, typename T_1 = T>
-replace_fp_with_double_t<T> calculate_fmin(const T &input_a,
-                                           const T_1 &input_b) {
+template <typename T, typename T_1 = T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_fmin(const T &input_a,
+                                                    const T_1 &input_b) {
   using std::fmin;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
       if constexpr (ca::is_vector_v<T_1>) {
-        result[i] = fmin(static_cast<double>(input_a[i]),
-                         static_cast<double>(input_b[i]));
+        result[i] = fmin(static_cast<real_t>(input_a[i]),
+                         static_cast<real_t>(input_b[i]));
       } else {
         result[i] =
-            fmin(static_cast<double>(input_a[i]), static_cast<double>(input_b));
+            fmin(static_cast<real_t>(input_a[i]), static_cast<real_t>(input_b));
       }
     }
     return result;
   } else {
-    return fmin(static_cast<double>(input_a), static_cast<double>(input_b));
+    return fmin(static_cast<real_t>(input_a), static_cast<real_t>(input_b));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_fmod(const T &input_a, const T &input_b) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_fmod(const T &input_a,
+                                                    const T &input_b) {
   using std::fmod;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = fmod(static_cast<double>(input_a[i]),
-                       static_cast<double>(input_b[i]));
+      result[i] = fmod(static_cast<real_t>(input_a[i]),
+                       static_cast<real_t>(input_b[i]));
     }
     return result;
   } else {
-    return fmod(static_cast<double>(input_a), static_cast<double>(input_b));
+    return fmod(static_cast<real_t>(input_a), static_cast<real_t>(input_b));
   }
 }
 
-template <typename T, typename T_1 = T>
-replace_fp_with_double_t<T> calculate_ldexp(const T &input_a,
-                                            const T_1 &input_b) {
+template <typename T, typename T_1 = T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_ldexp(const T &input_a,
+                                                     const T_1 &input_b) {
   using std::ldexp;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
       if constexpr (ca::is_vector_v<T_1>) {
-        result[i] = ldexp(static_cast<double>(input_a[i]), input_b[i]);
+        result[i] = ldexp(static_cast<real_t>(input_a[i]), input_b[i]);
       } else {
-        result[i] = ldexp(static_cast<double>(input_a[i]), input_b);
+        result[i] = ldexp(static_cast<real_t>(input_a[i]), input_b);
       }
     }
     return result;
   } else {
-    return ldexp(static_cast<double>(input_a), input_b);
+    return ldexp(static_cast<real_t>(input_a), input_b);
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_hypot(const T &input_a,
-                                            const T &input_b) {
-  using std::hypot;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_hypot(const T &input_a,
+                                                     const T &input_b) {
+  using reference_math::hypot;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = hypot(static_cast<double>(input_a[i]),
-                        static_cast<double>(input_b[i]));
+      result[i] = hypot(static_cast<real_t>(input_a[i]),
+                        static_cast<real_t>(input_b[i]));
     }
     return result;
   } else {
-    return hypot(static_cast<double>(input_a), static_cast<double>(input_b));
+    return hypot(static_cast<real_t>(input_a), static_cast<real_t>(input_b));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_lgamma(const T &input_a) {
-  using std::lgamma;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_lgamma(const T &input_a) {
+  using reference_math::lgamma;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = lgamma(static_cast<double>(input_a[i]));
+      result[i] = lgamma(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return lgamma(static_cast<double>(input_a));
+    return lgamma(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_log(const T &input_a) {
-  using std::log;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_log(const T &input_a) {
+  using reference_math::log;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = log(static_cast<double>(input_a[i]));
+      result[i] = log(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return log(static_cast<double>(input_a));
+    return log(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_log2(const T &input_a) {
-  using std::log2;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_log2(const T &input_a) {
+  using reference_math::log2;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = log2(static_cast<double>(input_a[i]));
+      result[i] = log2(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return log2(static_cast<double>(input_a));
+    return log2(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_log10(const T &input_a) {
-  using std::log10;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_log10(const T &input_a) {
+  using reference_math::log10;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = log10(static_cast<double>(input_a[i]));
+      result[i] = log10(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return log10(static_cast<double>(input_a));
+    return log10(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_log1p(const T &input_a) {
-  using std::log1p;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_log1p(const T &input_a) {
+  using reference_math::log1p;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = log1p(static_cast<double>(input_a[i]));
+      result[i] = log1p(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return log1p(static_cast<double>(input_a));
+    return log1p(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_logb(const T &input_a) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_logb(const T &input_a) {
   using std::logb;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = logb(static_cast<double>(input_a[i]));
+      result[i] = logb(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    return logb(static_cast<double>(input_a));
+    return logb(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T_1, typename T_2>
-replace_fp_with_double_t<T_1> calculate_nan(const T_2 &input_a) {
+template <typename T_1, typename T_2, bool WIDE = false>
+replace_fp_with_reference_t<T_1, WIDE> calculate_nan(const T_2 &input_a) {
+  using real_t = reference_scalar_t<T_1, WIDE>;
   if constexpr (ca::is_vector_v<T_2>) {
-    replace_fp_with_double_t<T_1> result{};
+    replace_fp_with_reference_t<T_1, WIDE> result{};
     for (auto i = 0; i < T_1::vector_size; i++) {
-      result[i] = static_cast<double>(
+      result[i] = static_cast<real_t>(
           std::numeric_limits<typename T_1::value_type>::quiet_NaN());
     }
     return result;
   } else {
-    return std::numeric_limits<double>::quiet_NaN();
+    return std::numeric_limits<real_t>::quiet_NaN();
   }
 }
 
-template <typename T_1, typename T_2>
-replace_fp_with_double_t<T_1> calculate_pown(const T_1 &input_a,
-                                             const T_2 &input_b) {
-  using std::pow;
+template <typename T_1, typename T_2, bool WIDE = false>
+replace_fp_with_reference_t<T_1, WIDE> calculate_pown(const T_1 &input_a,
+                                                      const T_2 &input_b) {
+  using reference_math::pow;
+  using real_t = reference_scalar_t<T_1, WIDE>;
   if constexpr (ca::is_vector_v<T_1>) {
-    replace_fp_with_double_t<T_1> result{};
+    replace_fp_with_reference_t<T_1, WIDE> result{};
     for (auto i = 0; i < T_1::vector_size; i++) {
-      result[i] = pow(static_cast<double>(input_a[i]), input_b[i]);
+      result[i] = pow(static_cast<real_t>(input_a[i]),
+                      static_cast<real_t>(input_b[i]));
     }
     return result;
   } else {
-    return pow(static_cast<double>(input_a), input_b);
+    return pow(static_cast<real_t>(input_a), static_cast<real_t>(input_b));
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_powr(const T &input_a, const T &input_b) {
-  using std::pow;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_powr(const T &input_a,
+                                                    const T &input_b) {
+  using reference_math::pow;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
       if (powr_special_case(input_a[i], input_b[i])) {
-        result[i] = static_cast<double>(
+        result[i] = static_cast<real_t>(
             std::numeric_limits<typename T::value_type>::quiet_NaN());
       } else {
-        result[i] += pow(static_cast<double>(input_a[i]),
-                         static_cast<double>(input_b[i]));
+        result[i] += pow(static_cast<real_t>(input_a[i]),
+                         static_cast<real_t>(input_b[i]));
       }
     }
     return result;
   } else {
     if (powr_special_case(input_a, input_b)) {
-      return static_cast<double>(std::numeric_limits<T>::quiet_NaN());
+      return static_cast<real_t>(std::numeric_limits<T>::quiet_NaN());
     } else {
-      return pow(static_cast<double>(input_a), static_cast<double>(input_b));
+      return pow(static_cast<real_t>(input_a), static_cast<real_t>(input_b));
     }
   }
 }
 
-template <typename T_1, typename T_2>
-replace_fp_with_double_t<T_1> calculate_rootn_impl(const T_1 &rad,
-                                                   const T_2 &index) {
+template <typename T_1, typename T_2, bool WIDE = false>
+replace_fp_with_reference_t<T_1, WIDE> calculate_rootn_impl(const T_1 &rad,
+                                                            const T_2 &index) {
+  using reference_math::pow;
   using std::abs;
   using std::copysign;
   using std::isinf;
   using std::isnan;
-  using std::pow;
-  double radicand = static_cast<double>(rad);
-  const double absRadicand = abs(static_cast<double>(radicand));
+  using real_t = reference_scalar_t<T_1, WIDE>;
+  real_t radicand = static_cast<real_t>(rad);
+  const real_t absRadicand = abs(static_cast<real_t>(radicand));
   bool indexIsOdd = index % 2;
 
-  if (isnan(static_cast<double>(index)) ||
-      (isnan(radicand) && !isinf(static_cast<double>(index)))
+  if (isnan(static_cast<real_t>(index)) ||
+      (isnan(radicand) && !isinf(static_cast<real_t>(index)))
       // 7.5.1. Additional Requirements Beyond C99 TC2
       // rootn(x, 0) returns a NaN.
       // rootn(x, n) returns a NaN for x < 0 and n is even.
       || index == 0 || (radicand < -0.0 && !indexIsOdd)) {
-    return static_cast<double>(std::numeric_limits<T_1>::quiet_NaN());
-  } else if (isinf(static_cast<double>(index))) {
+    return static_cast<real_t>(std::numeric_limits<T_1>::quiet_NaN());
+  } else if (isinf(static_cast<real_t>(index))) {
     // no clear definition neither in OpenCL standard, nor in  IEEE 754,
     // hence deriving from std::pow(radicand, 0)
     // pow(base, +-0) returns 1 for any base, even when base is NaN.
@@ -1462,7 +1420,7 @@ replace_fp_with_double_t<T_1> calculate_rootn_impl(const T_1 &rad,
     // simplicity.
     return 1.0;
   } else if (isinf(radicand)) {
-    return copysign(static_cast<double>(std::numeric_limits<T_1>::infinity()),
+    return copysign(static_cast<real_t>(std::numeric_limits<T_1>::infinity()),
                     radicand);
   } else if (absRadicand == 0.0 && index > 0) {
     // 7.5.1. Additional Requirements Beyond C99 TC2
@@ -1473,68 +1431,75 @@ replace_fp_with_double_t<T_1> calculate_rootn_impl(const T_1 &rad,
     // 7.5.1. Additional Requirements Beyond C99 TC2
     // rootn(+-0, n) is +-inf for odd n < 0.
     // rootn(+-0, n) is +inf for even n < 0.
-    return copysign(static_cast<double>(std::numeric_limits<T_1>::infinity()),
+    return copysign(static_cast<real_t>(std::numeric_limits<T_1>::infinity()),
                     indexIsOdd ? radicand : 1.0);
   }
-  return copysign(pow(absRadicand, 1.0 / static_cast<double>(index)), radicand);
+  return copysign(pow(absRadicand, 1.0 / static_cast<real_t>(index)), radicand);
 }
 
-template <typename T_1, typename T_2>
-replace_fp_with_double_t<T_1> calculate_rootn(const T_1 &input_a,
-                                              const T_2 &input_b) {
+template <typename T_1, typename T_2, bool WIDE = false>
+replace_fp_with_reference_t<T_1, WIDE> calculate_rootn(const T_1 &input_a,
+                                                       const T_2 &input_b) {
+  using scalar_type_1 = ca::scalar_type_v<T_1>;
+  using scalar_type_2 = ca::scalar_type_v<T_2>;
   if constexpr (ca::is_vector_v<T_1>) {
-    replace_fp_with_double_t<T_1> result{};
+    replace_fp_with_reference_t<T_1, WIDE> result{};
     for (auto i = 0; i < T_1::vector_size; i++) {
-      result[i] = calculate_rootn_impl(input_a[i], input_b[i]);
+      result[i] = calculate_rootn_impl<scalar_type_1, scalar_type_2, WIDE>(
+          input_a[i], input_b[i]);
     }
     return result;
   } else {
-    return calculate_rootn_impl(input_a, input_b);
+    return calculate_rootn_impl<scalar_type_1, scalar_type_2, WIDE>(input_a,
+                                                                    input_b);
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_fract(const T &input_a, T &input_b) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_fract(const T &input_a,
+                                                     T &input_b) {
   using std::floor;
   using std::fmin;
   using std::isinf;
   using std::isnan;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
       if (isnan(input_a[i])) {
-        result[i] = static_cast<double>(
+        result[i] = static_cast<real_t>(
             std::numeric_limits<typename T::value_type>::quiet_NaN());
       } else if (isinf(input_a[i])) {
         result[i] = 0.0;
       } else {
-        result[i] = std::fmin(static_cast<double>(input_a[i]) -
-                                  floor(static_cast<double>(input_a[i])),
+        result[i] = std::fmin(static_cast<real_t>(input_a[i]) -
+                                  floor(static_cast<real_t>(input_a[i])),
                               0x1.fffffep-1f);
       }
-      input_b[i] = floor(static_cast<double>(input_a[i]));
+      input_b[i] = floor(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
     if (isnan(input_a)) {
-      input_b = floor(static_cast<double>(input_a));
+      input_b = floor(static_cast<real_t>(input_a));
       return std::numeric_limits<T>::quiet_NaN();
-    } else if (isinf(static_cast<double>(input_a))) {
-      input_b = floor(static_cast<double>(input_a));
+    } else if (isinf(static_cast<real_t>(input_a))) {
+      input_b = floor(static_cast<real_t>(input_a));
       return 0;
     } else {
-      input_b = floor(static_cast<double>(input_a));
-      return fmin(input_a - floor(static_cast<double>(input_a)),
+      input_b = floor(static_cast<real_t>(input_a));
+      return fmin(input_a - floor(static_cast<real_t>(input_a)),
                   0x1.fffffep-1f);
     }
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_modf(const T &input_a, T &input_b) {
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_modf(const T &input_a,
+                                                    T &input_b) {
   using std::modf;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
       result[i] = modf(static_cast<double>(input_a[i]), &input_b[i]);
     }
@@ -1544,36 +1509,40 @@ replace_fp_with_double_t<T> calculate_modf(const T &input_a, T &input_b) {
   }
 }
 
-template <typename T>
-replace_fp_with_double_t<T> calculate_sincos(const T &input_a, T &input_b) {
-  using std::cos;
-  using std::sin;
+template <typename T, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_sincos(const T &input_a,
+                                                      T &input_b) {
+  using reference_math::cos;
+  using reference_math::sin;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = sin(static_cast<double>(input_a[i]));
-      input_b[i] = cos(static_cast<double>(input_a[i]));
+      result[i] = sin(static_cast<real_t>(input_a[i]));
+      input_b[i] = cos(static_cast<real_t>(input_a[i]));
     }
     return result;
   } else {
-    input_b = cos(static_cast<double>(input_a));
-    return sin(static_cast<double>(input_a));
+    input_b = cos(static_cast<real_t>(input_a));
+    return sin(static_cast<real_t>(input_a));
   }
 }
 
-template <typename T, typename T_1>
-replace_fp_with_double_t<T> calculate_frexp(const T &input_a, T_1 &input_b) {
+template <typename T, typename T_1, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_frexp(const T &input_a,
+                                                     T_1 &input_b) {
   using std::frexp;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = frexp(static_cast<double>(input_a[i]), &input_b[i]);
+      result[i] = frexp(static_cast<real_t>(input_a[i]), &input_b[i]);
       if (input_b[i] == -1)
         input_b[i] = 0;
     }
     return result;
   } else {
-    auto result = frexp(static_cast<double>(input_a), &input_b);
+    auto result = frexp(static_cast<real_t>(input_a), &input_b);
     if (input_b == -1)
       input_b = 0;
     return result;
@@ -1608,15 +1577,17 @@ T ocl_compatible_remquo(T input_a, T input_b, T_1 *quo_bits) {
   return rem;
 }
 
-template <typename T, typename T_1>
-replace_fp_with_double_t<T> calculate_remquo(const T &input_a, const T &input_b,
-                                             T_1 &input_c) {
+template <typename T, typename T_1, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_remquo(const T &input_a,
+                                                      const T &input_b,
+                                                      T_1 &input_c) {
   using std::fabs;
   using std::isinf;
   using std::isnan;
   using std::remquo;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
       if (isnan(input_a[i])) {
         input_c[i] = 0;
@@ -1631,8 +1602,8 @@ replace_fp_with_double_t<T> calculate_remquo(const T &input_a, const T &input_b,
         continue;
       }
       result[i] =
-          ocl_compatible_remquo(static_cast<double>(input_a[i]),
-                                static_cast<double>(input_b[i]), &input_c[i]);
+          ocl_compatible_remquo(static_cast<real_t>(input_a[i]),
+                                static_cast<real_t>(input_b[i]), &input_c[i]);
     }
     return result;
   } else {
@@ -1642,25 +1613,27 @@ replace_fp_with_double_t<T> calculate_remquo(const T &input_a, const T &input_b,
       input_c = 0;
       return std::numeric_limits<T>::quiet_NaN();
     } else {
-      return ocl_compatible_remquo(static_cast<double>(input_a),
-                                   static_cast<double>(input_b), &input_c);
+      return ocl_compatible_remquo(static_cast<real_t>(input_a),
+                                   static_cast<real_t>(input_b), &input_c);
     }
   }
 }
 
-template <typename T, typename T_1>
-replace_fp_with_double_t<T> calculate_lgamma_r(const T &input_a, T_1 &input_b) {
-  using std::lgamma;
+template <typename T, typename T_1, bool WIDE = false>
+replace_fp_with_reference_t<T, WIDE> calculate_lgamma_r(const T &input_a,
+                                                        T_1 &input_b) {
+  using reference_math::lgamma;
+  using real_t = reference_scalar_t<T, WIDE>;
   if constexpr (ca::is_vector_v<T>) {
-    replace_fp_with_double_t<T> result{};
+    replace_fp_with_reference_t<T, WIDE> result{};
     for (auto i = 0; i < T::vector_size; i++) {
-      result[i] = lgamma(static_cast<double>(input_a[i]));
+      result[i] = lgamma(static_cast<real_t>(input_a[i]));
       input_b[i] = input_a[i] > 0 ? 1 : 0;
     }
     return result;
   } else {
     input_b = input_a > 0 ? 1 : 0;
-    return lgamma(static_cast<double>(input_a));
+    return lgamma(static_cast<real_t>(input_a));
   }
 }
 
@@ -8,19 +8,30 @@
 #ifndef CASSIAN_OCLC_MATH_FUNCTIONS_MATH_FUNCTIONS_HPP
 #define CASSIAN_OCLC_MATH_FUNCTIONS_MATH_FUNCTIONS_HPP
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cassian/fp_types/math.hpp>
 #include <cassian/logging/logging.hpp>
+#include <cassian/reference/reference_store.hpp>
 #include <cassian/utility/comparators.hpp>
+#include <cassian/utility/parallel.hpp>
+#include <cassian/utility/utility.hpp>
 #include <cassian/vector/vector.hpp>
 #include <catch2/catch.hpp>
 #include <cmath>
 #include <common.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <enum_definitions.hpp>
 #include <limits>
 #include <math_input_values.hpp>
 #include <numbers>
+#include <optional>
 #include <ostream>
+#include <reference_backend.hpp>
+#include <span>
+#include <sstream>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -46,7 +57,7 @@ struct FunctionProduct {
 };
 
 template <auto FUNCTION, auto ARG_NUM, auto REFERENCE_FUNC,
-          typename OUTPUT_TYPE, auto ADDRESS_SPACE = AddressSpace::clc_global,
+          auto REFERENCE_FUNC_WIDE, typename OUTPUT_TYPE, auto ADDRESS_SPACE = AddressSpace::clc_global,
           typename INPUT_TYPE_1 = OUTPUT_TYPE,
           typename INPUT_TYPE_2 = INPUT_TYPE_1,
           typename INPUT_TYPE_3 = INPUT_TYPE_2,
@@ -66,6 +77,7 @@ public:
   static constexpr auto function = FUNCTION;
   static constexpr auto arg_num = ARG_NUM;
   static constexpr auto calculate_reference = REFERENCE_FUNC;
+  static constexpr auto calculate_reference_wide = REFERENCE_FUNC_WIDE;
   static constexpr auto calculate_reference_derived_check =
       REFERENCE_FUNC_DERIVED_CHECK;
   static constexpr auto address_space = ADDRESS_SPACE;
@@ -751,7 +763,7 @@ std::vector<ca::scalar_type_v<T>> get_ulp_values(const Function &function,
 template <typename OUTPUT_TYPE, typename INPUT_TYPE_1, typename INPUT_TYPE_2>
 std::vector<ca::PrecisionRequirement<
     ca::scalar_type_v<OUTPUT_TYPE>,
-    replace_fp_with_double_t<ca::scalar_type_v<OUTPUT_TYPE>>>>
+    replace_fp_with_reference_t<ca::scalar_type_v<OUTPUT_TYPE>>>>
 requirements_function(const Function &function, const INPUT_TYPE_1 &input_a,
                       const INPUT_TYPE_2 &input_b) {
   using ca::PrecisionRequirement;
@@ -760,7 +772,7 @@ requirements_function(const Function &function, const INPUT_TYPE_1 &input_a,
   using scalar_type = ca::scalar_type_v<INPUT_TYPE_1>;
   using scalar_type_t2 = ca::scalar_type_v<INPUT_TYPE_2>;
   using scalar_type_output = ca::scalar_type_v<OUTPUT_TYPE>;
-  using reference_type = replace_fp_with_double_t<scalar_type_output>;
+  using reference_type = replace_fp_with_reference_t<scalar_type_output>;
   using precision_requirement_t =
       PrecisionRequirement<scalar_type_output, reference_type>;
   constexpr auto epsilon = std::numeric_limits<scalar_type>::epsilon();
@@ -1143,15 +1155,65 @@ test_gentype(const INPUT &input, std::vector<INPUT_B> &argument_2_output,
   return output;
 }
 
-template <class T, typename INPUT>
+template <typename T> std::string reference_type_name() {
+  if constexpr (ca::is_vector_v<T>) {
+    return reference_type_name<typename T::value_type>() +
+           std::to_string(T::vector_size);
+  } else if constexpr (std::is_same_v<T, long double>) {
+    return "long_double";
+  } else if constexpr (std::is_same_v<T, double>) {
+    return "double";
+  } else if constexpr (std::is_same_v<T, float>) {
+    return "float";
+  } else {
+    return std::string(std::is_signed_v<T> ? "int" : "uint") +
+           std::to_string(8 * sizeof(T));
+  }
+}
+
+// References depend only on the function with its types, the type and backend
+// used to evaluate them and the inputs, so they can be reused across runs.
+template <class T, bool WIDE = false>
+ca::ReferenceKey reference_key(const uint64_t input_hash) {
+  using reference_type =
+      replace_fp_with_reference_t<typename T::output_type, WIDE>;
+  using reference_scalar = reference_scalar_t<typename T::output_type, WIDE>;
+  std::string backend = "exact";
+  if constexpr (std::is_floating_point_v<reference_scalar>) {
+    backend = to_string(get_reference_backend<reference_scalar>());
+  }
+  return ca::make_reference_key(
+      T::get_build_options(),
+      "reference-type=" + reference_type_name<reference_type>() +
+          ";reference-backend=" + backend,
+      input_hash);
+}
+
+template <class T, typename INPUT, bool WIDE = false>
 void run_section(INPUT &input, const TestConfig &config) {
+  // Double references are computed in long double only when a higher
+  // precision backend is selected, so they never follow the float backend.
+  if constexpr (!WIDE &&
+                std::is_same_v<typename T::scalar_output_type, double>) {
+    if (use_wide_double_references()) {
+      run_section<T, INPUT, true>(input, config);
+      return;
+    }
+  }
   using output_type = typename T::output_type;
   using input_a_type = typename T::input_type_1;
   using input_b_type = typename T::input_type_2;
   using input_c_type = typename T::input_type_3;
-  using reference_type = replace_fp_with_double_t<output_type>;
-  using reference_type2 = replace_fp_with_double_t<input_b_type>;
-  using reference_type3 = replace_fp_with_double_t<input_c_type>;
+  using reference_type = replace_fp_with_reference_t<output_type, WIDE>;
+  using reference_type2 = replace_fp_with_reference_t<input_b_type, WIDE>;
+  using reference_type3 = replace_fp_with_reference_t<input_c_type, WIDE>;
+  constexpr auto calculate_reference = [] {
+    if constexpr (WIDE) {
+      return T::calculate_reference_wide;
+    } else {
+      return T::calculate_reference;
+    }
+  }();
   using scalar_type_1 = typename T::scalar_type_1;
   const auto work_size = config.work_size();
 
@@ -1159,17 +1221,39 @@ void run_section(INPUT &input, const TestConfig &config) {
   auto reference_vector_2 = std::vector<reference_type2>(
       work_size); // vector for reference values returned by function argument
   auto reference_vector_3 = std::vector<reference_type3>(work_size);
-  for (auto j = 0; j < work_size; j++) {
-    if constexpr (T::arg_num == 3) {
-      reference_vector[j] = T::calculate_reference(
-          input.input_a[j], input.input_b[j], input.input_c[j]);
-      reference_vector_3[j] = static_cast<reference_type3>(input.input_c[j]);
-    } else if constexpr (T::arg_num == 2) {
-      reference_vector[j] =
-          T::calculate_reference(input.input_a[j], input.input_b[j]);
-      reference_vector_2[j] = static_cast<reference_type2>(input.input_b[j]);
-    } else {
-      reference_vector[j] = T::calculate_reference(input.input_a[j]);
+  // Store functions also write their second output to the inputs, so their
+  // references are always computed.
+  const auto &store = ca::get_reference_store();
+  const bool use_store = store.enabled() && !T::get_is_store();
+  ca::ReferenceKey key;
+  std::optional<ca::ReferenceView<reference_type>> cached;
+  if (use_store) {
+    key = reference_key<T, WIDE>(
+        ca::hash_inputs(input.input_a, input.input_b, input.input_c));
+    cached = store.find<reference_type>(key);
+  }
+  if (cached && cached->size() == work_size) {
+    std::copy(cached->begin(), cached->end(), reference_vector.begin());
+  } else {
+    ca::parallel_for(work_size, [&](const size_t begin, const size_t end) {
+      for (auto j = begin; j < end; j++) {
+        if constexpr (T::arg_num == 3) {
+          reference_vector[j] = calculate_reference(
+              input.input_a[j], input.input_b[j], input.input_c[j]);
+          reference_vector_3[j] =
+              static_cast<reference_type3>(input.input_c[j]);
+        } else if constexpr (T::arg_num == 2) {
+          reference_vector[j] =
+              calculate_reference(input.input_a[j], input.input_b[j]);
+          reference_vector_2[j] =
+              static_cast<reference_type2>(input.input_b[j]);
+        } else {
+          reference_vector[j] = calculate_reference(input.input_a[j]);
+        }
+      }
+    });
+    if (use_store) {
+      store.store<reference_type>(key, reference_vector);
     }
   }
   std::vector<input_b_type> argument_2_output(work_size);
@@ -1227,49 +1311,52 @@ void run_section_relaxed(INPUT &input, const TestConfig &config) {
 
   // Calculate references from both implementations
   auto reference_vector_standard =
-      std::vector<replace_fp_with_double_t<output_type>>(work_size);
+      std::vector<replace_fp_with_reference_t<output_type>>(work_size);
   auto reference_vector_derived_check =
-      std::vector<replace_fp_with_double_t<output_type>>(work_size);
+      std::vector<replace_fp_with_reference_t<output_type>>(work_size);
 
   auto reference_vector_2 = std::vector<input_b_type>(work_size);
   auto reference_vector_3 = std::vector<input_c_type>(work_size);
 
-  for (auto j = 0; j < work_size; j++) {
-    if constexpr (T::arg_num == 3) {
-      // Use T::calculate_reference for standard implementation
-      reference_vector_standard[j] = T::calculate_reference(
-          input.input_a[j], input.input_b[j], input.input_c[j]);
-      // Use impl version if it exists
-      if constexpr (has_derived_check_method_v<T>) {
-        reference_vector_derived_check[j] =
-            T::calculate_reference_derived_check(
-                input.input_a[j], input.input_b[j], input.input_c[j]);
-      } else {
-        // Fallback to standard if impl doesn't exist
-        reference_vector_derived_check[j] = reference_vector_standard[j];
-      }
-      reference_vector_3[j] = input.input_c[j];
-    } else if constexpr (T::arg_num == 2) {
-      reference_vector_standard[j] =
-          T::calculate_reference(input.input_a[j], input.input_b[j]);
-      if constexpr (has_derived_check_method_v<T>) {
-        reference_vector_derived_check[j] =
-            T::calculate_reference_derived_check(input.input_a[j],
-                                                 input.input_b[j]);
-      } else {
-        reference_vector_derived_check[j] = reference_vector_standard[j];
-      }
-      reference_vector_2[j] = input.input_b[j];
-    } else {
-      reference_vector_standard[j] = T::calculate_reference(input.input_a[j]);
-      if constexpr (has_derived_check_method_v<T>) {
-        reference_vector_derived_check[j] =
-            T::calculate_reference_derived_check(input.input_a[j]);
+  ca::parallel_for(work_size, [&](const size_t begin, const size_t end) {
+    for (auto j = begin; j < end; j++) {
+      if constexpr (T::arg_num == 3) {
+        // Use T::calculate_reference for standard implementation
+        reference_vector_standard[j] = T::calculate_reference(
+            input.input_a[j], input.input_b[j], input.input_c[j]);
+        // Use impl version if it exists
+        if constexpr (has_derived_check_method_v<T>) {
+          reference_vector_derived_check[j] =
+              T::calculate_reference_derived_check(
+                  input.input_a[j], input.input_b[j], input.input_c[j]);
+        } else {
+          // Fallback to standard if impl doesn't exist
+          reference_vector_derived_check[j] = reference_vector_standard[j];
+        }
+        reference_vector_3[j] = input.input_c[j];
+      } else if constexpr (T::arg_num == 2) {
+        reference_vector_standard[j] =
+            T::calculate_reference(input.input_a[j], input.input_b[j]);
+        if constexpr (has_derived_check_method_v<T>) {
+          reference_vector_derived_check[j] =
+              T::calculate_reference_derived_check(input.input_a[j],
+                                                   input.input_b[j]);
+        } else {
+          reference_vector_derived_check[j] = reference_vector_standard[j];
+        }
+        reference_vector_2[j] = input.input_b[j];
       } else {
-        reference_vector_derived_check[j] = reference_vector_standard[j];
+        reference_vector_standard[j] =
+            T::calculate_reference(input.input_a[j]);
+        if constexpr (has_derived_check_method_v<T>) {
+          reference_vector_derived_check[j] =
+              T::calculate_reference_derived_check(input.input_a[j]);
+        } else {
+          reference_vector_derived_check[j] = reference_vector_standard[j];
+        }
       }
     }
-  }
+  });
 
   std::vector<input_b_type> argument_2_output(work_size);
   std::vector<input_c_type> argument_3_output(work_size);
@@ -1285,7 +1372,7 @@ void run_section_relaxed(INPUT &input, const TestConfig &config) {
 
   for (size_t i = 0; i < work_size; i++) {
     std::vector<ca::PrecisionRequirement<
-        scalar_output_type, replace_fp_with_double_t<scalar_output_type>>>
+        scalar_output_type, replace_fp_with_reference_t<scalar_output_type>>>
         req = requirements_function<output_type>(T::function, input.input_a[i],
                                                  input.input_b[i]);
 
@@ -1416,7 +1503,143 @@ void run_specific_section_relaxed(const std::vector<Value<T>> &input_values) {
   }
 }
 
+template <typename T> T value_from_bits(const uint64_t bits) {
+  if constexpr (std::is_same_v<T, float>) {
+    return std::bit_cast<float>(static_cast<uint32_t>(bits));
+  } else {
+    return T::encode(static_cast<typename T::storage_t>(bits));
+  }
+}
+
+template <class T> constexpr bool supports_exhaustive_section() {
+  using input_type_1 = typename T::input_type_1;
+  if constexpr (T::arg_num != 1 || T::get_is_store() || T::get_is_native() ||
+                ca::is_vector_v<input_type_1>) {
+    return false;
+  } else {
+    return ca::is_floating_point_v<input_type_1> &&
+           sizeof(input_type_1) <= sizeof(float);
+  }
+}
+
+// Sweeps every bit pattern of the input type in chunks of
+// exhaustive_chunk_size. Two sets of buffers are used so that the device
+// computes chunk k while the host calculates the reference for chunk k - 1.
+template <class T> void run_exhaustive_section(const TestConfig &config) {
+  using output_type = typename T::output_type;
+  using input_type_1 = typename T::input_type_1;
+  using reference_type = replace_fp_with_reference_t<output_type>;
+  constexpr uint64_t domain_size = uint64_t(1) << (8 * sizeof(input_type_1));
+  const uint64_t chunk_size =
+      std::min<uint64_t>(config.exhaustive_chunk_size(), domain_size);
+  auto *runtime = config.runtime();
+
+  const std::string source = ca::load_text_file(
+      ca::get_asset("kernels/oclc_math_functions/math_functions.cl"));
+  ca::Kernel kernel = runtime->create_kernel(
+      "test", source, T::get_build_options(), config.program_type());
+
+  struct Slot {
+    ca::Buffer input_buffer;
+    ca::Buffer output_buffer;
+    std::vector<input_type_1> input;
+    std::vector<output_type> output;
+    ca::Event event;
+    uint64_t first = 0;
+    size_t size = 0;
+  };
+  std::array<Slot, 2> slots;
+  // Transfers into slot vectors may still be pending if a chunk failed, they
+  // must complete before the vectors are destroyed
+  const auto f = ca::finally([&]() {
+    for (const auto &slot : slots) {
+      if (slot.input_buffer.id != 0) {
+        runtime->finish(slot.input_buffer.device);
+      }
+      if (slot.output_buffer.id != 0) {
+        runtime->finish(slot.output_buffer.device);
+      }
+    }
+    for (const auto &slot : slots) {
+      if (slot.input_buffer.id != 0) {
+        runtime->release_buffer(slot.input_buffer);
+      }
+      if (slot.output_buffer.id != 0) {
+        runtime->release_buffer(slot.output_buffer);
+      }
+    }
+    runtime->release_kernel(kernel);
+  });
+  for (auto &slot : slots) {
+    slot.input_buffer =
+        runtime->create_buffer(chunk_size * sizeof(input_type_1));
+    slot.output_buffer =
+        runtime->create_buffer(chunk_size * sizeof(output_type));
+    slot.input.resize(chunk_size);
+    slot.output.resize(chunk_size);
+  }
+
+  const auto ulp_value =
+      get_ulp_values<reference_type>(T::function, 1).front();
+  std::vector<reference_type> reference(chunk_size);
+  ca::UlpAccumulator<output_type, reference_type> accumulator;
+
+  // References are not kept in the reference store, entries for every chunk
+  // of a 32-bit domain would take tens of gigabytes.
+  const auto compare_slot = [&](Slot &slot) {
+    ca::parallel_for(slot.size, [&](const size_t begin, const size_t end) {
+      for (auto i = begin; i < end; i++) {
+        reference[i] = T::calculate_reference(slot.input[i]);
+      }
+    });
+    runtime->wait({slot.event});
+    accumulator.accumulate(
+        std::span<const output_type>(slot.output).first(slot.size),
+        std::span<const reference_type>(reference).first(slot.size), ulp_value,
+        slot.first);
+  };
+
+  const uint64_t chunk_count = (domain_size + chunk_size - 1) / chunk_size;
+  for (uint64_t chunk = 0; chunk <= chunk_count; chunk++) {
+    if (chunk < chunk_count) {
+      auto &slot = slots[chunk % 2];
+      slot.first = chunk * chunk_size;
+      slot.size = static_cast<size_t>(
+          std::min<uint64_t>(chunk_size, domain_size - slot.first));
+      ca::parallel_for(slot.size, [&](const size_t begin, const size_t end) {
+        for (auto i = begin; i < end; i++) {
+          slot.input[i] = value_from_bits<input_type_1>(slot.first + i);
+        }
+      });
+      runtime->enqueue_write_buffer(slot.input_buffer, slot.input.data());
+      runtime->set_kernel_argument(kernel, 0, slot.output_buffer);
+      runtime->set_kernel_argument(kernel, 1, slot.input_buffer);
+      runtime->enqueue_run_kernel(kernel, {slot.size, 1, 1});
+      slot.event =
+          runtime->enqueue_read_buffer(slot.output_buffer, slot.output.data());
+    }
+    if (chunk > 0) {
+      compare_slot(slots[(chunk - 1) % 2]);
+    }
+  }
+
+  // Element indices reported by the accumulator are input bit patterns.
+  ca::logging::info() << "Function: " << T::get_function_string()
+                      << " exhaustive:" << accumulator.describe() << '\n';
+  REQUIRE(accumulator.passed());
+}
+
 template <class T> void run_multiple_test_sections() {
+  if constexpr (supports_exhaustive_section<T>()) {
+    const TestConfig &config = get_test_config();
+    if (config.exhaustive()) {
+      SECTION(create_section_name<SectionType::exhaustive>(
+          T::get_function_string(), 0, 1)) {
+        run_exhaustive_section<T>(config);
+      }
+      return;
+    }
+  }
   const auto input = get_gentype_values<T>();
   run_specific_section<T, SectionType::random>(input.random_values);
   run_specific_section<T, SectionType::edge>(input.edge_case_values);
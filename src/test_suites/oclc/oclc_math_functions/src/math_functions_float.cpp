@@ -30,88 +30,128 @@ namespace {
 
 template <typename T>
 using native_cos = OclcFunction<Function::native_cos, 1,
-                                calculate_cos<typename T::host_type>, T>;
+                                calculate_cos<typename T::host_type>,
+                                calculate_cos<typename T::host_type, true>, T>;
 template <typename T>
-using native_divide = OclcFunction<Function::native_divide, 2,
-                                   calculate_divide<typename T::host_type>, T>;
+using native_divide = OclcFunction<
+    Function::native_divide, 2, calculate_divide<typename T::host_type>,
+    calculate_divide<typename T::host_type, true>, T>;
 template <typename T>
 using native_exp = OclcFunction<Function::native_exp, 1,
-                                calculate_exp<typename T::host_type>, T>;
+                                calculate_exp<typename T::host_type>,
+                                calculate_exp<typename T::host_type, true>, T>;
 template <typename T>
 using native_exp2 = OclcFunction<Function::native_exp2, 1,
-                                 calculate_exp2<typename T::host_type>, T>;
+                                 calculate_exp2<typename T::host_type>,
+                                 calculate_exp2<typename T::host_type, true>,
+                                 T>;
 template <typename T>
 using native_exp10 = OclcFunction<Function::native_exp10, 1,
-                                  calculate_exp10<typename T::host_type>, T>;
+                                  calculate_exp10<typename T::host_type>,
+                                  calculate_exp10<typename T::host_type, true>,
+                                  T>;
 template <typename T>
 using native_log = OclcFunction<Function::native_log, 1,
-                                calculate_log<typename T::host_type>, T>;
+                                calculate_log<typename T::host_type>,
+                                calculate_log<typename T::host_type, true>, T>;
 template <typename T>
 using native_log2 = OclcFunction<Function::native_log2, 1,
-                                 calculate_log2<typename T::host_type>, T>;
+                                 calculate_log2<typename T::host_type>,
+                                 calculate_log2<typename T::host_type, true>,
+                                 T>;
 template <typename T>
 using native_log10 = OclcFunction<Function::native_log10, 1,
-                                  calculate_log10<typename T::host_type>, T>;
+                                  calculate_log10<typename T::host_type>,
+                                  calculate_log10<typename T::host_type, true>,
+                                  T>;
 template <typename T>
 using native_powr = OclcFunction<Function::native_powr, 2,
-                                 calculate_pow<typename T::host_type>, T>;
+                                 calculate_pow<typename T::host_type>,
+                                 calculate_pow<typename T::host_type, true>, T>;
 template <typename T>
 using native_recip = OclcFunction<Function::native_recip, 1,
-                                  calculate_recip<typename T::host_type>, T>;
+                                  calculate_recip<typename T::host_type>,
+                                  calculate_recip<typename T::host_type, true>,
+                                  T>;
 template <typename T>
 using native_rsqrt = OclcFunction<Function::native_rsqrt, 1,
-                                  calculate_rsqrt<typename T::host_type>, T>;
+                                  calculate_rsqrt<typename T::host_type>,
+                                  calculate_rsqrt<typename T::host_type, true>,
+                                  T>;
 template <typename T>
 using native_sin = OclcFunction<Function::native_sin, 1,
-                                calculate_sin<typename T::host_type>, T>;
+                                calculate_sin<typename T::host_type>,
+                                calculate_sin<typename T::host_type, true>, T>;
 template <typename T>
 using native_sqrt = OclcFunction<Function::native_sqrt, 1,
-                                 calculate_sqrt<typename T::host_type>, T>;
+                                 calculate_sqrt<typename T::host_type>,
+                                 calculate_sqrt<typename T::host_type, true>,
+                                 T>;
 template <typename T>
 using native_tan = OclcFunction<Function::native_tan, 1,
-                                calculate_tan<typename T::host_type>, T>;
+                                calculate_tan<typename T::host_type>,
+                                calculate_tan<typename T::host_type, true>, T>;
 template <typename T>
 using half_cos = OclcFunction<Function::half_cos, 1,
-                              calculate_cos<typename T::host_type>, T>;
+                              calculate_cos<typename T::host_type>,
+                              calculate_cos<typename T::host_type, true>, T>;
 template <typename T>
 using half_divide = OclcFunction<Function::half_divide, 2,
-                                 calculate_divide<typename T::host_type>, T>;
+                                 calculate_divide<typename T::host_type>,
+                                 calculate_divide<typename T::host_type, true>,
+                                 T>;
 template <typename T>
 using half_exp = OclcFunction<Function::half_exp, 1,
-                              calculate_exp<typename T::host_type>, T>;
+                              calculate_exp<typename T::host_type>,
+                              calculate_exp<typename T::host_type, true>, T>;
 template <typename T>
 using half_exp2 = OclcFunction<Function::half_exp2, 1,
-                               calculate_exp2<typename T::host_type>, T>;
+                               calculate_exp2<typename T::host_type>,
+                               calculate_exp2<typename T::host_type, true>, T>;
 template <typename T>
 using half_exp10 = OclcFunction<Function::half_exp10, 1,
-                                calculate_exp10<typename T::host_type>, T>;
+                                calculate_exp10<typename T::host_type>,
+                                calculate_exp10<typename T::host_type, true>,
+                                T>;
 template <typename T>
 using half_log = OclcFunction<Function::half_log, 1,
-                              calculate_log<typename T::host_type>, T>;
+                              calculate_log<typename T::host_type>,
+                              calculate_log<typename T::host_type, true>, T>;
 template <typename T>
 using half_log2 = OclcFunction<Function::half_log2, 1,
-                               calculate_log2<typename T::host_type>, T>;
+                               calculate_log2<typename T::host_type>,
+                               calculate_log2<typename T::host_type, true>, T>;
 template <typename T>
 using half_log10 = OclcFunction<Function::half_log10, 1,
-                                calculate_log10<typename T::host_type>, T>;
+                                calculate_log10<typename T::host_type>,
+                                calculate_log10<typename T::host_type, true>,
+                                T>;
 template <typename T>
 using half_powr = OclcFunction<Function::half_powr, 2,
-                               calculate_powr<typename T::host_type>, T>;
+                               calculate_powr<typename T::host_type>,
+                               calculate_powr<typename T::host_type, true>, T>;
 template <typename T>
 using half_recip = OclcFunction<Function::half_recip, 1,
-                                calculate_recip<typename T::host_type>, T>;
+                                calculate_recip<typename T::host_type>,
+                                calculate_recip<typename T::host_type, true>,
+                                T>;
 template <typename T>
 using half_rsqrt = OclcFunction<Function::half_rsqrt, 1,
-                                calculate_rsqrt<typename T::host_type>, T>;
+                                calculate_rsqrt<typename T::host_type>,
+                                calculate_rsqrt<typename T::host_type, true>,
+                                T>;
 template <typename T>
 using half_sin = OclcFunction<Function::half_sin, 1,
-                              calculate_sin<typename T::host_type>, T>;
+                              calculate_sin<typename T::host_type>,
+                              calculate_sin<typename T::host_type, true>, T>;
 template <typename T>
 using half_sqrt = OclcFunction<Function::half_sqrt, 1,
-                               calculate_sqrt<typename T::host_type>, T>;
+                               calculate_sqrt<typename T::host_type>,
+                               calculate_sqrt<typename T::host_type, true>, T>;
 template <typename T>
 using half_tan = OclcFunction<Function::half_tan, 1,
-                              calculate_tan<typename T::host_type>, T>;
+                              calculate_tan<typename T::host_type>,
+                              calculate_tan<typename T::host_type, true>, T>;
 
 using FloatFunctions =
     FunctionProduct<ca::TypesFloat, native_cos, native_divide, native_exp,
@@ -137,7 +177,8 @@ TEMPLATE_LIST_TEST_CASE_CUSTOM_NAME("functions", "", FloatFunctions,
 
 template <typename T>
 using sqrt_cr = OclcFunction<Function::correctly_rounded_sqrt, 1,
-                             calculate_sqrt<typename T::host_type>, T>;
+                             calculate_sqrt<typename T::host_type>,
+                             calculate_sqrt<typename T::host_type, true>, T>;
 
 using CRFunctions = FunctionProduct<ca::TypesFloat, sqrt_cr>::type;
 
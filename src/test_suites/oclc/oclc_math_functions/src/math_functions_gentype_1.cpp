@@ -29,89 +29,116 @@ namespace ca = cassian;
 namespace {
 
 template <typename T>
-using acos =
-    OclcFunction<Function::acos, 1, calculate_acos<typename T::host_type>, T>;
+using acos = OclcFunction<Function::acos, 1,
+                          calculate_acos<typename T::host_type>,
+                          calculate_acos<typename T::host_type, true>, T>;
 template <typename T>
-using acosh =
-    OclcFunction<Function::acosh, 1, calculate_acosh<typename T::host_type>, T>;
+using acosh = OclcFunction<Function::acosh, 1,
+                           calculate_acosh<typename T::host_type>,
+                           calculate_acosh<typename T::host_type, true>, T>;
 
 template <typename T>
 using acospi = OclcFunction<Function::acospi, 1,
-                            calculate_acospi<typename T::host_type>, T>;
+                            calculate_acospi<typename T::host_type>,
+                            calculate_acospi<typename T::host_type, true>, T>;
 template <typename T>
-using asin =
-    OclcFunction<Function::asin, 1, calculate_asin<typename T::host_type>, T>;
+using asin = OclcFunction<Function::asin, 1,
+                          calculate_asin<typename T::host_type>,
+                          calculate_asin<typename T::host_type, true>, T>;
 template <typename T>
-using asinh =
-    OclcFunction<Function::asinh, 1, calculate_asinh<typename T::host_type>, T>;
+using asinh = OclcFunction<Function::asinh, 1,
+                           calculate_asinh<typename T::host_type>,
+                           calculate_asinh<typename T::host_type, true>, T>;
 template <typename T>
 using asinpi = OclcFunction<Function::asinpi, 1,
-                            calculate_asinpi<typename T::host_type>, T>;
+                            calculate_asinpi<typename T::host_type>,
+                            calculate_asinpi<typename T::host_type, true>, T>;
 template <typename T>
-using atan =
-    OclcFunction<Function::atan, 1, calculate_atan<typename T::host_type>, T>;
+using atan = OclcFunction<Function::atan, 1,
+                          calculate_atan<typename T::host_type>,
+                          calculate_atan<typename T::host_type, true>, T>;
 template <typename T>
-using atan2 =
-    OclcFunction<Function::atan2, 2, calculate_atan2<typename T::host_type>, T>;
+using atan2 = OclcFunction<Function::atan2, 2,
+                           calculate_atan2<typename T::host_type>,
+                           calculate_atan2<typename T::host_type, true>, T>;
 template <typename T>
-using atanh =
-    OclcFunction<Function::atanh, 1, calculate_atanh<typename T::host_type>, T>;
+using atanh = OclcFunction<Function::atanh, 1,
+                           calculate_atanh<typename T::host_type>,
+                           calculate_atanh<typename T::host_type, true>, T>;
 template <typename T>
 using atanpi = OclcFunction<Function::atanpi, 1,
-                            calculate_atanpi<typename T::host_type>, T>;
+                            calculate_atanpi<typename T::host_type>,
+                            calculate_atanpi<typename T::host_type, true>, T>;
 template <typename T>
 using atan2pi = OclcFunction<Function::atan2pi, 2,
-                             calculate_atan2pi<typename T::host_type>, T>;
+                             calculate_atan2pi<typename T::host_type>,
+                             calculate_atan2pi<typename T::host_type, true>, T>;
 template <typename T>
-using cbrt =
-    OclcFunction<Function::cbrt, 1, calculate_cbrt<typename T::host_type>, T>;
+using cbrt = OclcFunction<Function::cbrt, 1,
+                          calculate_cbrt<typename T::host_type>,
+                          calculate_cbrt<typename T::host_type, true>, T>;
 namespace internal {
 template <typename T>
-using ceil =
-    OclcFunction<Function::ceil, 1, calculate_ceil<typename T::host_type>, T>;
+using ceil = OclcFunction<Function::ceil, 1,
+                          calculate_ceil<typename T::host_type>,
+                          calculate_ceil<typename T::host_type, true>, T>;
 }
 template <typename T>
 using copysign = OclcFunction<Function::copysign, 2,
-                              calculate_copysign<typename T::host_type>, T>;
+                              calculate_copysign<typename T::host_type>,
+                              calculate_copysign<typename T::host_type, true>,
+                              T>;
 template <typename T>
-using cos =
-    OclcFunction<Function::cos, 1, calculate_cos<typename T::host_type>, T>;
+using cos = OclcFunction<Function::cos, 1, calculate_cos<typename T::host_type>,
+                         calculate_cos<typename T::host_type, true>, T>;
 template <typename T>
-using cosh =
-    OclcFunction<Function::cosh, 1, calculate_cosh<typename T::host_type>, T>;
+using cosh = OclcFunction<Function::cosh, 1,
+                          calculate_cosh<typename T::host_type>,
+                          calculate_cosh<typename T::host_type, true>, T>;
 template <typename T>
-using cospi =
-    OclcFunction<Function::cospi, 1, calculate_cospi<typename T::host_type>, T>;
+using cospi = OclcFunction<Function::cospi, 1,
+                           calculate_cospi<typename T::host_type>,
+                           calculate_cospi<typename T::host_type, true>, T>;
 template <typename T>
-using sqrt =
-    OclcFunction<Function::sqrt, 1, calculate_sqrt<typename T::host_type>, T>;
+using sqrt = OclcFunction<Function::sqrt, 1,
+                          calculate_sqrt<typename T::host_type>,
+                          calculate_sqrt<typename T::host_type, true>, T>;
 template <typename T>
-using mad =
-    OclcFunction<Function::mad, 3, calculate_mad<typename T::host_type>, T>;
+using mad = OclcFunction<Function::mad, 3, calculate_mad<typename T::host_type>,
+                         calculate_mad<typename T::host_type, true>, T>;
 template <typename T>
 using maxmag = OclcFunction<Function::maxmag, 2,
-                            calculate_maxmag<typename T::host_type>, T>;
+                            calculate_maxmag<typename T::host_type>,
+                            calculate_maxmag<typename T::host_type, true>, T>;
 template <typename T>
 using minmag = OclcFunction<Function::minmag, 2,
-                            calculate_minmag<typename T::host_type>, T>;
+                            calculate_minmag<typename T::host_type>,
+                            calculate_minmag<typename T::host_type, true>, T>;
 template <typename T>
 using nextafter = OclcFunction<Function::nextafter, 2,
-                               calculate_nextafter<typename T::host_type>, T>;
+                               calculate_nextafter<typename T::host_type>,
+                               calculate_nextafter<typename T::host_type, true>,
+                               T>;
 template <typename T>
-using pow =
-    OclcFunction<Function::pow, 2, calculate_pow<typename T::host_type>, T>;
+using pow = OclcFunction<Function::pow, 2, calculate_pow<typename T::host_type>,
+                         calculate_pow<typename T::host_type, true>, T>;
 template <typename T>
 using remainder = OclcFunction<Function::remainder, 2,
-                               calculate_remainder<typename T::host_type>, T>;
+                               calculate_remainder<typename T::host_type>,
+                               calculate_remainder<typename T::host_type, true>,
+                               T>;
 template <typename T>
-using rint =
-    OclcFunction<Function::rint, 1, calculate_rint<typename T::host_type>, T>;
+using rint = OclcFunction<Function::rint, 1,
+                          calculate_rint<typename T::host_type>,
+                          calculate_rint<typename T::host_type, true>, T>;
 template <typename T>
-using round =
-    OclcFunction<Function::round, 1, calculate_round<typename T::host_type>, T>;
+using round = OclcFunction<Function::round, 1,
+                           calculate_round<typename T::host_type>,
+                           calculate_round<typename T::host_type, true>, T>;
 template <typename T>
-using rsqrt =
-    OclcFunction<Function::rsqrt, 1, calculate_rsqrt<typename T::host_type>, T>;
+using rsqrt = OclcFunction<Function::rsqrt, 1,
+                           calculate_rsqrt<typename T::host_type>,
+                           calculate_rsqrt<typename T::host_type, true>, T>;
 
 using Gentype =
     ca::TupleConcat<ca::TypesFloat, ca::TypesDouble, ca::TypesHalf>::type;
@@ -29,74 +29,92 @@ namespace ca = cassian;
 namespace {
 
 template <typename T>
-using sin =
-    OclcFunction<Function::sin, 1, calculate_sin<typename T::host_type>, T>;
+using sin = OclcFunction<Function::sin, 1, calculate_sin<typename T::host_type>,
+                         calculate_sin<typename T::host_type, true>, T>;
 template <typename T>
-using sinh =
-    OclcFunction<Function::sinh, 1, calculate_sinh<typename T::host_type>, T>;
+using sinh = OclcFunction<Function::sinh, 1,
+                          calculate_sinh<typename T::host_type>,
+                          calculate_sinh<typename T::host_type, true>, T>;
 template <typename T>
-using sinpi =
-    OclcFunction<Function::sinpi, 1, calculate_sinpi<typename T::host_type>, T>;
+using sinpi = OclcFunction<Function::sinpi, 1,
+                           calculate_sinpi<typename T::host_type>,
+                           calculate_sinpi<typename T::host_type, true>, T>;
 template <typename T>
-using tan =
-    OclcFunction<Function::tan, 1, calculate_tan<typename T::host_type>, T>;
+using tan = OclcFunction<Function::tan, 1, calculate_tan<typename T::host_type>,
+                         calculate_tan<typename T::host_type, true>, T>;
 template <typename T>
-using tanh =
-    OclcFunction<Function::tanh, 1, calculate_tanh<typename T::host_type>, T>;
+using tanh = OclcFunction<Function::tanh, 1,
+                          calculate_tanh<typename T::host_type>,
+                          calculate_tanh<typename T::host_type, true>, T>;
 template <typename T>
-using tanpi =
-    OclcFunction<Function::tanpi, 1, calculate_tanpi<typename T::host_type>, T>;
+using tanpi = OclcFunction<Function::tanpi, 1,
+                           calculate_tanpi<typename T::host_type>,
+                           calculate_tanpi<typename T::host_type, true>, T>;
 template <typename T>
 using tgamma = OclcFunction<Function::tgamma, 1,
-                            calculate_tgamma<typename T::host_type>, T>;
+                            calculate_tgamma<typename T::host_type>,
+                            calculate_tgamma<typename T::host_type, true>, T>;
 template <typename T>
-using trunc =
-    OclcFunction<Function::trunc, 1, calculate_trunc<typename T::host_type>, T>;
+using trunc = OclcFunction<Function::trunc, 1,
+                           calculate_trunc<typename T::host_type>,
+                           calculate_trunc<typename T::host_type, true>, T>;
 template <typename T>
-using erfc =
-    OclcFunction<Function::erfc, 1, calculate_erfc<typename T::host_type>, T>;
+using erfc = OclcFunction<Function::erfc, 1,
+                          calculate_erfc<typename T::host_type>,
+                          calculate_erfc<typename T::host_type, true>, T>;
 template <typename T>
-using erf =
-    OclcFunction<Function::erf, 1, calculate_erf<typename T::host_type>, T>;
+using erf = OclcFunction<Function::erf, 1, calculate_erf<typename T::host_type>,
+                         calculate_erf<typename T::host_type, true>, T>;
 template <typename T>
-using exp =
-    OclcFunction<Function::exp, 1, calculate_exp<typename T::host_type>, T>;
+using exp = OclcFunction<Function::exp, 1, calculate_exp<typename T::host_type>,
+                         calculate_exp<typename T::host_type, true>, T>;
 template <typename T>
-using exp2 =
-    OclcFunction<Function::exp2, 1, calculate_exp2<typename T::host_type>, T>;
+using exp2 = OclcFunction<Function::exp2, 1,
+                          calculate_exp2<typename T::host_type>,
+                          calculate_exp2<typename T::host_type, true>, T>;
 template <typename T>
-using exp10 =
-    OclcFunction<Function::exp10, 1, calculate_exp10<typename T::host_type>, T>;
+using exp10 = OclcFunction<Function::exp10, 1,
+                           calculate_exp10<typename T::host_type>,
+                           calculate_exp10<typename T::host_type, true>, T>;
 template <typename T>
-using expm1 =
-    OclcFunction<Function::expm1, 1, calculate_expm1<typename T::host_type>, T>;
+using expm1 = OclcFunction<Function::expm1, 1,
+                           calculate_expm1<typename T::host_type>,
+                           calculate_expm1<typename T::host_type, true>, T>;
 template <typename T>
-using fabs =
-    OclcFunction<Function::fabs, 1, calculate_fabs<typename T::host_type>, T>;
+using fabs = OclcFunction<Function::fabs, 1,
+                          calculate_fabs<typename T::host_type>,
+                          calculate_fabs<typename T::host_type, true>, T>;
 template <typename T>
-using fdim =
-    OclcFunction<Function::fdim, 2, calculate_fdim<typename T::host_type>, T>;
+using fdim = OclcFunction<Function::fdim, 2,
+                          calculate_fdim<typename T::host_type>,
+                          calculate_fdim<typename T::host_type, true>, T>;
 template <typename T>
-using floor =
-    OclcFunction<Function::floor, 1, calculate_floor<typename T::host_type>, T>;
+using floor = OclcFunction<Function::floor, 1,
+                           calculate_floor<typename T::host_type>,
+                           calculate_floor<typename T::host_type, true>, T>;
 template <typename T>
-using fma =
-    OclcFunction<Function::fma, 3, calculate_fma<typename T::host_type>, T>;
+using fma = OclcFunction<Function::fma, 3, calculate_fma<typename T::host_type>,
+                         calculate_fma<typename T::host_type, true>, T>;
 template <typename T>
-using fmax =
-    OclcFunction<Function::fmax, 2, calculate_fmax<typename T::host_type>, T>;
+using fmax = OclcFunction<
+    Function::fmax, 2, calculate_fmax<typename T::host_type>,
+    calculate_fmax<typename T::host_type, typename T::host_type, true>, T>;
 template <typename T>
-using fmin =
-    OclcFunction<Function::fmin, 2, calculate_fmin<typename T::host_type>, T>;
+using fmin = OclcFunction<
+    Function::fmin, 2, calculate_fmin<typename T::host_type>,
+    calculate_fmin<typename T::host_type, typename T::host_type, true>, T>;
 template <typename T>
-using fmod =
-    OclcFunction<Function::fmod, 2, calculate_fmod<typename T::host_type>, T>;
+using fmod = OclcFunction<Function::fmod, 2,
+                          calculate_fmod<typename T::host_type>,
+                          calculate_fmod<typename T::host_type, true>, T>;
 template <typename T>
-using hypot =
-    OclcFunction<Function::hypot, 2, calculate_hypot<typename T::host_type>, T>;
+using hypot = OclcFunction<Function::hypot, 2,
+                           calculate_hypot<typename T::host_type>,
+                           calculate_hypot<typename T::host_type, true>, T>;
 template <typename T>
 using lgamma = OclcFunction<Function::lgamma, 1,
-                            calculate_lgamma<typename T::host_type>, T>;
+                            calculate_lgamma<typename T::host_type>,
+                            calculate_lgamma<typename T::host_type, true>, T>;
 
 using Gentype =
     ca::TupleConcat<ca::TypesFloat, ca::TypesDouble, ca::TypesHalf>::type;
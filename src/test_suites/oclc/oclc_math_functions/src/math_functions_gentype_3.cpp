@@ -29,47 +29,56 @@ namespace ca = cassian;
 namespace {
 
 template <typename T>
-using log =
-    OclcFunction<Function::log, 1, calculate_log<typename T::host_type>, T>;
+using log = OclcFunction<Function::log, 1, calculate_log<typename T::host_type>,
+                         calculate_log<typename T::host_type, true>, T>;
 template <typename T>
-using log2 =
-    OclcFunction<Function::log2, 1, calculate_log2<typename T::host_type>, T>;
+using log2 = OclcFunction<Function::log2, 1,
+                          calculate_log2<typename T::host_type>,
+                          calculate_log2<typename T::host_type, true>, T>;
 template <typename T>
-using log10 =
-    OclcFunction<Function::log10, 1, calculate_log10<typename T::host_type>, T>;
+using log10 = OclcFunction<Function::log10, 1,
+                           calculate_log10<typename T::host_type>,
+                           calculate_log10<typename T::host_type, true>, T>;
 template <typename T>
-using log1p =
-    OclcFunction<Function::log1p, 1, calculate_log1p<typename T::host_type>, T>;
+using log1p = OclcFunction<Function::log1p, 1,
+                           calculate_log1p<typename T::host_type>,
+                           calculate_log1p<typename T::host_type, true>, T>;
 template <typename T>
-using logb =
-    OclcFunction<Function::logb, 1, calculate_logb<typename T::host_type>, T>;
+using logb = OclcFunction<Function::logb, 1,
+                          calculate_logb<typename T::host_type>,
+                          calculate_logb<typename T::host_type, true>, T>;
 template <typename T>
-using powr =
-    OclcFunction<Function::powr, 2, calculate_powr<typename T::host_type>, T>;
+using powr = OclcFunction<Function::powr, 2,
+                          calculate_powr<typename T::host_type>,
+                          calculate_powr<typename T::host_type, true>, T>;
 template <typename T,
           typename INT = typename cassian::detail::OpenCLCInt<T::vector_size>>
 using ldexp = OclcFunction<
     Function::ldexp, 2,
-    calculate_ldexp<typename T::host_type, typename INT::host_type>, T,
+    calculate_ldexp<typename T::host_type, typename INT::host_type>,
+    calculate_ldexp<typename T::host_type, typename INT::host_type, true>, T,
     AddressSpace::clc_global, T, INT>;
 template <typename T,
           typename UNSIGNED = typename T::logical_type::unsigned_type>
 using nan = OclcFunction<
     Function::nan, 1,
-    calculate_nan<typename T::host_type, typename UNSIGNED::host_type>, T,
+    calculate_nan<typename T::host_type, typename UNSIGNED::host_type>,
+    calculate_nan<typename T::host_type, typename UNSIGNED::host_type, true>, T,
     AddressSpace::clc_global, UNSIGNED>;
 template <typename T,
           typename INT = typename cassian::detail::OpenCLCInt<T::vector_size>>
 using rootn = OclcFunction<
     Function::rootn, 2,
-    calculate_rootn<typename T::host_type, typename INT::host_type>, T,
+    calculate_rootn<typename T::host_type, typename INT::host_type>,
+    calculate_rootn<typename T::host_type, typename INT::host_type, true>, T,
     AddressSpace::clc_global, T, INT>;
 template <typename T,
           typename INT = typename cassian::detail::OpenCLCInt<T::vector_size>>
-using pown =
-    OclcFunction<Function::pown, 2,
-                 calculate_pown<typename T::host_type, typename INT::host_type>,
-                 T, AddressSpace::clc_global, T, INT>;
+using pown = OclcFunction<
+    Function::pown, 2,
+    calculate_pown<typename T::host_type, typename INT::host_type>,
+    calculate_pown<typename T::host_type, typename INT::host_type, true>, T,
+    AddressSpace::clc_global, T, INT>;
 
 using Gentype =
     ca::TupleConcat<ca::TypesFloat, ca::TypesDouble, ca::TypesHalf>::type;
@@ -94,7 +103,8 @@ template <typename T,
           typename INT = typename cassian::detail::OpenCLCInt<T::vector_size>>
 using ilogb = OclcFunction<
     Function::ilogb, 1,
-    calculate_ilogb<typename INT::host_type, typename T::host_type>, INT,
+    calculate_ilogb<typename INT::host_type, typename T::host_type>,
+    calculate_ilogb<typename INT::host_type, typename T::host_type, true>, INT,
     AddressSpace::clc_global, T>;
 
 template <typename TestType> auto test_name_ilogb() {
@@ -29,117 +29,145 @@ namespace ca = cassian;
 namespace {
 
 template <typename T>
-using acos =
-    OclcFunction<Function::acos, 1, calculate_acos<typename T::host_type>, T>;
+using acos = OclcFunction<Function::acos, 1,
+                          calculate_acos<typename T::host_type>,
+                          calculate_acos<typename T::host_type, true>, T>;
 template <typename T>
-using acosh =
-    OclcFunction<Function::acosh, 1, calculate_acosh<typename T::host_type>, T>;
+using acosh = OclcFunction<Function::acosh, 1,
+                           calculate_acosh<typename T::host_type>,
+                           calculate_acosh<typename T::host_type, true>, T>;
 
 template <typename T>
 using acospi = OclcFunction<Function::acospi, 1,
-                            calculate_acospi<typename T::host_type>, T>;
+                            calculate_acospi<typename T::host_type>,
+                            calculate_acospi<typename T::host_type, true>, T>;
 template <typename T>
-using asin =
-    OclcFunction<Function::asin, 1, calculate_asin<typename T::host_type>, T>;
+using asin = OclcFunction<Function::asin, 1,
+                          calculate_asin<typename T::host_type>,
+                          calculate_asin<typename T::host_type, true>, T>;
 template <typename T>
-using asinh =
-    OclcFunction<Function::asinh, 1, calculate_asinh<typename T::host_type>, T,
-                 AddressSpace::clc_global, T, T, T,
-                 calculate_asinh_derived_check<typename T::host_type>>;
+using asinh = OclcFunction<
+    Function::asinh, 1, calculate_asinh<typename T::host_type>,
+    calculate_asinh<typename T::host_type, true>, T, AddressSpace::clc_global,
+    T, T, T, calculate_asinh_derived_check<typename T::host_type>>;
 template <typename T>
 using asinpi = OclcFunction<Function::asinpi, 1,
-                            calculate_asinpi<typename T::host_type>, T>;
+                            calculate_asinpi<typename T::host_type>,
+                            calculate_asinpi<typename T::host_type, true>, T>;
 template <typename T>
-using atan =
-    OclcFunction<Function::atan, 1, calculate_atan<typename T::host_type>, T>;
+using atan = OclcFunction<Function::atan, 1,
+                          calculate_atan<typename T::host_type>,
+                          calculate_atan<typename T::host_type, true>, T>;
 template <typename T>
-using atan2 =
-    OclcFunction<Function::atan2, 2, calculate_atan2<typename T::host_type>, T>;
+using atan2 = OclcFunction<Function::atan2, 2,
+                           calculate_atan2<typename T::host_type>,
+                           calculate_atan2<typename T::host_type, true>, T>;
 template <typename T>
-using atanh =
-    OclcFunction<Function::atanh, 1, calculate_atanh<typename T::host_type>, T>;
+using atanh = OclcFunction<Function::atanh, 1,
+                           calculate_atanh<typename T::host_type>,
+                           calculate_atanh<typename T::host_type, true>, T>;
 template <typename T>
 using atanpi = OclcFunction<Function::atanpi, 1,
-                            calculate_atanpi<typename T::host_type>, T>;
+                            calculate_atanpi<typename T::host_type>,
+                            calculate_atanpi<typename T::host_type, true>, T>;
 template <typename T>
 using atan2pi = OclcFunction<Function::atan2pi, 2,
-                             calculate_atan2pi<typename T::host_type>, T>;
+                             calculate_atan2pi<typename T::host_type>,
+                             calculate_atan2pi<typename T::host_type, true>, T>;
 template <typename T>
-using cbrt =
-    OclcFunction<Function::cbrt, 1, calculate_cbrt<typename T::host_type>, T>;
+using cbrt = OclcFunction<Function::cbrt, 1,
+                          calculate_cbrt<typename T::host_type>,
+                          calculate_cbrt<typename T::host_type, true>, T>;
 
 template <typename T>
-using cos =
-    OclcFunction<Function::cos, 1, calculate_cos<typename T::host_type>, T>;
+using cos = OclcFunction<Function::cos, 1, calculate_cos<typename T::host_type>,
+                         calculate_cos<typename T::host_type, true>, T>;
 template <typename T>
-using cosh =
-    OclcFunction<Function::cosh, 1, calculate_cosh<typename T::host_type>, T>;
+using cosh = OclcFunction<Function::cosh, 1,
+                          calculate_cosh<typename T::host_type>,
+                          calculate_cosh<typename T::host_type, true>, T>;
 template <typename T>
-using cospi =
-    OclcFunction<Function::cospi, 1, calculate_cospi<typename T::host_type>, T>;
+using cospi = OclcFunction<Function::cospi, 1,
+                           calculate_cospi<typename T::host_type>,
+                           calculate_cospi<typename T::host_type, true>, T>;
 template <typename T>
-using pow =
-    OclcFunction<Function::pow, 2, calculate_pow<typename T::host_type>, T>;
+using pow = OclcFunction<Function::pow, 2, calculate_pow<typename T::host_type>,
+                         calculate_pow<typename T::host_type, true>, T>;
 template <typename T>
-using sin =
-    OclcFunction<Function::sin, 1, calculate_sin<typename T::host_type>, T>;
+using sin = OclcFunction<Function::sin, 1, calculate_sin<typename T::host_type>,
+                         calculate_sin<typename T::host_type, true>, T>;
 template <typename T>
-using sinh =
-    OclcFunction<Function::sinh, 1, calculate_sinh<typename T::host_type>, T>;
+using sinh = OclcFunction<Function::sinh, 1,
+                          calculate_sinh<typename T::host_type>,
+                          calculate_sinh<typename T::host_type, true>, T>;
 template <typename T>
-using sinpi =
-    OclcFunction<Function::sinpi, 1, calculate_sinpi<typename T::host_type>, T>;
+using sinpi = OclcFunction<Function::sinpi, 1,
+                           calculate_sinpi<typename T::host_type>,
+                           calculate_sinpi<typename T::host_type, true>, T>;
 template <typename T>
-using tan =
-    OclcFunction<Function::tan, 1, calculate_tan<typename T::host_type>, T>;
+using tan = OclcFunction<Function::tan, 1, calculate_tan<typename T::host_type>,
+                         calculate_tan<typename T::host_type, true>, T>;
 template <typename T>
-using tanh =
-    OclcFunction<Function::tanh, 1, calculate_tanh<typename T::host_type>, T>;
+using tanh = OclcFunction<Function::tanh, 1,
+                          calculate_tanh<typename T::host_type>,
+                          calculate_tanh<typename T::host_type, true>, T>;
 template <typename T>
-using tanpi =
-    OclcFunction<Function::tanpi, 1, calculate_tanpi<typename T::host_type>, T>;
+using tanpi = OclcFunction<Function::tanpi, 1,
+                           calculate_tanpi<typename T::host_type>,
+                           calculate_tanpi<typename T::host_type, true>, T>;
 template <typename T>
-using exp =
-    OclcFunction<Function::exp, 1, calculate_exp<typename T::host_type>, T>;
+using exp = OclcFunction<Function::exp, 1, calculate_exp<typename T::host_type>,
+                         calculate_exp<typename T::host_type, true>, T>;
 template <typename T>
-using exp2 =
-    OclcFunction<Function::exp2, 1, calculate_exp2<typename T::host_type>, T>;
+using exp2 = OclcFunction<Function::exp2, 1,
+                          calculate_exp2<typename T::host_type>,
+                          calculate_exp2<typename T::host_type, true>, T>;
 template <typename T>
-using exp10 =
-    OclcFunction<Function::exp10, 1, calculate_exp10<typename T::host_type>, T>;
+using exp10 = OclcFunction<Function::exp10, 1,
+                           calculate_exp10<typename T::host_type>,
+                           calculate_exp10<typename T::host_type, true>, T>;
 template <typename T>
-using expm1 =
-    OclcFunction<Function::expm1, 1, calculate_expm1<typename T::host_type>, T>;
+using expm1 = OclcFunction<Function::expm1, 1,
+                           calculate_expm1<typename T::host_type>,
+                           calculate_expm1<typename T::host_type, true>, T>;
 template <typename T>
-using log =
-    OclcFunction<Function::log, 1, calculate_log<typename T::host_type>, T>;
+using log = OclcFunction<Function::log, 1, calculate_log<typename T::host_type>,
+                         calculate_log<typename T::host_type, true>, T>;
 template <typename T>
-using log2 =
-    OclcFunction<Function::log2, 1, calculate_log2<typename T::host_type>, T>;
+using log2 = OclcFunction<Function::log2, 1,
+                          calculate_log2<typename T::host_type>,
+                          calculate_log2<typename T::host_type, true>, T>;
 template <typename T>
-using log10 =
-    OclcFunction<Function::log10, 1, calculate_log10<typename T::host_type>, T>;
+using log10 = OclcFunction<Function::log10, 1,
+                           calculate_log10<typename T::host_type>,
+                           calculate_log10<typename T::host_type, true>, T>;
 template <typename T>
-using log1p =
-    OclcFunction<Function::log1p, 1, calculate_log1p<typename T::host_type>, T>;
+using log1p = OclcFunction<Function::log1p, 1,
+                           calculate_log1p<typename T::host_type>,
+                           calculate_log1p<typename T::host_type, true>, T>;
 template <typename T>
-using powr =
-    OclcFunction<Function::powr, 2, calculate_powr<typename T::host_type>, T>;
+using powr = OclcFunction<Function::powr, 2,
+                          calculate_powr<typename T::host_type>,
+                          calculate_powr<typename T::host_type, true>, T>;
 template <typename T,
           typename INT = typename cassian::detail::OpenCLCInt<T::vector_size>>
 using rootn = OclcFunction<
     Function::rootn, 2,
-    calculate_rootn<typename T::host_type, typename INT::host_type>, T,
+    calculate_rootn<typename T::host_type, typename INT::host_type>,
+    calculate_rootn<typename T::host_type, typename INT::host_type, true>, T,
     AddressSpace::clc_global, T, INT>;
 template <typename T,
           typename INT = typename cassian::detail::OpenCLCInt<T::vector_size>>
-using pown =
-    OclcFunction<Function::pown, 2,
-                 calculate_pown<typename T::host_type, typename INT::host_type>,
-                 T, AddressSpace::clc_global, T, INT>;
+using pown = OclcFunction<
+    Function::pown, 2,
+    calculate_pown<typename T::host_type, typename INT::host_type>,
+    calculate_pown<typename T::host_type, typename INT::host_type, true>, T,
+    AddressSpace::clc_global, T, INT>;
 template <typename T, AddressSpace AS>
 using sincos = OclcFunction<Function::sincos, 2,
-                            calculate_sincos<typename T::host_type>, T, AS>;
+                            calculate_sincos<typename T::host_type>,
+                            calculate_sincos<typename T::host_type, true>, T,
+                            AS>;
 
 using Gentype = ca::TupleConcat<ca::TypesFloat>::type;
 
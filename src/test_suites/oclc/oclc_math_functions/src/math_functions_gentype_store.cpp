@@ -30,31 +30,38 @@ namespace {
 
 template <typename T, AddressSpace AS>
 using fract = OclcFunction<Function::fract, 2,
-                           calculate_fract<typename T::host_type>, T, AS>;
+                           calculate_fract<typename T::host_type>,
+                           calculate_fract<typename T::host_type, true>, T, AS>;
 template <typename T, AddressSpace AS>
 using sincos = OclcFunction<Function::sincos, 2,
-                            calculate_sincos<typename T::host_type>, T, AS>;
+                            calculate_sincos<typename T::host_type>,
+                            calculate_sincos<typename T::host_type, true>, T,
+                            AS>;
 template <typename T, AddressSpace AS>
 using modf = OclcFunction<Function::modf, 2,
-                          calculate_modf<typename T::host_type>, T, AS>;
+                          calculate_modf<typename T::host_type>,
+                          calculate_modf<typename T::host_type, true>, T, AS>;
 template <typename T, AddressSpace AS,
           typename INT = typename cassian::detail::OpenCLCInt<T::vector_size>>
 using frexp = OclcFunction<
     Function::frexp, 2,
-    calculate_frexp<typename T::host_type, typename INT::host_type>, T, AS, T,
-    INT>;
+    calculate_frexp<typename T::host_type, typename INT::host_type>,
+    calculate_frexp<typename T::host_type, typename INT::host_type, true>, T,
+    AS, T, INT>;
 template <typename T, AddressSpace AS,
           typename INT = typename cassian::detail::OpenCLCInt<T::vector_size>>
 using remquo = OclcFunction<
     Function::remquo, 3,
-    calculate_remquo<typename T::host_type, typename INT::host_type>, T, AS, T,
-    T, INT>;
+    calculate_remquo<typename T::host_type, typename INT::host_type>,
+    calculate_remquo<typename T::host_type, typename INT::host_type, true>, T,
+    AS, T, T, INT>;
 template <typename T, AddressSpace AS,
           typename INT = typename cassian::detail::OpenCLCInt<T::vector_size>>
 using lgamma_r = OclcFunction<
     Function::lgamma_r, 2,
-    calculate_lgamma_r<typename T::host_type, typename INT::host_type>, T, AS,
-    T, INT>;
+    calculate_lgamma_r<typename T::host_type, typename INT::host_type>,
+    calculate_lgamma_r<typename T::host_type, typename INT::host_type, true>, T,
+    AS, T, INT>;
 
 template <template <typename T, AddressSpace AS, typename...>
           typename FunctionAlias,
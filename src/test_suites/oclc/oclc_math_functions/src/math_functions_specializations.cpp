@@ -31,17 +31,20 @@ namespace {
 template <typename T, typename SCALAR = typename T::scalar_type>
 using fmax = OclcFunction<
     Function::fmax, 2,
-    calculate_fmax<typename T::host_type, typename SCALAR::host_type>, T,
+    calculate_fmax<typename T::host_type, typename SCALAR::host_type>,
+    calculate_fmax<typename T::host_type, typename SCALAR::host_type, true>, T,
     AddressSpace::clc_global, T, SCALAR>;
 template <typename T, typename SCALAR = typename T::scalar_type>
 using fmin = OclcFunction<
     Function::fmin, 2,
-    calculate_fmin<typename T::host_type, typename SCALAR::host_type>, T,
+    calculate_fmin<typename T::host_type, typename SCALAR::host_type>,
+    calculate_fmin<typename T::host_type, typename SCALAR::host_type, true>, T,
     AddressSpace::clc_global, T, SCALAR>;
 template <typename T, typename INT = typename cassian::clc_int_t>
 using ldexp = OclcFunction<
     Function::ldexp, 2,
-    calculate_ldexp<typename T::host_type, typename INT::host_type>, T,
+    calculate_ldexp<typename T::host_type, typename INT::host_type>,
+    calculate_ldexp<typename T::host_type, typename INT::host_type, true>, T,
     AddressSpace::clc_global, T, INT>;
 
 using Gentype = ca::TupleConcat<ca::TypesFloat, ca::TypesDouble>::type;
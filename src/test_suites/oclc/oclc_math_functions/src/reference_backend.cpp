@@ -0,0 +1,295 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cassian/runtime/runtime.hpp>
+#include <cmath>
+#include <limits>
+#include <reference_backend.hpp>
+#include <string>
+
+#ifdef USE_MPFR
+#include <mpfr.h>
+#endif
+
+namespace ca = cassian;
+
+namespace {
+
+// Double-double value, unevaluated sum of hi and lo.
+struct DoubleDouble {
+  double hi;
+  double lo;
+};
+
+DoubleDouble quick_two_sum(double lhs, double rhs) {
+  const double sum = lhs + rhs;
+  const double error = rhs - (sum - lhs);
+  return {sum, error};
+}
+
+DoubleDouble two_sum(double lhs, double rhs) {
+  const double sum = lhs + rhs;
+  const double b_virtual = sum - lhs;
+  const double error = (lhs - (sum - b_virtual)) + (rhs - b_virtual);
+  return {sum, error};
+}
+
+DoubleDouble two_prod(double lhs, double rhs) {
+  const double product = lhs * rhs;
+  const double error = std::fma(lhs, rhs, -product);
+  return {product, error};
+}
+
+DoubleDouble add(DoubleDouble lhs, DoubleDouble rhs) {
+  const auto sum = two_sum(lhs.hi, rhs.hi);
+  const double temp = lhs.lo + rhs.lo + sum.lo;
+  return quick_two_sum(sum.hi, temp);
+}
+
+DoubleDouble multiply(DoubleDouble lhs, DoubleDouble rhs) {
+  const auto product = two_prod(lhs.hi, rhs.hi);
+  const double temp = lhs.hi * rhs.lo + lhs.lo * rhs.hi + product.lo;
+  return quick_two_sum(product.hi, temp);
+}
+
+DoubleDouble divide(DoubleDouble lhs, DoubleDouble rhs) {
+  const double quotient = lhs.hi / rhs.hi;
+  const auto product = multiply({quotient, 0.0}, rhs);
+  const double remainder = ((lhs.hi - product.hi) - product.lo) + lhs.lo;
+  return quick_two_sum(quotient, remainder / rhs.hi);
+}
+
+ReferenceBackend float_reference_backend = ReferenceBackend::double_precision;
+ReferenceBackend double_reference_backend = ReferenceBackend::double_precision;
+
+#ifdef USE_MPFR
+constexpr mpfr_prec_t mpfr_precision = 128;
+
+class MpfrValue {
+public:
+  MpfrValue() { mpfr_init2(value_, mpfr_precision); }
+  MpfrValue(const MpfrValue &) = delete;
+  MpfrValue(MpfrValue &&) = delete;
+  ~MpfrValue() { mpfr_clear(value_); }
+  MpfrValue &operator=(const MpfrValue &) = delete;
+  MpfrValue &operator=(MpfrValue &&) = delete;
+
+  mpfr_ptr get() { return value_; }
+
+private:
+  mpfr_t value_;
+};
+
+void run_mpfr_function(ReferenceFunction function, mpfr_ptr result,
+                       mpfr_ptr a, mpfr_ptr b) {
+  switch (function) {
+  case ReferenceFunction::acos:
+    mpfr_acos(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::acosh:
+    mpfr_acosh(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::asin:
+    mpfr_asin(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::asinh:
+    mpfr_asinh(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::atan:
+    mpfr_atan(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::atan2:
+    mpfr_atan2(result, a, b, MPFR_RNDN);
+    break;
+  case ReferenceFunction::atanh:
+    mpfr_atanh(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::cbrt:
+    mpfr_cbrt(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::cos:
+    mpfr_cos(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::cosh:
+    mpfr_cosh(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::erf:
+    mpfr_erf(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::erfc:
+    mpfr_erfc(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::exp:
+    mpfr_exp(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::exp2:
+    mpfr_exp2(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::expm1:
+    mpfr_expm1(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::hypot:
+    mpfr_hypot(result, a, b, MPFR_RNDN);
+    break;
+  case ReferenceFunction::lgamma: {
+    int sign = 0;
+    mpfr_lgamma(result, &sign, a, MPFR_RNDN);
+    break;
+  }
+  case ReferenceFunction::log:
+    mpfr_log(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::log10:
+    mpfr_log10(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::log1p:
+    mpfr_log1p(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::log2:
+    mpfr_log2(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::pow:
+    mpfr_pow(result, a, b, MPFR_RNDN);
+    break;
+  case ReferenceFunction::sin:
+    mpfr_sin(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::sinh:
+    mpfr_sinh(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::sqrt:
+    mpfr_sqrt(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::tan:
+    mpfr_tan(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::tanh:
+    mpfr_tanh(result, a, MPFR_RNDN);
+    break;
+  case ReferenceFunction::tgamma:
+    mpfr_gamma(result, a, MPFR_RNDN);
+    break;
+  }
+}
+#endif
+
+} // namespace
+
+ReferenceBackend to_reference_backend(const std::string &name) {
+  if (name == "double") {
+    return ReferenceBackend::double_precision;
+  }
+  if (name == "long_double") {
+    if (std::numeric_limits<long double>::digits <=
+        std::numeric_limits<double>::digits) {
+      throw ca::RuntimeException(
+          "long double is not wider than double on this platform");
+    }
+    return ReferenceBackend::long_double;
+  }
+  if (name == "mpfr") {
+#ifdef USE_MPFR
+    return ReferenceBackend::mpfr;
+#else
+    throw ca::RuntimeException("MPFR reference backend is not available, "
+                               "rebuild with -DUSE_MPFR=ON");
+#endif
+  }
+  throw ca::RuntimeException("Unknown reference backend: " + name);
+}
+
+std::string to_string(ReferenceBackend backend) {
+  switch (backend) {
+  case ReferenceBackend::long_double:
+    return "long_double";
+  case ReferenceBackend::mpfr:
+    return "mpfr";
+  default:
+    return "double";
+  }
+}
+
+void set_reference_backends(ReferenceBackend float_backend,
+                            ReferenceBackend double_backend) {
+  float_reference_backend = float_backend;
+  double_reference_backend = double_backend;
+}
+
+bool use_wide_double_references() {
+  return float_reference_backend != ReferenceBackend::double_precision ||
+         double_reference_backend != ReferenceBackend::double_precision;
+}
+
+template <> ReferenceBackend get_reference_backend<double>() {
+  return float_reference_backend;
+}
+
+template <> ReferenceBackend get_reference_backend<long double>() {
+  return double_reference_backend;
+}
+
+double cbrt_high_precision(double value) {
+  // Preserve sign of zero, propagate NaN and infinity.
+  if (value == 0.0 || std::isnan(value) || std::isinf(value)) {
+    return value;
+  }
+  const bool is_negative = value < 0.0;
+
+  // |value| = mantissa * 2^(3 * quotient), so
+  // cbrt(|value|) = cbrt(mantissa) * 2^quotient.
+  int exponent = 0;
+  double mantissa = std::frexp(std::fabs(value), &exponent);
+  const int quotient = exponent / 3;
+  mantissa = std::ldexp(mantissa, exponent - 3 * quotient);
+
+  // Newton iterations y = (2 * y + a / y^2) / 3 in double-double arithmetic,
+  // starting from the double approximation.
+  const DoubleDouble a = {mantissa, 0.0};
+  const DoubleDouble one_third = {1.0 / 3.0, 0.0};
+  DoubleDouble y = {std::cbrt(mantissa), 0.0};
+  for (int i = 0; i < 3; ++i) {
+    const auto ratio = divide(a, multiply(y, y));
+    y = multiply(add(add(y, y), ratio), one_third);
+  }
+
+  const auto result = quick_two_sum(std::ldexp(y.hi, quotient),
+                                    std::ldexp(y.lo, quotient));
+  return is_negative ? -(result.hi + result.lo) : result.hi + result.lo;
+}
+
+#ifdef USE_MPFR
+double evaluate_mpfr(ReferenceFunction function, double a, double b) {
+  MpfrValue result;
+  MpfrValue mpfr_a;
+  MpfrValue mpfr_b;
+  mpfr_set_d(mpfr_a.get(), a, MPFR_RNDN);
+  mpfr_set_d(mpfr_b.get(), b, MPFR_RNDN);
+  run_mpfr_function(function, result.get(), mpfr_a.get(), mpfr_b.get());
+  return mpfr_get_d(result.get(), MPFR_RNDN);
+}
+
+long double evaluate_mpfr(ReferenceFunction function, long double a,
+                          long double b) {
+  MpfrValue result;
+  MpfrValue mpfr_a;
+  MpfrValue mpfr_b;
+  mpfr_set_ld(mpfr_a.get(), a, MPFR_RNDN);
+  mpfr_set_ld(mpfr_b.get(), b, MPFR_RNDN);
+  run_mpfr_function(function, result.get(), mpfr_a.get(), mpfr_b.get());
+  return mpfr_get_ld(result.get(), MPFR_RNDN);
+}
+#else
+double evaluate_mpfr(ReferenceFunction /*function*/, double /*a*/,
+                     double /*b*/) {
+  throw ca::RuntimeException("MPFR reference backend is not available");
+}
+
+long double evaluate_mpfr(ReferenceFunction /*function*/, long double /*a*/,
+                          long double /*b*/) {
+  throw ca::RuntimeException("MPFR reference backend is not available");
+}
+#endif
@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_OCLC_MATH_FUNCTIONS_REFERENCE_BACKEND_HPP
+#define CASSIAN_OCLC_MATH_FUNCTIONS_REFERENCE_BACKEND_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+/**
+ * Implementation used to evaluate elementary functions for host references.
+ */
+enum class ReferenceBackend : uint32_t {
+  /**
+   * Evaluate in double precision using the C++ standard library.
+   */
+  double_precision,
+  /**
+   * Evaluate in long double precision using the C++ standard library.
+   */
+  long_double,
+  /**
+   * Evaluate with 128 bits of precision using MPFR, when available.
+   */
+  mpfr
+};
+
+/**
+ * Parse reference backend name.
+ *
+ * @param[in] name one of "double", "long_double" or "mpfr".
+ * @returns reference backend.
+ * @throws cassian::RuntimeException Thrown if backend is unknown or not
+ * available in this build.
+ */
+ReferenceBackend to_reference_backend(const std::string &name);
+
+/**
+ * Convert reference backend to string.
+ *
+ * @param[in] backend reference backend.
+ * @returns backend name.
+ */
+std::string to_string(ReferenceBackend backend);
+
+/**
+ * Set backends used for references of half and float functions, which are
+ * computed in double, and of double functions, which are computed in long
+ * double. Elementary functions of double references are always evaluated with
+ * `double_backend`, see use_wide_double_references.
+ *
+ * @param[in] float_backend backend for half and float references.
+ * @param[in] double_backend backend for double references.
+ */
+void set_reference_backends(ReferenceBackend float_backend,
+                            ReferenceBackend double_backend);
+
+/**
+ * Check if references of double functions have to be computed in long double.
+ *
+ * Computing them in double is equivalent only if both backends are double,
+ * otherwise they would be evaluated with the float backend.
+ *
+ * @returns false if both backends are double.
+ */
+bool use_wide_double_references();
+
+/**
+ * Get backend used for references computed in type R.
+ *
+ * @tparam R double or long double.
+ * @returns reference backend.
+ */
+template <typename R> ReferenceBackend get_reference_backend();
+
+template <> ReferenceBackend get_reference_backend<double>();
+
+template <> ReferenceBackend get_reference_backend<long double>();
+
+/**
+ * Elementary functions that have MPFR counterparts.
+ */
+enum class ReferenceFunction : uint32_t {
+  acos,
+  acosh,
+  asin,
+  asinh,
+  atan,
+  atan2,
+  atanh,
+  cbrt,
+  cos,
+  cosh,
+  erf,
+  erfc,
+  exp,
+  exp2,
+  expm1,
+  hypot,
+  lgamma,
+  log,
+  log10,
+  log1p,
+  log2,
+  pow,
+  sin,
+  sinh,
+  sqrt,
+  tan,
+  tanh,
+  tgamma
+};
+
+/**
+ * Evaluate function using MPFR and round the result to the precision of R.
+ *
+ * @param[in] function function to evaluate.
+ * @param[in] a first argument.
+ * @param[in] b second argument, ignored by unary functions.
+ * @returns correctly rounded result.
+ * @throws cassian::RuntimeException Thrown if MPFR is not available.
+ */
+double evaluate_mpfr(ReferenceFunction function, double a, double b);
+
+/**
+ * @overload
+ */
+long double evaluate_mpfr(ReferenceFunction function, long double a,
+                          long double b);
+
+/**
+ * Cube root refined with Newton iterations in double-double arithmetic.
+ *
+ * @param[in] value argument.
+ * @returns cube root of `value` rounded to double.
+ */
+double cbrt_high_precision(double value);
+
+/**
+ * Elementary functions evaluated with the backend selected for the
+ * precision of their arguments. Only double and long double arguments are
+ * accepted, so that reference code has to choose its precision explicitly.
+ */
+namespace reference_math {
+
+template <typename R>
+using EnableIfReference = std::enable_if_t<
+    std::is_same_v<R, double> || std::is_same_v<R, long double>, int>;
+
+template <typename R, typename F>
+R evaluate(ReferenceFunction function, F native, R a, R b = R(0)) {
+  switch (get_reference_backend<R>()) {
+  case ReferenceBackend::long_double:
+    return static_cast<R>(
+        native(static_cast<long double>(a), static_cast<long double>(b)));
+  case ReferenceBackend::mpfr:
+    return evaluate_mpfr(function, a, b);
+  default:
+    return static_cast<R>(
+        native(static_cast<double>(a), static_cast<double>(b)));
+  }
+}
+
+#define CASSIAN_REFERENCE_MATH_UNARY(FUNCTION)                                 \
+  template <typename R, EnableIfReference<R> = 0> R FUNCTION(R a) {            \
+    return evaluate(                                                           \
+        ReferenceFunction::FUNCTION,                                           \
+        [](auto x, auto /*unused*/) { return std::FUNCTION(x); }, a);          \
+  }
+
+#define CASSIAN_REFERENCE_MATH_BINARY(FUNCTION)                                \
+  template <typename R, EnableIfReference<R> = 0> R FUNCTION(R a, R b) {       \
+    return evaluate(                                                           \
+        ReferenceFunction::FUNCTION,                                           \
+        [](auto x, auto y) { return std::FUNCTION(x, y); }, a, b);             \
+  }
+
+CASSIAN_REFERENCE_MATH_UNARY(acos)
+CASSIAN_REFERENCE_MATH_UNARY(acosh)
+CASSIAN_REFERENCE_MATH_UNARY(asin)
+CASSIAN_REFERENCE_MATH_UNARY(asinh)
+CASSIAN_REFERENCE_MATH_UNARY(atan)
+CASSIAN_REFERENCE_MATH_BINARY(atan2)
+CASSIAN_REFERENCE_MATH_UNARY(atanh)
+CASSIAN_REFERENCE_MATH_UNARY(cos)
+CASSIAN_REFERENCE_MATH_UNARY(cosh)
+CASSIAN_REFERENCE_MATH_UNARY(erf)
+CASSIAN_REFERENCE_MATH_UNARY(erfc)
+CASSIAN_REFERENCE_MATH_UNARY(exp)
+CASSIAN_REFERENCE_MATH_UNARY(exp2)
+CASSIAN_REFERENCE_MATH_UNARY(expm1)
+CASSIAN_REFERENCE_MATH_BINARY(hypot)
+CASSIAN_REFERENCE_MATH_UNARY(log)
+CASSIAN_REFERENCE_MATH_UNARY(log10)
+CASSIAN_REFERENCE_MATH_UNARY(log1p)
+CASSIAN_REFERENCE_MATH_UNARY(log2)
+CASSIAN_REFERENCE_MATH_BINARY(pow)
+CASSIAN_REFERENCE_MATH_UNARY(sin)
+CASSIAN_REFERENCE_MATH_UNARY(sinh)
+CASSIAN_REFERENCE_MATH_UNARY(sqrt)
+CASSIAN_REFERENCE_MATH_UNARY(tan)
+CASSIAN_REFERENCE_MATH_UNARY(tanh)
+CASSIAN_REFERENCE_MATH_UNARY(tgamma)
+
+#undef CASSIAN_REFERENCE_MATH_UNARY
+#undef CASSIAN_REFERENCE_MATH_BINARY
+
+// std::lgamma writes global signgam, reentrant variants are used instead so
+// that references can be computed in parallel.
+template <typename R, EnableIfReference<R> = 0> R lgamma(R a) {
+  const auto native = [](auto x, auto /*unused*/) {
+#if defined(_WIN32)
+    return std::lgamma(x);
+#else
+    int sign = 0;
+    if constexpr (std::is_same_v<decltype(x), double>) {
+      return ::lgamma_r(x, &sign);
+    } else {
+      return ::lgammal_r(x, &sign);
+    }
+#endif
+  };
+  return evaluate(ReferenceFunction::lgamma, native, a);
+}
+
+template <typename R, EnableIfReference<R> = 0> R cbrt(R a) {
+  const auto native = [](auto x, auto /*unused*/) {
+    if constexpr (std::is_same_v<decltype(x), double>) {
+      return cbrt_high_precision(x);
+    } else {
+      return std::cbrt(x);
+    }
+  };
+  return evaluate(ReferenceFunction::cbrt, native, a);
+}
+
+} // namespace reference_math
+
+#endif
@@ -11,6 +11,7 @@
 #include <common.hpp>
 #include <cstddef>
 #include <memory>
+#include <reference_backend.hpp>
 #include <string>
 #include <test_config.hpp>
 
@@ -19,14 +20,31 @@ namespace ca = cassian;
 TestConfig::TestConfig(const ca::CommandLineParser &parser)
     : TestConfigBase(parser) {
   work_size_ = suggest_work_size(parser.get<std::string>("--work-size"));
+  exhaustive_ = parser.get_bool("--exhaustive");
+  exhaustive_chunk_size_ = parser.get_unsigned("--exhaustive-chunk-size", 1);
+  const auto float_backend = to_reference_backend(
+      parser.get<std::string>("--float-reference-backend"));
+  const auto double_backend = to_reference_backend(
+      parser.get<std::string>("--double-reference-backend"));
+  set_reference_backends(float_backend, double_backend);
 }
 
 size_t TestConfig::work_size() const { return work_size_; }
 
+bool TestConfig::exhaustive() const { return exhaustive_; }
+
+size_t TestConfig::exhaustive_chunk_size() const {
+  return exhaustive_chunk_size_;
+}
+
 const TestConfig *config = nullptr;
 const TestConfig &get_test_config() { return *config; }
 void set_test_config(const TestConfig &c) { config = &c; }
 
 void add_test_arguments(cassian::CommandLineParser *parser) {
   parser->add_argument("--work-size", "");
+  parser->add_argument("--exhaustive", "false");
+  parser->add_argument("--exhaustive-chunk-size", "1048576");
+  parser->add_argument("--float-reference-backend", "double");
+  parser->add_argument("--double-reference-backend", "double");
 }
@@ -20,9 +20,13 @@ public:
   explicit TestConfig(const cassian::CommandLineParser &parser);
 
   size_t work_size() const;
+  bool exhaustive() const;
+  size_t exhaustive_chunk_size() const;
 
 private:
   size_t work_size_ = 0;
+  bool exhaustive_ = false;
+  size_t exhaustive_chunk_size_ = 0;
 };
 
 const TestConfig &get_test_config();
@@ -10,6 +10,7 @@
 
 #include <cassian/cli/cli.hpp>
 #include <cassian/runtime/factory.hpp>
+#include <cassian/test_harness/sharding.hpp>
 #include <cassian/test_harness/test_config.hpp>
 #include <cassian/utility/version.hpp>
 #include <test_config.hpp>
@@ -25,6 +26,8 @@ int main(int argc, char *argv[]) {
   const TestConfig config(parser);
   set_test_config(config);
 
-  int result = Catch::Session().run(argc, argv);
+  Catch::Session session;
+  int result = cassian::run_test_session(session, parser, config.runtime(),
+                                         argc, argv);
   return result;
 }
\ No newline at end of file
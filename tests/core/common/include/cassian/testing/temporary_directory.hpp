@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef CASSIAN_TESTING_TEMPORARY_DIRECTORY_HPP
+#define CASSIAN_TESTING_TEMPORARY_DIRECTORY_HPP
+
+#include <filesystem>
+#include <random>
+#include <string>
+
+namespace cassian::testing {
+
+/**
+ * Uniquely named path in the system temporary directory.
+ *
+ * The directory is not created, but it is removed with its contents when the
+ * object is destroyed, also if a test fails.
+ */
+class TemporaryDirectory {
+public:
+  /**
+   * Construct a path starting with a given prefix.
+   *
+   * @param[in] prefix directory name prefix.
+   */
+  explicit TemporaryDirectory(const std::string &prefix)
+      : path_(std::filesystem::temp_directory_path() /
+              (prefix + std::to_string(std::random_device()()))) {}
+  TemporaryDirectory(const TemporaryDirectory &) = delete;
+  TemporaryDirectory(TemporaryDirectory &&) = delete;
+  ~TemporaryDirectory() {
+    std::error_code error;
+    std::filesystem::remove_all(path_, error);
+  }
+  TemporaryDirectory &operator=(const TemporaryDirectory &) = delete;
+  TemporaryDirectory &operator=(TemporaryDirectory &&) = delete;
+
+  /**
+   * @returns directory path.
+   */
+  const std::filesystem::path &path() const { return path_; }
+
+private:
+  std::filesystem::path path_;
+};
+
+} // namespace cassian::testing
+
+#endif
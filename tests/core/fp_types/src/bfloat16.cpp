@@ -5,7 +5,10 @@
  *
  */
 
+#include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <span>
 #include <sstream>
 #include <tuple>
 #include <type_traits>
@@ -110,6 +113,46 @@ TEST_CASE("bfloat16 from float with rnde rounding", "") {
 const uint16_t bfloat16_nan2 = 0x7f83;
 const uint16_t bfloat16_nan3 = 0x7f81;
 const uint16_t bfloat16_inf = 0x7f80;
+TEST_CASE("bfloat16 batch conversion from float matches scalar", "") {
+  REQUIRE(count_batch_mismatches<ca::Bfloat16>(sampled_float_count,
+                                               sampled_float_bits) == 0);
+}
+
+TEST_CASE("bfloat16 batch conversion from all floats matches scalar",
+          "[.exhaustive]") {
+  REQUIRE(count_batch_mismatches<ca::Bfloat16>(all_float_count,
+                                               all_float_bits) == 0);
+}
+
+TEST_CASE("bfloat16 batch conversion to float matches scalar", "") {
+  REQUIRE(count_batch_to_float_mismatches<ca::Bfloat16>(uint64_t(1) << 16) ==
+          0);
+}
+
+TEST_CASE("bfloat16 decoding and classification are constexpr", "") {
+  constexpr auto one = ca::Bfloat16::encode(0x3f80);
+  constexpr auto denorm = ca::Bfloat16::encode(0x8001);
+  constexpr auto nan = ca::Bfloat16::encode(0x7fc0);
+  static_assert(static_cast<float>(one) == 1.0F);
+  static_assert(isnan(nan) && !isinf(nan));
+  static_assert(fpclassify(denorm) == FP_SUBNORMAL);
+  static_assert(one > denorm && one != nan);
+  static_assert(nextafter(one, -one).decode() == 0x3f7f);
+  static_assert(nextafter(ca::Bfloat16(), -one).decode() == 0x8001);
+  static_assert(copysign(one, denorm).decode() == 0xbf80);
+  static_assert(abs(denorm).decode() == 0x0001);
+  SUCCEED();
+}
+
+TEST_CASE("bfloat16 decode table matches float conversion", "") {
+  const auto &table = ca::get_bfloat16_to_float_table();
+  for (uint32_t i = 0; i < table.size(); i++) {
+    const auto expected =
+        static_cast<float>(ca::Bfloat16::encode(static_cast<uint16_t>(i)));
+    REQUIRE(std::memcmp(&table[i], &expected, sizeof(float)) == 0);
+  }
+}
+
 TEST_CASE("bfloat16 NaN sensitive comparison same NaN value") {
   ca::bfloat16 bf = ca::bfloat16::encode(bfloat16_nan2);
   REQUIRE(true == bf.nan_sensitive_eq(bf));
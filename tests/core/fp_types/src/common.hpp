@@ -9,8 +9,11 @@
 #define CASSIAN_TESTS_FP_TYPES_COMMON_HPP
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <span>
 #include <tuple>
 #include <vector>
 
@@ -46,4 +49,67 @@ std::vector<std::tuple<T, Args...>> zip(const std::vector<T> t,
   return temp;
 }
 
+// Number of float bit patterns produced by sampled_float_bits.
+constexpr uint64_t sampled_float_count = uint64_t(1) << 22;
+
+// Every sign, exponent and upper mantissa bit combination. Low 16 bits cover
+// all combinations of the bits deciding rounding to 16 and 19 bit types.
+inline uint32_t sampled_float_bits(uint64_t i) {
+  constexpr std::array<uint32_t, 4> low_bits = {0x000, 0x001, 0x800, 0xfff};
+  const auto upper = static_cast<uint32_t>(i >> 6) << 16;
+  const auto rounding_bits = static_cast<uint32_t>((i >> 2) & 0xf) << 12;
+  return upper | rounding_bits | low_bits[i & 3];
+}
+
+// Number of all float bit patterns.
+constexpr uint64_t all_float_count = uint64_t(1) << 32;
+
+inline uint32_t all_float_bits(uint64_t i) { return static_cast<uint32_t>(i); }
+
+// Converts float bit patterns pattern(0)...pattern(count - 1) with batch
+// cassian::convert and returns the number of results different from the
+// scalar constructor.
+template <typename T, typename PATTERN, typename... ARGS>
+size_t count_batch_mismatches(uint64_t count, PATTERN pattern, ARGS... args) {
+  constexpr size_t chunk_size = 1 << 16;
+  std::vector<float> input(chunk_size);
+  std::vector<T> output(chunk_size);
+  size_t mismatches = 0;
+  for (uint64_t first = 0; first < count; first += chunk_size) {
+    const auto size =
+        static_cast<size_t>(std::min<uint64_t>(chunk_size, count - first));
+    for (size_t i = 0; i < size; i++) {
+      input[i] = uint32_to_float(pattern(first + i));
+    }
+    cassian::convert(std::span<const float>(input.data(), size),
+                     std::span<T>(output.data(), size), args...);
+    for (size_t i = 0; i < size; i++) {
+      if (T(input[i]).decode() != output[i].decode()) {
+        mismatches++;
+      }
+    }
+  }
+  return mismatches;
+}
+
+// Converts every value of a type with batch cassian::convert and returns the
+// number of results different from the scalar float cast.
+template <typename T>
+size_t count_batch_to_float_mismatches(uint64_t count, unsigned shift = 0) {
+  std::vector<T> input(count);
+  std::vector<float> output(count);
+  for (uint64_t i = 0; i < count; i++) {
+    input[i] = T::encode(static_cast<typename T::storage_t>(i << shift));
+  }
+  cassian::convert(std::span<const T>(input), std::span<float>(output));
+  size_t mismatches = 0;
+  for (uint64_t i = 0; i < count; i++) {
+    const auto expected = static_cast<float>(input[i]);
+    if (std::memcmp(&expected, &output[i], sizeof(float)) != 0) {
+      mismatches++;
+    }
+  }
+  return mismatches;
+}
+
 #endif
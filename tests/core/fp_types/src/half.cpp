@@ -7,8 +7,11 @@
 
 #include <cfenv>
 #include <cstdint>
+#include <cstring>
 #include <limits>
+#include <span>
 #include <sstream>
+#include <stdexcept>
 #include <tuple>
 #include <type_traits>
 #include <vector>
@@ -225,6 +228,65 @@ TEST_CASE("half from float with rounding towards zero", "") {
   test(std::get<0>(test_params), std::get<1>(test_params));
 }
 
+TEST_CASE("half batch conversion from float matches scalar", "") {
+  auto sg = RoundingModeScopeGuard<fesetround>(fegetround());
+  const int rounding_mode =
+      GENERATE(FE_TONEAREST, FE_UPWARD, FE_DOWNWARD, FE_TOWARDZERO);
+  fesetround(rounding_mode);
+  REQUIRE(count_batch_mismatches<ca::Half>(
+              sampled_float_count, sampled_float_bits, rounding_mode) == 0);
+}
+
+TEST_CASE("half batch conversion from all floats matches scalar",
+          "[.exhaustive]") {
+  auto sg = RoundingModeScopeGuard<fesetround>(fegetround());
+  const int rounding_mode =
+      GENERATE(FE_TONEAREST, FE_UPWARD, FE_DOWNWARD, FE_TOWARDZERO);
+  fesetround(rounding_mode);
+  REQUIRE(count_batch_mismatches<ca::Half>(all_float_count, all_float_bits,
+                                           rounding_mode) == 0);
+}
+
+TEST_CASE("half batch conversion to float matches scalar", "") {
+  REQUIRE(count_batch_to_float_mismatches<ca::Half>(uint64_t(1) << 16) == 0);
+}
+
+TEST_CASE("half decoding and classification are constexpr", "") {
+  constexpr auto one = ca::Half::encode(0x3c00);
+  constexpr auto denorm = ca::Half::encode(0x8001);
+  constexpr auto nan = ca::Half::encode(0x7e00);
+  static_assert(static_cast<float>(one) == 1.0F);
+  static_assert(static_cast<float>(denorm) == -5.960464477539063e-8F);
+  static_assert(isnan(nan) && !isinf(nan));
+  static_assert(fpclassify(denorm) == FP_SUBNORMAL);
+  static_assert(one > denorm && one != nan);
+  static_assert(nextafter(one, -one).decode() == 0x3bff);
+  static_assert(nextafter(ca::Half(), -one).decode() == 0x8001);
+  static_assert(nextafter(one, nan).decode() == 0x7e00);
+  static_assert(copysign(one, denorm).decode() == 0xbc00);
+  static_assert(abs(denorm).decode() == 0x0001);
+  static_assert(ca::isnan(nan) && ca::fpclassify(one) == FP_NORMAL);
+  static_assert(ca::copysign(ca::abs(denorm), one).decode() == 0x0001);
+  SUCCEED();
+}
+
+TEST_CASE("half decode table matches float conversion", "") {
+  const auto &table = ca::get_half_to_float_table();
+  for (uint32_t i = 0; i < table.size(); i++) {
+    const auto expected =
+        static_cast<float>(ca::Half::encode(static_cast<uint16_t>(i)));
+    REQUIRE(std::memcmp(&table[i], &expected, sizeof(float)) == 0);
+  }
+}
+
+TEST_CASE("half batch conversion with different sizes throws", "") {
+  std::vector<float> input(2);
+  std::vector<ca::Half> output(1);
+  REQUIRE_THROWS_AS(ca::convert(std::span<const float>(input),
+                                std::span<ca::Half>(output)),
+                    std::invalid_argument);
+}
+
 TEST_CASE("float with half min denorm exponent might be rounded to denormal") {
   uint32_t bits = 0x333501f0; // unbiased exponent -25
   float f = 0.0F;
@@ -7,6 +7,7 @@
 
 #include <cstdint>
 #include <limits>
+#include <span>
 #include <sstream>
 #include <tuple>
 #include <vector>
@@ -109,6 +110,22 @@ TEST_CASE("tfloat from float with rnde rounding", "") {
 const uint32_t tfloat_nan2 = 0x7f830000;
 const uint32_t tfloat_nan3 = 0x7f810000;
 const uint32_t tfloat_inf = 0x7f800000;
+TEST_CASE("tfloat batch conversion from float matches scalar", "") {
+  REQUIRE(count_batch_mismatches<ca::Tfloat>(sampled_float_count,
+                                             sampled_float_bits) == 0);
+}
+
+TEST_CASE("tfloat batch conversion from all floats matches scalar",
+          "[.exhaustive]") {
+  REQUIRE(count_batch_mismatches<ca::Tfloat>(all_float_count,
+                                             all_float_bits) == 0);
+}
+
+TEST_CASE("tfloat batch conversion to float matches scalar", "") {
+  REQUIRE(count_batch_to_float_mismatches<ca::Tfloat>(uint64_t(1) << 19, 13) ==
+          0);
+}
+
 TEST_CASE("tfloat NaN sensitive comparison same NaN value") {
   ca::Tfloat bf = ca::Tfloat::encode(tfloat_nan2);
   REQUIRE(true == bf.nan_sensitive_eq(bf));
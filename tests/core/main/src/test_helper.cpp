@@ -0,0 +1,272 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <cassian/main/config.hpp>
+#include <cassian/main/test_helper.hpp>
+#include <cassian/runtime/access_qualifier.hpp>
+#include <cassian/runtime/memory_kind.hpp>
+#include <cassian/runtime/mocks/dummy_runtime.hpp>
+#include <cassian/runtime/runtime.hpp>
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ca = cassian;
+
+namespace {
+
+std::string to_string(ca::AccessQualifier access) {
+  switch (access) {
+  case ca::AccessQualifier::read_only:
+    return "read_only";
+  case ca::AccessQualifier::write_only:
+    return "write_only";
+  default:
+    return "read_write";
+  }
+}
+
+// Records transfers, mappings and kernel launches, read buffers are filled
+// with twice the global index of each element.
+class RecordingRuntime : public ca::DummyRuntime {
+public:
+  std::vector<std::string> log;
+  std::map<std::uintptr_t, ca::MemoryKind> memory_kinds;
+  std::map<std::uintptr_t, std::vector<int>> mapped_data;
+
+  void reset() {
+    log.clear();
+    memory_kinds.clear();
+    mapped_data.clear();
+    buffer_count_ = 0;
+    offset_ = 0;
+  }
+
+  ca::Buffer create_buffer(int device, size_t size,
+                           ca::AccessQualifier /*access*/,
+                           ca::MemoryKind memory_kind) override {
+    const auto id = ++buffer_count_;
+    memory_kinds[id] = memory_kind;
+    return ca::Buffer(device, id, size);
+  }
+
+  void *map_buffer(const ca::Buffer &buffer,
+                   ca::AccessQualifier access) override {
+    log.push_back("map " + std::to_string(buffer.id) + " " +
+                  to_string(access));
+    auto &data = mapped_data[buffer.id];
+    data.resize(buffer.size / sizeof(int));
+    return data.data();
+  }
+
+  void unmap_buffer(const ca::Buffer &buffer) override {
+    log.push_back("unmap " + std::to_string(buffer.id));
+  }
+
+  ca::Event enqueue_write_buffer(const ca::Buffer &buffer,
+                                 const void *data) override {
+    log.push_back("write " + std::to_string(buffer.id) + " " +
+                  std::to_string(*static_cast<const int *>(data)));
+    return ca::Event(buffer.device, 0);
+  }
+
+  ca::Event enqueue_read_buffer(const ca::Buffer &buffer,
+                                void *data) override {
+    auto *values = static_cast<int *>(data);
+    for (size_t i = 0; i < buffer.size / sizeof(int); i++) {
+      values[i] = static_cast<int>(2 * (offset_ + i));
+    }
+    log.push_back("read " + std::to_string(buffer.id));
+    return ca::Event(buffer.device, 0);
+  }
+
+  void wait(const std::vector<ca::Event> &events) override {
+    log.push_back("wait " + std::to_string(events.size()));
+  }
+
+  void finish(int device) override {
+    log.push_back("finish " + std::to_string(device));
+  }
+
+protected:
+  void set_kernel_argument(const ca::Kernel & /*kernel*/,
+                           int /*argument_index*/, size_t argument_size,
+                           const void *argument) override {
+    if (argument_size == sizeof(offset_)) {
+      std::memcpy(&offset_, argument, argument_size);
+    }
+  }
+
+  void run_kernel_common(
+      int device, const ca::Kernel &kernel,
+      std::array<size_t, 3> global_work_size,
+      const std::array<size_t, 3> *local_work_size) override {
+    enqueue_run_kernel_common(device, kernel, global_work_size,
+                              local_work_size);
+  }
+
+  ca::Event enqueue_run_kernel_common(
+      int device, const ca::Kernel & /*kernel*/,
+      std::array<size_t, 3> global_work_size,
+      const std::array<size_t, 3> *local_work_size) override {
+    log.push_back("run " + std::to_string(offset_) + " " +
+                  std::to_string(global_work_size[0]) + " " +
+                  std::to_string((*local_work_size)[0]));
+    return ca::Event(device, 0);
+  }
+
+private:
+  std::uintptr_t buffer_count_ = 0;
+  unsigned long long offset_ = 0;
+};
+
+RecordingRuntime *get_runtime() {
+  static ca::test::Config config(std::make_unique<RecordingRuntime>());
+  ca::test::set_config(config);
+  auto *runtime = static_cast<RecordingRuntime *>(config.runtime());
+  runtime->reset();
+  return runtime;
+}
+
+TEST_CASE("stream_kernel") {
+  auto *runtime = get_runtime();
+
+  const auto pass_streams = [runtime](std::vector<int> &output) {
+    ca::test::stream_input<int>([runtime](size_t offset, std::span<int> data) {
+      runtime->log.push_back("generate " + std::to_string(offset) + " " +
+                             std::to_string(data.size()));
+      for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<int>(offset + i);
+      }
+    });
+    ca::test::stream_output<int>(
+        [runtime, &output](size_t offset, std::span<const int> data) {
+          runtime->log.push_back("consume " + std::to_string(offset) + " " +
+                                 std::to_string(data.size()));
+          std::copy(data.begin(), data.end(), output.begin() + offset);
+        });
+    ca::test::stream_offset();
+  };
+
+  SECTION("chunks alternate between slots") {
+    std::vector<int> output(10);
+    pass_streams(output);
+    ca::test::stream_kernel(10, 2, 5, "test_kernel", "", "");
+
+    // Chunk size is rounded down to 4, the last chunk holds the remaining 2
+    // work items. Input buffers are 1 and 2, output buffers are 3 and 4.
+    const std::vector<std::string> expected = {
+        "generate 0 4", "write 1 0", "run 0 4 2", "read 3",
+        "generate 4 4", "write 2 4", "run 4 4 2", "read 4",
+        "wait 3",       "consume 0 4",
+        "generate 8 2", "write 1 8", "run 8 2 2", "read 3",
+        "wait 3",       "consume 4 4",
+        "wait 3",       "consume 8 2",  "finish 0"};
+    REQUIRE(runtime->log == expected);
+
+    const std::vector<int> expected_output = {0,  2,  4,  6,  8,
+                                              10, 12, 14, 16, 18};
+    REQUIRE(output == expected_output);
+  }
+
+  SECTION("single chunk") {
+    std::vector<int> output(4);
+    pass_streams(output);
+    ca::test::stream_kernel(4, 2, 8, "test_kernel", "", "");
+
+    const std::vector<std::string> expected = {
+        "generate 0 4", "write 1 0", "run 0 4 2", "read 3", "wait 3",
+        "consume 0 4",  "finish 0"};
+    REQUIRE(runtime->log == expected);
+  }
+
+  SECTION("zero global work size") {
+    std::vector<int> output;
+    pass_streams(output);
+    REQUIRE_THROWS_AS(ca::test::stream_kernel(0, 2, 4, "test_kernel", "", ""),
+                      std::invalid_argument);
+    REQUIRE(runtime->log.empty());
+  }
+
+  SECTION("chunk size smaller than local work size") {
+    std::vector<int> output(4);
+    pass_streams(output);
+    REQUIRE_THROWS_AS(ca::test::stream_kernel(4, 4, 2, "test_kernel", "", ""),
+                      std::invalid_argument);
+  }
+
+  SECTION("global work size not a multiple of local work size") {
+    std::vector<int> output(10);
+    pass_streams(output);
+    REQUIRE_THROWS_AS(ca::test::stream_kernel(10, 4, 8, "test_kernel", "", ""),
+                      std::invalid_argument);
+    REQUIRE(runtime->log.empty());
+  }
+}
+
+TEST_CASE("mapped_input") {
+  auto *runtime = get_runtime();
+
+  ca::test::mapped_input<int>(4, [runtime](std::span<int> data) {
+    runtime->log.push_back("generate " + std::to_string(data.size()));
+    std::fill(data.begin(), data.end(), 3);
+  });
+  ca::test::kernel(4, 2, "test_kernel", "", "");
+
+  REQUIRE(runtime->memory_kinds.at(1) == ca::MemoryKind::shared);
+  REQUIRE(runtime->mapped_data.at(1) == std::vector<int>(4, 3));
+  const std::vector<std::string> expected = {"map 1 write_only", "generate 4",
+                                             "unmap 1", "run 0 4 2"};
+  REQUIRE(runtime->log == expected);
+}
+
+TEST_CASE("mapped_output") {
+  auto *runtime = get_runtime();
+
+  std::vector<int> output;
+  ca::test::mapped_output<int>(
+      4, [runtime, &output](std::span<const int> data) {
+        runtime->log.push_back("check " + std::to_string(data.size()));
+        output.assign(data.begin(), data.end());
+      });
+  runtime->log.push_back("passed");
+  runtime->mapped_data[1] = {1, 2, 3, 4};
+  ca::test::kernel(4, 2, "test_kernel", "", "");
+
+  REQUIRE(runtime->memory_kinds.at(1) == ca::MemoryKind::shared);
+  REQUIRE(output == std::vector<int>{1, 2, 3, 4});
+  const std::vector<std::string> expected = {"passed", "run 0 4 2",
+                                             "map 1 read_only", "check 4",
+                                             "unmap 1"};
+  REQUIRE(runtime->log == expected);
+}
+
+TEST_CASE("mapped buffers on dummy runtime") {
+  static ca::test::Config config(std::make_unique<ca::DummyRuntime>());
+  ca::test::set_config(config);
+
+  std::vector<int> output;
+  ca::test::mapped_input<int>(
+      4, [](std::span<int> data) { std::fill(data.begin(), data.end(), 3); });
+  ca::test::mapped_output<int>(4, [&output](std::span<const int> data) {
+    output.assign(data.begin(), data.end());
+  });
+  ca::test::kernel(4, 2, "test_kernel", "", "");
+
+  REQUIRE(output.size() == 4);
+}
+
+} // namespace
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cassian/offline_compiler/offline_compiler.hpp>
+#include <cassian/offline_compiler/spirv_cache.hpp>
+#include <cassian/testing/temporary_directory.hpp>
+#include <cassian/utility/utility.hpp>
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ca = cassian;
+
+TEST_CASE("generate_spirv_from_sources") {
+  const uint32_t ip_version = 0;
+
+  SECTION("no jobs") {
+    const auto futures = ca::generate_spirv_from_sources(ip_version, {});
+    REQUIRE(futures.empty());
+  }
+
+  SECTION("results are returned in order of jobs") {
+    std::vector<ca::SpirvCompileJob> jobs;
+    for (uint8_t i = 0; i < 16; i++) {
+      const std::string source = "kernel void test_" + std::to_string(i) +
+                                 "(global int *output) {}";
+      const std::string build_options = "-DVALUE=" + std::to_string(i);
+      ca::get_spirv_cache().store(
+          ca::spirv_cache_key(ca::get_offline_compiler_version(), ip_version,
+                              source, build_options),
+          {i});
+      jobs.push_back({source, build_options});
+    }
+
+    auto futures = ca::generate_spirv_from_sources(ip_version, jobs);
+    REQUIRE(futures.size() == jobs.size());
+    for (uint8_t i = 0; i < futures.size(); i++) {
+      const std::vector<uint8_t> expected = {i};
+      REQUIRE(futures[i].get() == expected);
+    }
+  }
+}
+
+TEST_CASE("generate_spirv") {
+  const uint32_t ip_version = 0;
+  const std::string source =
+      "kernel void test_" + std::to_string(std::random_device()()) +
+      "(global int *output) {}";
+  const ca::testing::TemporaryDirectory directory("cassian_test_");
+  fs::create_directories(directory.path());
+  const auto source_path = (directory.path() / "test.cl").string();
+  ca::save_text_file(source, source_path);
+  const std::vector<uint8_t> spirv = {1, 2, 3};
+  ca::get_spirv_cache().store(
+      ca::spirv_cache_key(ca::get_offline_compiler_version(), ip_version,
+                          source, ""),
+      spirv);
+
+  SECTION("concurrent calls get own modules in temporary directory") {
+    std::vector<std::string> paths(8);
+    std::vector<std::thread> threads;
+    for (auto &path : paths) {
+      threads.emplace_back([&source_path, &path]() {
+        path = ca::generate_spirv(ip_version, source_path);
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    for (size_t i = 0; i < paths.size(); i++) {
+      REQUIRE(fs::path(paths[i]).parent_path() == fs::temp_directory_path());
+      REQUIRE(ca::load_binary_file(paths[i]) == spirv);
+      for (size_t j = 0; j < i; j++) {
+        REQUIRE(paths[i] != paths[j]);
+      }
+    }
+    for (const auto &path : paths) {
+      fs::remove(path);
+    }
+  }
+}
+
+TEST_CASE("generate_spirv_from_sources - concurrent compilation") {
+  if (ca::get_offline_compiler_version().empty()) {
+    WARN("Offline compiler is not available");
+    return;
+  }
+
+  // Unique source, so modules are not found in the SPIR-V cache
+  const std::string source =
+      "kernel void test_" + std::to_string(std::random_device()()) +
+      "(global int *output) { output[0] = VALUE; }";
+  const size_t variants = 4;
+  std::vector<ca::SpirvCompileJob> jobs;
+  for (size_t i = 0; i < 4 * variants; i++) {
+    jobs.push_back({source, "-DVALUE=" + std::to_string(i % variants)});
+  }
+
+  auto futures = ca::generate_spirv_from_sources(0, jobs, true);
+  std::vector<std::vector<uint8_t>> modules;
+  for (auto &future : futures) {
+    modules.push_back(future.get());
+    REQUIRE_FALSE(modules.back().empty());
+  }
+  for (size_t i = variants; i < modules.size(); i++) {
+    REQUIRE(modules[i] == modules[i % variants]);
+  }
+}
+
+#if defined(__linux__)
+
+TEST_CASE("generate_spirv_from_sources - compilations overlap") {
+  const ca::testing::TemporaryDirectory temporary_directory(
+      "cassian_test_ocloc_");
+  const auto &directory = temporary_directory.path();
+  const auto started = directory / "started";
+  fs::create_directories(started);
+
+  // Fake compiler succeeds only if another instance runs at the same time
+  const auto executable = directory / "ocloc";
+  ca::save_text_file("#!/bin/sh\n"
+                     "while [ $# -gt 0 ] && [ \"$1\" != -out_dir ]; do\n"
+                     "  shift\n"
+                     "done\n"
+                     "touch \"" +
+                         started.string() +
+                         "/$$\"\n"
+                         "for i in $(seq 100); do\n"
+                         "  if [ $(ls \"" +
+                         started.string() +
+                         "\" | wc -l) -ge 2 ]; then\n"
+                         "    echo spirv > \"$2/program.spv\"\n"
+                         "    exit 0\n"
+                         "  fi\n"
+                         "  sleep 0.1\n"
+                         "done\n"
+                         "exit 1\n",
+                     executable.string());
+  fs::permissions(executable, fs::perms::owner_all);
+  ca::set_offline_compiler_executable(executable.string());
+
+  // Unique sources, so modules are not found in the SPIR-V cache
+  std::vector<ca::SpirvCompileJob> jobs;
+  for (int i = 0; i < 2; i++) {
+    jobs.push_back({"kernel void test_" +
+                        std::to_string(std::random_device()()) + "() {}",
+                    ""});
+  }
+  auto futures = ca::generate_spirv_from_sources(0, jobs, true);
+  std::vector<std::vector<uint8_t>> modules;
+  for (auto &future : futures) {
+    try {
+      modules.push_back(future.get());
+    } catch (const ca::OfflineCompilerException &) {
+      modules.emplace_back();
+    }
+  }
+  ca::set_offline_compiler_executable("");
+
+  const std::string expected = "spirv\n";
+  for (const auto &module : modules) {
+    REQUIRE(module == std::vector<uint8_t>(expected.begin(), expected.end()));
+  }
+}
+
+#endif
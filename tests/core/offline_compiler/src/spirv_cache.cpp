@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cassian/offline_compiler/spirv_cache.hpp>
+#include <cassian/testing/temporary_directory.hpp>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace ca = cassian;
+
+TEST_CASE("SpirvCache") {
+  const std::vector<uint8_t> spirv = {0x03, 0x02, 0x23, 0x07};
+  const std::string key = ca::spirv_cache_key("", 0, "kernel void a() {}", "");
+
+  SECTION("store and load") {
+    ca::SpirvCache cache;
+    REQUIRE_FALSE(cache.load(key).has_value());
+    cache.store(key, spirv);
+    const auto output = cache.load(key);
+    REQUIRE(output.has_value());
+    REQUIRE(output.value() == spirv);
+
+    const auto statistics = cache.statistics();
+    REQUIRE(statistics.memory_hits == 1);
+    REQUIRE(statistics.disk_hits == 0);
+    REQUIRE(statistics.misses == 1);
+  }
+
+  SECTION("least recently used module is evicted") {
+    ca::SpirvCache cache(2 * spirv.size());
+    const std::string key_a = ca::spirv_cache_key("", 0, "a", "");
+    const std::string key_b = ca::spirv_cache_key("", 0, "b", "");
+    const std::string key_c = ca::spirv_cache_key("", 0, "c", "");
+    cache.store(key_a, spirv);
+    cache.store(key_b, spirv);
+    REQUIRE(cache.load(key_a).has_value());
+    cache.store(key_c, spirv);
+    REQUIRE(cache.load(key_a).has_value());
+    REQUIRE_FALSE(cache.load(key_b).has_value());
+    REQUIRE(cache.load(key_c).has_value());
+  }
+
+  SECTION("zero capacity") {
+    ca::SpirvCache cache(0);
+    cache.store(key, spirv);
+    REQUIRE_FALSE(cache.load(key).has_value());
+  }
+
+  SECTION("disk") {
+    const ca::testing::TemporaryDirectory directory(
+        "cassian_test_spirv_cache_");
+    {
+      ca::SpirvCache cache;
+      cache.set_directory(directory.path().string());
+      cache.store(key, spirv);
+    }
+    ca::SpirvCache cache;
+    cache.set_directory(directory.path().string());
+    const auto output = cache.load(key);
+    REQUIRE(output.has_value());
+    REQUIRE(output.value() == spirv);
+    REQUIRE(cache.load(key).has_value());
+
+    const auto statistics = cache.statistics();
+    REQUIRE(statistics.memory_hits == 1);
+    REQUIRE(statistics.disk_hits == 1);
+    REQUIRE(statistics.misses == 0);
+  }
+
+  SECTION("not persistent") {
+    const ca::testing::TemporaryDirectory directory(
+        "cassian_test_spirv_cache_");
+    {
+      ca::SpirvCache cache;
+      cache.set_directory(directory.path().string());
+      cache.store(key, spirv, false);
+      REQUIRE(cache.load(key, false).has_value());
+    }
+    ca::SpirvCache cache;
+    cache.set_directory(directory.path().string());
+    REQUIRE_FALSE(cache.load(key).has_value());
+  }
+}
+
+TEST_CASE("is_spirv_cache_persistent") {
+  REQUIRE(ca::is_spirv_cache_persistent("1.0"));
+  REQUIRE_FALSE(ca::is_spirv_cache_persistent(""));
+}
+
+TEST_CASE("spirv_cache_key") {
+  const auto key = ca::spirv_cache_key("1.0", 1, "source", "-O0");
+  REQUIRE(key == ca::spirv_cache_key("1.0", 1, "source", "-O0"));
+  REQUIRE(key != ca::spirv_cache_key("1.1", 1, "source", "-O0"));
+  REQUIRE(key != ca::spirv_cache_key("1.0", 2, "source", "-O0"));
+  REQUIRE(key != ca::spirv_cache_key("1.0", 1, "source", ""));
+  REQUIRE(ca::spirv_cache_key("1.0", 1, "b", "a") !=
+          ca::spirv_cache_key("1.0", 1, "", "ab"));
+  REQUIRE(ca::spirv_cache_key("1", 11, "source", "") !=
+          ca::spirv_cache_key("11", 1, "source", ""));
+}
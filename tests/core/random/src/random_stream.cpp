@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <array>
+#include <cassian/fp_types/bfloat16.hpp>
+#include <cassian/fp_types/half.hpp>
+#include <cassian/fp_types/tfloat.hpp>
+#include <cassian/random/random_stream.hpp>
+#include <cassian/utility/parallel.hpp>
+#include <cassian/utility/utility.hpp>
+#include <cassian/vector/vector.hpp>
+#include <catch2/catch.hpp>
+#include <cfenv>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ca = cassian;
+
+namespace {
+
+TEST_CASE("philox4x32") {
+  SECTION("zero counter and key") {
+    const std::array<uint32_t, 4> expected = {0x6627e8d5, 0xe169c58d,
+                                              0xbc57ac4c, 0x9b00dbd8};
+    REQUIRE(ca::philox4x32({0, 0, 0, 0}, {0, 0}) == expected);
+  }
+  SECTION("all ones counter and key") {
+    const std::array<uint32_t, 4> expected = {0x408f276d, 0x41c83b0e,
+                                              0xa20bc7c6, 0x6d5451fd};
+    REQUIRE(ca::philox4x32({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+                           {0xffffffff, 0xffffffff}) == expected);
+  }
+}
+
+TEST_CASE("RandomStream") {
+  const int seed = 0;
+  const ca::RandomStream stream(seed, "test");
+  const int iterations = 1000;
+
+  SECTION("values are independent of generation order") {
+    const auto forward = stream.generate_vector<uint32_t>(iterations, 0,
+                                                          UINT32_MAX);
+    for (int i = iterations - 1; i >= 0; --i) {
+      REQUIRE(stream.generate_value<uint32_t>(i, 0, UINT32_MAX) ==
+              forward[i]);
+    }
+    const auto tail =
+        stream.generate_vector<uint32_t>(10, 0, UINT32_MAX, iterations - 10);
+    REQUIRE(std::vector<uint32_t>(forward.end() - 10, forward.end()) == tail);
+  }
+
+  SECTION("streams differ") {
+    const ca::RandomStream other_seed(seed + 1, "test");
+    const ca::RandomStream other_name(seed, "other");
+    const ca::RandomStream other_id(seed, "test", 1);
+    const auto values = stream.generate_vector<uint64_t>(16, 0, UINT64_MAX);
+    REQUIRE(values != other_seed.generate_vector<uint64_t>(16, 0, UINT64_MAX));
+    REQUIRE(values != other_name.generate_vector<uint64_t>(16, 0, UINT64_MAX));
+    REQUIRE(values != other_id.generate_vector<uint64_t>(16, 0, UINT64_MAX));
+    REQUIRE(values == ca::RandomStream(seed, "test").generate_vector<uint64_t>(
+                          16, 0, UINT64_MAX));
+  }
+
+  SECTION("integer invalid range") {
+    REQUIRE_THROWS_AS(stream.generate_value<int32_t>(0, 1, -1),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(stream.generate_value<uint8_t>(0, 2, 1),
+                      std::invalid_argument);
+  }
+
+  SECTION("int8_t") {
+    const int8_t min = -10;
+    const int8_t max = 20;
+    bool min_seen = false;
+    bool max_seen = false;
+    for (int i = 0; i < iterations; ++i) {
+      const auto output = stream.generate_value<int8_t>(i, min, max);
+      REQUIRE(output >= min);
+      REQUIRE(output <= max);
+      min_seen = min_seen || output == min;
+      max_seen = max_seen || output == max;
+    }
+    REQUIRE(min_seen);
+    REQUIRE(max_seen);
+  }
+
+  SECTION("int64_t full range") {
+    for (int i = 0; i < iterations; ++i) {
+      REQUIRE_NOTHROW(stream.generate_value<int64_t>(i, INT64_MIN, INT64_MAX));
+    }
+  }
+
+  SECTION("float") {
+    const float min = -10.0F;
+    const float max = 20.0F;
+    for (int i = 0; i < iterations; ++i) {
+      const auto output = stream.generate_value<float>(i, min, max);
+      REQUIRE(output >= min);
+      REQUIRE(output <= max);
+    }
+    REQUIRE_THROWS_AS(stream.generate_value<float>(0, max, min),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(stream.generate_value<float>(
+                          0, std::numeric_limits<float>::quiet_NaN(), max),
+                      std::invalid_argument);
+  }
+
+  SECTION("double") {
+    const double min = 1.0;
+    const double max = 2.0;
+    for (int i = 0; i < iterations; ++i) {
+      const auto output = stream.generate_value<double>(i, min, max);
+      REQUIRE(output >= min);
+      REQUIRE(output <= max);
+    }
+  }
+
+  SECTION("half") {
+    const ca::half min(-1.0F);
+    const ca::half max(1.0F);
+    for (int i = 0; i < iterations; ++i) {
+      const auto output = stream.generate_value<ca::half>(i, min, max);
+      REQUIRE(output >= min);
+      REQUIRE(output <= max);
+    }
+  }
+
+  SECTION("block of bits") {
+    // Odd size leaves a tail after full SIMD iterations and the range
+    // crosses a carry into the upper counter word.
+    const uint64_t first_index = UINT32_MAX - 20;
+    const size_t size = 45;
+    std::vector<uint32_t> low(size);
+    std::vector<uint32_t> high(size);
+    stream.generate_bits(first_index, low, high);
+    std::vector<uint32_t> low_only(size);
+    stream.generate_bits(first_index, low_only, {});
+    for (size_t i = 0; i < size; ++i) {
+      const auto bits = stream.generate_bits(first_index + i);
+      REQUIRE(low[i] == bits[0]);
+      REQUIRE(high[i] == bits[1]);
+      REQUIRE(low_only[i] == bits[0]);
+    }
+    std::vector<uint32_t> short_high(size - 1);
+    REQUIRE_THROWS_AS(stream.generate_bits(0, low, short_high),
+                      std::invalid_argument);
+  }
+
+  SECTION("Vector") {
+    using int16_4_t = ca::Vector<int16_t, 4>;
+    const auto output = stream.generate_value<int16_4_t>(2, -5, 5);
+    for (size_t j = 0; j < int16_4_t::vector_size; ++j) {
+      REQUIRE(output[j] == stream.generate_value<int16_t>(8 + j, -5, 5));
+    }
+  }
+}
+
+TEST_CASE("fill_random") {
+  const ca::RandomStream stream(0, "test");
+  const size_t size = 1000;
+  const uint64_t first_index = 5;
+
+  SECTION("int32_t") {
+    std::vector<int32_t> data(size);
+    ca::fill_random<int32_t>(data, -7, 7, stream, first_index);
+    for (size_t i = 0; i < size; ++i) {
+      REQUIRE(data[i] ==
+              stream.generate_value<int32_t>(first_index + i, -7, 7));
+    }
+  }
+
+  SECTION("float") {
+    for (const auto &[min, max] :
+         std::vector<std::pair<float, float>>{{-3.0F, 5.0F}, {1.0F, 2.0F}}) {
+      std::vector<float> data(size);
+      ca::fill_random<float>(data, min, max, stream, first_index);
+      for (size_t i = 0; i < size; ++i) {
+        REQUIRE(data[i] ==
+                stream.generate_value<float>(first_index + i, min, max));
+      }
+    }
+  }
+
+  SECTION("double") {
+    std::vector<double> data(size);
+    ca::fill_random<double>(data, -1.0, 1.0, stream, first_index);
+    for (size_t i = 0; i < size; ++i) {
+      REQUIRE(data[i] ==
+              stream.generate_value<double>(first_index + i, -1.0, 1.0));
+    }
+  }
+
+  SECTION("half") {
+    const ca::half min(-2.0F);
+    const ca::half max(2.0F);
+    std::vector<ca::half> data(size);
+    ca::fill_random<ca::half>(data, min, max, stream, first_index);
+    for (size_t i = 0; i < size; ++i) {
+      REQUIRE(data[i] ==
+              stream.generate_value<ca::half>(first_index + i, min, max));
+    }
+  }
+
+  SECTION("bfloat16 spanning multiple blocks") {
+    const ca::bfloat16 min(1.0F);
+    const ca::bfloat16 max(8.0F);
+    std::vector<ca::bfloat16> data(3 * size);
+    ca::fill_random<ca::bfloat16>(data, min, max, stream, first_index);
+    for (size_t i = 0; i < data.size(); ++i) {
+      REQUIRE(data[i] ==
+              stream.generate_value<ca::bfloat16>(first_index + i, min, max));
+    }
+  }
+
+  SECTION("tfloat") {
+    const ca::tfloat min(-4.0F);
+    const ca::tfloat max(1.0F);
+    std::vector<ca::tfloat> data(size);
+    ca::fill_random<ca::tfloat>(data, min, max, stream, first_index);
+    for (size_t i = 0; i < size; ++i) {
+      REQUIRE(data[i] ==
+              stream.generate_value<ca::tfloat>(first_index + i, min, max));
+    }
+  }
+
+  SECTION("min equal to max") {
+    std::vector<float> data(size);
+    ca::fill_random<float>(data, 3.0F, 3.0F, stream);
+    REQUIRE(data == std::vector<float>(size, 3.0F));
+  }
+
+  SECTION("invalid range") {
+    std::vector<float> data(size);
+    REQUIRE_THROWS_AS(ca::fill_random<float>(data, 1.0F, -1.0F, stream),
+                      std::invalid_argument);
+  }
+
+  SECTION("integer invalid range") {
+    std::vector<int32_t> data(size);
+    REQUIRE_THROWS_AS(ca::fill_random<int32_t>(data, 1, -1, stream),
+                      std::invalid_argument);
+  }
+}
+
+TEST_CASE("fill_random - rounding mode") {
+  const ca::RandomStream stream(0, "test");
+  const ca::half min(-2.0F);
+  const ca::half max(2.0F);
+  const uint64_t first_index = 5;
+  std::vector<ca::half> data(16 * 1024);
+
+  const int rounding_mode = std::fegetround();
+  auto restore = ca::finally([&]() {
+    std::fesetround(rounding_mode);
+    ca::set_host_thread_count(0);
+  });
+
+  for (const size_t thread_count : {1, 4}) {
+    // Pool threads are started in the default rounding mode
+    std::fesetround(rounding_mode);
+    ca::set_host_thread_count(thread_count);
+    ca::fill_random<ca::half>(data, min, max, stream, first_index);
+
+    std::fesetround(FE_UPWARD);
+    ca::fill_random<ca::half>(data, min, max, stream, first_index);
+    for (size_t i = 0; i < data.size(); ++i) {
+      REQUIRE(data[i] ==
+              stream.generate_value<ca::half>(first_index + i, min, max));
+    }
+  }
+}
+
+} // namespace
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cassian/reference/reference_store.hpp>
+#include <cassian/testing/temporary_directory.hpp>
+#include <cassian/vector/vector.hpp>
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ca = cassian;
+
+namespace {
+
+TEST_CASE("ReferenceStore") {
+  const ca::testing::TemporaryDirectory directory("cassian_reference_store_");
+  const std::vector<double> values = {1.0, -2.5, 3.25};
+  const ca::ReferenceKey key = {"sin", "double", ca::hash_inputs(values), 1};
+
+  SECTION("disabled store finds nothing") {
+    const ca::ReferenceStore store;
+    REQUIRE_FALSE(store.enabled());
+    store.store<double>(key, values);
+    REQUIRE_FALSE(store.find<double>(key).has_value());
+  }
+
+  SECTION("stored values are mapped back") {
+    const ca::ReferenceStore store(directory.path(), false);
+    REQUIRE(store.enabled());
+    REQUIRE_FALSE(store.find<double>(key).has_value());
+    store.store<double>(key, values);
+    const auto view = store.find<double>(key);
+    REQUIRE(view.has_value());
+    REQUIRE(std::vector<double>(view->begin(), view->end()) == values);
+  }
+
+  SECTION("view outlives store") {
+    std::optional<ca::ReferenceView<double>> view;
+    {
+      const ca::ReferenceStore store(directory.path(), false);
+      store.store<double>(key, values);
+      view = store.find<double>(key);
+    }
+    REQUIRE(view.has_value());
+    REQUIRE((*view)[1] == values[1]);
+  }
+
+  SECTION("entries with different keys are separate") {
+    const ca::ReferenceStore store(directory.path(), false);
+    store.store<double>(key, values);
+    auto other_key = key;
+    other_key.type = "float";
+    REQUIRE_FALSE(store.find<double>(other_key).has_value());
+    other_key = key;
+    other_key.input_hash++;
+    REQUIRE_FALSE(store.find<double>(other_key).has_value());
+    other_key = key;
+    other_key.version++;
+    REQUIRE_FALSE(store.find<double>(other_key).has_value());
+    REQUIRE_FALSE(store.find<float>(key).has_value());
+  }
+
+  SECTION("rebuild ignores existing entries") {
+    ca::ReferenceStore(directory.path(), false).store<double>(key, values);
+    const ca::ReferenceStore store(directory.path(), true);
+    REQUIRE_FALSE(store.find<double>(key).has_value());
+    const std::vector<double> rebuilt = {4.0};
+    store.store<double>(key, rebuilt);
+    const auto view =
+        ca::ReferenceStore(directory.path(), false).find<double>(key);
+    REQUIRE(view.has_value());
+    REQUIRE(std::vector<double>(view->begin(), view->end()) == rebuilt);
+  }
+
+  SECTION("corrupted entries are ignored") {
+    const ca::ReferenceStore store(directory.path(), false);
+    store.store<double>(key, values);
+    for (const auto &entry :
+         std::filesystem::directory_iterator(directory.path())) {
+      std::filesystem::resize_file(entry.path(), 16);
+    }
+    REQUIRE_FALSE(store.find<double>(key).has_value());
+  }
+
+  SECTION("fetch computes missing values once") {
+    const ca::ReferenceStore store(directory.path(), false);
+    int count = 0;
+    const auto compute = [&](std::vector<double> &output) {
+      count++;
+      output = values;
+    };
+    const auto computed = store.fetch<double>(key, values.size(), compute);
+    REQUIRE(std::vector<double>(computed.begin(), computed.end()) == values);
+    const auto fetched = store.fetch<double>(key, values.size(), compute);
+    REQUIRE(std::vector<double>(fetched.begin(), fetched.end()) == values);
+    REQUIRE(count == 1);
+  }
+
+  SECTION("fetch returns computed values if store is disabled") {
+    const ca::ReferenceStore store;
+    int count = 0;
+    const auto compute = [&](std::vector<double> &output) {
+      count++;
+      output = values;
+    };
+    const auto view = store.fetch<double>(key, values.size(), compute);
+    REQUIRE(std::vector<double>(view.begin(), view.end()) == values);
+    store.fetch<double>(key, values.size(), compute);
+    REQUIRE(count == 2);
+  }
+}
+
+TEST_CASE("hash_inputs") {
+  const std::vector<int> a = {1, 2};
+  const std::vector<int> b = {3};
+  REQUIRE(ca::hash_inputs(a, b) == ca::hash_inputs(a, b));
+  REQUIRE(ca::hash_inputs(a, b) != ca::hash_inputs(b, a));
+  REQUIRE(ca::hash_inputs(std::vector<int>{1}, std::vector<int>{2, 3}) !=
+          ca::hash_inputs(a, b));
+}
+
+TEST_CASE("hash_inputs - ignores vector padding") {
+  using Int3 = ca::Vector<int, 3, 4>;
+  std::vector<Int3> a = {Int3({1, 2, 3})};
+  std::vector<Int3> b = a;
+  const int padding = 4;
+  std::memcpy(reinterpret_cast<char *>(b.data()) + 3 * sizeof(int), &padding,
+              sizeof(padding));
+  REQUIRE(ca::hash_inputs(a) == ca::hash_inputs(b));
+  b[0][2] = 4;
+  REQUIRE(ca::hash_inputs(a) != ca::hash_inputs(b));
+}
+
+} // namespace
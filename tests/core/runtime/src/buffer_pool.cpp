@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cassian/runtime/access_qualifier.hpp>
+#include <cassian/runtime/buffer_pool.hpp>
+#include <cassian/runtime/memory_kind.hpp>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace ca = cassian;
+
+namespace {
+constexpr auto read_write = ca::AccessQualifier::read_write;
+constexpr auto device_memory = ca::MemoryKind::device;
+} // namespace
+
+TEST_CASE("BufferPool") {
+  SECTION("released buffer is reused for the same size") {
+    ca::BufferPool pool;
+    REQUIRE_FALSE(pool.acquire(0, 1000, read_write, device_memory));
+    pool.insert(1, 0, 1000, read_write, device_memory);
+    REQUIRE(pool.release(1).empty());
+    const auto buffer = pool.acquire(0, 1000, read_write, device_memory);
+    REQUIRE(buffer.has_value());
+    REQUIRE(buffer.value() == 1);
+    const auto statistics = pool.get_statistics();
+    REQUIRE(statistics.pool_allocations == 1);
+    REQUIRE(statistics.driver_allocations == 1);
+    REQUIRE(statistics.idle_bytes == 0);
+    REQUIRE(statistics.peak_idle_bytes == 1000);
+  }
+
+  SECTION("buffer in use is not shared") {
+    ca::BufferPool pool;
+    pool.insert(1, 0, 1000, read_write, device_memory);
+    REQUIRE_FALSE(pool.acquire(0, 1000, read_write, device_memory));
+  }
+
+  SECTION("different size, device, access or memory kind") {
+    ca::BufferPool pool;
+    pool.insert(1, 0, 1000, read_write, device_memory);
+    pool.release(1);
+    REQUIRE_FALSE(pool.acquire(0, 900, read_write, device_memory));
+    REQUIRE_FALSE(pool.acquire(0, 1024, read_write, device_memory));
+    REQUIRE_FALSE(pool.acquire(1, 1000, read_write, device_memory));
+    REQUIRE_FALSE(
+        pool.acquire(0, 1000, ca::AccessQualifier::read_only, device_memory));
+    REQUIRE_FALSE(pool.acquire(0, 1000, read_write, ca::MemoryKind::shared));
+    REQUIRE(pool.acquire(0, 1000, read_write, device_memory));
+  }
+
+  SECTION("least recently released buffer is freed above limit") {
+    ca::BufferPool pool(2048);
+    pool.insert(1, 0, 1024, read_write, device_memory);
+    pool.insert(2, 0, 1024, read_write, device_memory);
+    pool.insert(3, 0, 1024, read_write, device_memory);
+    REQUIRE(pool.release(1).empty());
+    REQUIRE(pool.release(2).empty());
+    const std::vector<std::uintptr_t> expected = {1};
+    REQUIRE(pool.release(3) == expected);
+    REQUIRE(pool.get_statistics().idle_bytes == 2048);
+  }
+
+  SECTION("buffer above limit bypasses pool") {
+    ca::BufferPool pool(2048);
+    pool.insert(1, 0, 1000, read_write, device_memory);
+    pool.insert(2, 0, 2100, read_write, device_memory);
+    REQUIRE(pool.release(1).empty());
+    const std::vector<std::uintptr_t> expected = {2};
+    REQUIRE(pool.release(2) == expected);
+    REQUIRE(pool.get_statistics().idle_bytes == 1000);
+    REQUIRE_FALSE(pool.acquire(0, 2100, read_write, device_memory));
+    REQUIRE(pool.acquire(0, 1000, read_write, device_memory));
+  }
+
+  SECTION("zero limit") {
+    ca::BufferPool pool(0);
+    pool.insert(1, 0, 1000, read_write, device_memory);
+    const std::vector<std::uintptr_t> expected = {1};
+    REQUIRE(pool.release(1) == expected);
+    REQUIRE_FALSE(pool.acquire(0, 1000, read_write, device_memory));
+  }
+
+  SECTION("trim frees idle buffers") {
+    ca::BufferPool pool;
+    pool.insert(1, 0, 1000, read_write, device_memory);
+    pool.insert(2, 0, 1000, read_write, device_memory);
+    pool.release(1);
+    const std::vector<std::uintptr_t> expected = {1};
+    REQUIRE(pool.trim() == expected);
+    REQUIRE(pool.get_statistics().idle_bytes == 0);
+    REQUIRE_FALSE(pool.acquire(0, 1000, read_write, device_memory));
+    REQUIRE(pool.release(2).empty());
+  }
+
+  SECTION("double release") {
+    ca::BufferPool pool;
+    pool.insert(1, 0, 1000, read_write, device_memory);
+    pool.release(1);
+    REQUIRE(pool.release(1).empty());
+    REQUIRE(pool.get_statistics().idle_bytes == 1000);
+  }
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cassian/runtime/device_info.hpp>
+#include <cassian/runtime/runtime.hpp>
+#include <catch2/catch.hpp>
+
+namespace ca = cassian;
+
+TEST_CASE("DeviceInfo") {
+  int property_queries = 0;
+  int feature_queries = 0;
+  const auto info = ca::DeviceInfo::query(
+      [&](ca::DeviceProperty property) {
+        property_queries++;
+        if (property == ca::DeviceProperty::device_revision) {
+          throw ca::RuntimeException("Failed to find device property");
+        }
+        return static_cast<int>(property) + 100;
+      },
+      [&](ca::Feature feature) {
+        feature_queries++;
+        if (feature == ca::Feature::extended_bit_operations) {
+          throw ca::RuntimeException("Failed to get OpenCL device info");
+        }
+        return feature == ca::Feature::fp64;
+      });
+  const int queries_after_snapshot = property_queries + feature_queries;
+
+  SECTION("properties") {
+    REQUIRE(info.get_device_property(
+                ca::DeviceProperty::max_total_group_size) == 100);
+    REQUIRE(info.get_device_property(ca::DeviceProperty::max_compute_units) ==
+            static_cast<int>(ca::DeviceProperty::max_compute_units) + 100);
+  }
+  SECTION("failed property query is rethrown") {
+    REQUIRE_THROWS_WITH(
+        info.get_device_property(ca::DeviceProperty::device_revision),
+        "Failed to find device property");
+  }
+  SECTION("features") {
+    REQUIRE(info.is_feature_supported(ca::Feature::fp64));
+    REQUIRE_FALSE(info.is_feature_supported(ca::Feature::fp16));
+  }
+  SECTION("failed feature query is rethrown") {
+    REQUIRE_THROWS_AS(
+        info.is_feature_supported(ca::Feature::extended_bit_operations),
+        ca::RuntimeException);
+  }
+  SECTION("reads do not query device") {
+    info.get_device_property(ca::DeviceProperty::ip_version);
+    info.is_feature_supported(ca::Feature::simd16);
+    REQUIRE(property_queries + feature_queries == queries_after_snapshot);
+  }
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <algorithm>
+#include <cassian/runtime/kernel_cache.hpp>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ca = cassian;
+
+TEST_CASE("KernelCache") {
+  SECTION("released program is reused") {
+    ca::KernelCache cache;
+    REQUIRE_FALSE(cache.acquire("key").has_value());
+    cache.insert("key", 1);
+    REQUIRE(cache.release(1).empty());
+    const auto program = cache.acquire("key");
+    REQUIRE(program.has_value());
+    REQUIRE(program.value() == 1);
+    REQUIRE(cache.hits() == 1);
+    REQUIRE(cache.misses() == 1);
+  }
+
+  SECTION("program in use is shared") {
+    ca::KernelCache cache;
+    cache.insert("key", 1);
+    const auto program = cache.acquire("key");
+    REQUIRE(program.has_value());
+    REQUIRE(program.value() == 1);
+  }
+
+  SECTION("program is idle after last reference is dropped") {
+    ca::KernelCache cache(0);
+    cache.insert("key", 1);
+    cache.acquire("key");
+    REQUIRE(cache.release(1).empty());
+    REQUIRE(cache.contains(1));
+    const std::vector<std::uintptr_t> expected = {1};
+    REQUIRE(cache.release(1) == expected);
+    REQUIRE_FALSE(cache.contains(1));
+  }
+
+  SECTION("different key") {
+    ca::KernelCache cache;
+    cache.insert("key", 1);
+    cache.release(1);
+    REQUIRE_FALSE(cache.acquire("other_key").has_value());
+  }
+
+  SECTION("least recently released program is evicted") {
+    ca::KernelCache cache(2);
+    cache.insert("a", 1);
+    cache.insert("b", 2);
+    cache.insert("c", 3);
+    REQUIRE(cache.release(1).empty());
+    REQUIRE(cache.release(2).empty());
+    const std::vector<std::uintptr_t> expected = {1};
+    REQUIRE(cache.release(3) == expected);
+    REQUIRE_FALSE(cache.contains(1));
+    REQUIRE_FALSE(cache.acquire("a").has_value());
+    REQUIRE(cache.acquire("b").has_value());
+  }
+
+  SECTION("reused program is not evicted") {
+    ca::KernelCache cache(1);
+    cache.insert("a", 1);
+    cache.insert("b", 2);
+    cache.release(1);
+    cache.acquire("a");
+    REQUIRE(cache.release(2).empty());
+    REQUIRE(cache.contains(1));
+  }
+
+  SECTION("zero capacity") {
+    ca::KernelCache cache(0);
+    cache.insert("key", 1);
+    const std::vector<std::uintptr_t> expected = {1};
+    REQUIRE(cache.release(1) == expected);
+    REQUIRE_FALSE(cache.acquire("key").has_value());
+  }
+
+  SECTION("double release") {
+    ca::KernelCache cache;
+    cache.insert("key", 1);
+    cache.release(1);
+    REQUIRE(cache.release(1).empty());
+    REQUIRE(cache.acquire("key").has_value());
+    REQUIRE(cache.release(1).empty());
+    REQUIRE(cache.contains(1));
+  }
+
+  SECTION("clear") {
+    ca::KernelCache cache;
+    cache.insert("a", 1);
+    cache.insert("b", 2);
+    cache.release(2);
+    auto programs = cache.clear();
+    std::sort(programs.begin(), programs.end());
+    const std::vector<std::uintptr_t> expected = {1, 2};
+    REQUIRE(programs == expected);
+    REQUIRE_FALSE(cache.contains(1));
+    REQUIRE_FALSE(cache.acquire("a").has_value());
+  }
+}
+
+TEST_CASE("kernel_cache_key") {
+  const auto key = ca::kernel_cache_key("source", "", "source", "");
+  SECTION("spirv options") {
+    REQUIRE(key != ca::kernel_cache_key("source", "", "source", std::nullopt));
+  }
+  SECTION("build options") {
+    REQUIRE(key != ca::kernel_cache_key("source", "-O0", "source", ""));
+  }
+  SECTION("program type") {
+    REQUIRE(key != ca::kernel_cache_key("source", "", "spirv", ""));
+  }
+  SECTION("same parameters") {
+    REQUIRE(key == ca::kernel_cache_key("source", "", "source", ""));
+  }
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cassian/runtime/access_qualifier.hpp>
+#include <cassian/runtime/mapped_buffers.hpp>
+#include <cassian/runtime/memory_kind.hpp>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace ca = cassian;
+
+namespace {
+constexpr std::uintptr_t buffer_id = 1;
+
+struct Device {
+  std::vector<uint8_t> memory = {1, 2, 3, 4};
+  int reads = 0;
+  int writes = 0;
+
+  ca::MappedBuffers::ReadFunction read() {
+    return [this](void *data) {
+      ++reads;
+      std::memcpy(data, memory.data(), memory.size());
+    };
+  }
+
+  ca::MappedBuffers::WriteFunction write() {
+    return [this](const void *data) {
+      ++writes;
+      std::memcpy(memory.data(), data, memory.size());
+    };
+  }
+};
+
+uint8_t *map(ca::MappedBuffers &mapped, Device &device,
+             ca::AccessQualifier access,
+             ca::MemoryKind memory_kind = ca::MemoryKind::device) {
+  return static_cast<uint8_t *>(mapped.map(buffer_id, device.memory.size(),
+                                           memory_kind, device.memory.data(),
+                                           access, device.read()));
+}
+} // namespace
+
+TEST_CASE("MappedBuffers") {
+  ca::MappedBuffers mapped;
+  Device device;
+
+  SECTION("read_write mapping reads and writes back") {
+    auto *data = map(mapped, device, ca::AccessQualifier::read_write);
+    REQUIRE(data != device.memory.data());
+    REQUIRE(device.reads == 1);
+    REQUIRE(data[3] == 4);
+    data[0] = 9;
+    mapped.unmap(buffer_id, device.write());
+    REQUIRE(device.writes == 1);
+    REQUIRE(device.memory == std::vector<uint8_t>{9, 2, 3, 4});
+  }
+
+  SECTION("write_only mapping skips readback") {
+    auto *data = map(mapped, device, ca::AccessQualifier::write_only);
+    REQUIRE(device.reads == 0);
+    std::memset(data, 7, device.memory.size());
+    mapped.unmap(buffer_id, device.write());
+    REQUIRE(device.writes == 1);
+    REQUIRE(device.memory == std::vector<uint8_t>{7, 7, 7, 7});
+  }
+
+  SECTION("read_only mapping skips writeback") {
+    auto *data = map(mapped, device, ca::AccessQualifier::read_only);
+    REQUIRE(device.reads == 1);
+    data[0] = 9;
+    mapped.unmap(buffer_id, device.write());
+    REQUIRE(device.writes == 0);
+    REQUIRE(device.memory == std::vector<uint8_t>{1, 2, 3, 4});
+  }
+
+  SECTION("host and shared memory is accessed in place") {
+    const auto memory_kind =
+        GENERATE(ca::MemoryKind::host, ca::MemoryKind::shared);
+    auto *data = map(mapped, device, ca::AccessQualifier::read_write,
+                     memory_kind);
+    REQUIRE(data == device.memory.data());
+    mapped.unmap(buffer_id, device.write());
+    REQUIRE(device.reads == 0);
+    REQUIRE(device.writes == 0);
+  }
+
+  SECTION("unmapping is done once") {
+    map(mapped, device, ca::AccessQualifier::read_write);
+    mapped.unmap(buffer_id, device.write());
+    mapped.unmap(buffer_id, device.write());
+    REQUIRE(device.writes == 1);
+  }
+}
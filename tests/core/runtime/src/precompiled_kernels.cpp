@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cassian/runtime/factory.hpp>
+#include <cassian/runtime/precompiled_kernels.hpp>
+#include <cassian/runtime/runtime.hpp>
+#include <cassian/runtime/runtime_caches.hpp>
+#include <cassian/testing/temporary_directory.hpp>
+#include <cassian/utility/utility.hpp>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ca = cassian;
+
+TEST_CASE("PrecompiledKernels") {
+  const ca::testing::TemporaryDirectory temporary_directory(
+      "cassian_test_precompiled_");
+  const auto &directory = temporary_directory.path();
+  std::filesystem::create_directories(directory / "sources");
+  std::filesystem::create_directories(directory / "100");
+
+  const std::string source = "kernel void test_kernel() {}";
+  const std::vector<uint8_t> binary = {0x7f, 0x45, 0x4c, 0x46};
+  ca::save_binary_file(std::vector<uint8_t>(source.begin(), source.end()),
+                       (directory / "sources" / "0").string());
+  ca::save_binary_file(binary, (directory / "100" / "0_0.bin").string());
+  ca::save_binary_file({}, (directory / "100" / "0_1.bin").string());
+  const std::string index = "100\tsources/0\t100/0_0.bin\t-DA=\"a b\"\n"
+                            "100\tsources/0\t100/0_1.bin\t-DA=1\n";
+  ca::save_binary_file(std::vector<uint8_t>(index.begin(), index.end()),
+                       (directory / "index.txt").string());
+
+  ca::PrecompiledKernels precompiled((directory / "index.txt").string());
+  REQUIRE(precompiled.size() == 2);
+
+  SECTION("matching entry") {
+    const auto output = precompiled.find(100, source, "-DA=\"a b\"");
+    REQUIRE(output.has_value());
+    REQUIRE(output.value() == binary);
+  }
+  SECTION("different device") {
+    REQUIRE_FALSE(precompiled.find(200, source, "-DA=\"a b\"").has_value());
+  }
+  SECTION("different source") {
+    REQUIRE_FALSE(precompiled.find(100, "", "-DA=\"a b\"").has_value());
+  }
+  SECTION("different build options") {
+    REQUIRE_FALSE(precompiled.find(100, source, "").has_value());
+    REQUIRE_FALSE(precompiled.find(100, source, "-DA=\"a\" b").has_value());
+  }
+  SECTION("build options with different quoting and spacing") {
+    const auto output = precompiled.find(100, source, " -DA=a\" b\"  ");
+    REQUIRE(output.has_value());
+    REQUIRE(output.value() == binary);
+  }
+  SECTION("failed precompilation") {
+    REQUIRE_FALSE(precompiled.find(100, source, "-DA=1").has_value());
+  }
+}
+
+TEST_CASE("PrecompiledKernels - program types looked up") {
+  REQUIRE(ca::PrecompiledKernels::is_applicable("source", std::nullopt));
+  REQUIRE(ca::PrecompiledKernels::is_applicable("spirv", std::nullopt));
+  REQUIRE_FALSE(ca::PrecompiledKernels::is_applicable("spirv", ""));
+  REQUIRE_FALSE(ca::PrecompiledKernels::is_applicable("source", "-ze-opt"));
+  REQUIRE_FALSE(ca::PrecompiledKernels::is_applicable("binary", std::nullopt));
+}
+
+TEST_CASE("normalize_build_options") {
+  REQUIRE(ca::normalize_build_options("") == "");
+  REQUIRE(ca::normalize_build_options("  -cmc   -DA=1 ") == "-cmc -DA=1");
+  REQUIRE(ca::normalize_build_options("-DTYPE=\"unsigned int\"") ==
+          "\"-DTYPE=unsigned int\"");
+  REQUIRE(ca::normalize_build_options("\"-DTYPE=unsigned int\"") ==
+          "\"-DTYPE=unsigned int\"");
+  REQUIRE(ca::normalize_build_options("-DA=\"\"") == "-DA=");
+  REQUIRE(ca::normalize_build_options("\"\"") == "");
+}
+
+TEST_CASE("PrecompiledKernels - missing index") {
+  REQUIRE_THROWS_AS(ca::PrecompiledKernels("not_existing/index.txt"),
+                    ca::RuntimeException);
+}
+
+TEST_CASE("PrecompiledKernels - Level Zero create_kernel") {
+  std::unique_ptr<ca::Runtime> runtime;
+  std::vector<uint8_t> binary;
+  try {
+    runtime = ca::create_runtime("l0");
+    runtime->initialize();
+    // Bundle binary is built from a different source, so the kernel can only
+    // be created if create_kernel loads it
+    binary = runtime->create_program_and_get_native_binary(
+        "kernel void precompiled_kernel(global int *output) {}", "", "spirv",
+        std::nullopt, true);
+  } catch (const std::runtime_error &) {
+    WARN("Level Zero device or offline compiler is not available");
+    return;
+  }
+
+  const ca::testing::TemporaryDirectory temporary_directory(
+      "cassian_test_precompiled_l0_");
+  const auto &directory = temporary_directory.path();
+  std::filesystem::create_directories(directory / "sources");
+  std::filesystem::create_directories(directory / "binaries");
+
+  const std::string source = "kernel void other_kernel() {}";
+  ca::save_text_file(source, (directory / "sources" / "0").string());
+  ca::save_binary_file(binary, (directory / "binaries" / "0_0.bin").string());
+  const std::string index =
+      std::to_string(
+          runtime->get_device_property(ca::DeviceProperty::ip_version)) +
+      "\tsources/0\tbinaries/0_0.bin\t\n";
+  ca::save_text_file(index, (directory / "index.txt").string());
+
+  auto *caches = dynamic_cast<ca::RuntimeCaches *>(runtime.get());
+  REQUIRE(caches != nullptr);
+  caches->set_precompiled_kernels(std::make_shared<ca::PrecompiledKernels>(
+      (directory / "index.txt").string()));
+  const ca::Kernel kernel = runtime->create_kernel(
+      "precompiled_kernel", source, "", "spirv", std::nullopt, true);
+  runtime->release_kernel(kernel);
+  caches->set_precompiled_kernels(nullptr);
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cassian/runtime/program_binary_cache.hpp>
+#include <cassian/testing/temporary_directory.hpp>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace ca = cassian;
+
+TEST_CASE("ProgramBinaryCache") {
+  const ca::testing::TemporaryDirectory temporary_directory(
+      "cassian_test_program_binary_cache_");
+  const std::string directory = temporary_directory.path().string();
+  const std::vector<uint8_t> binary = {0x00, 0x01, 0x7f, 0x80, 0xff};
+
+  SECTION("store and load") {
+    ca::ProgramBinaryCache cache(directory);
+    cache.store("key", binary);
+    const auto output = cache.load("key");
+    REQUIRE(output.has_value());
+    REQUIRE(output.value() == binary);
+  }
+
+  SECTION("entries persist between instances") {
+    {
+      ca::ProgramBinaryCache cache(directory);
+      cache.store("key", binary);
+    }
+    ca::ProgramBinaryCache cache(directory);
+    const auto output = cache.load("key");
+    REQUIRE(output.has_value());
+    REQUIRE(output.value() == binary);
+  }
+
+  SECTION("unknown key") {
+    ca::ProgramBinaryCache cache(directory);
+    cache.store("key", binary);
+    REQUIRE_FALSE(cache.load("other_key").has_value());
+  }
+
+  SECTION("statistics") {
+    ca::ProgramBinaryCache cache(directory);
+    REQUIRE_FALSE(cache.load("key").has_value());
+    cache.store("key", binary);
+    REQUIRE(cache.load("key").has_value());
+    REQUIRE(cache.load("key").has_value());
+    REQUIRE(cache.hits() == 2);
+    REQUIRE(cache.misses() == 1);
+  }
+}
+
+TEST_CASE("program_binary_cache_key") {
+  SECTION("components are not ambiguous") {
+    const auto a = ca::program_binary_cache_key({"ab", "c"});
+    const auto b = ca::program_binary_cache_key({"a", "bc"});
+    REQUIRE(a != b);
+  }
+  SECTION("same components give same key") {
+    const auto a = ca::program_binary_cache_key({"ab", "c"});
+    const auto b = ca::program_binary_cache_key({"ab", "c"});
+    REQUIRE(a == b);
+  }
+}
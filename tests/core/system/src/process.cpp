@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cassian/system/factory.hpp>
+#include <cassian/system/process.hpp>
+#include <catch2/catch.hpp>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ca = cassian;
+
+#if defined(__linux__)
+
+TEST_CASE("process", "") {
+  SECTION("exit code is returned") {
+    auto process = ca::start_process({"/bin/sh", "-c", "exit 3"});
+    REQUIRE(process->wait() == 3);
+  }
+
+  SECTION("environment and output are forwarded") {
+    const auto output_path =
+        std::filesystem::temp_directory_path() /
+        ("cassian_test_process_" + std::to_string(std::random_device()()) +
+         ".txt");
+    auto process =
+        ca::start_process({"/bin/sh", "-c", "echo $CASSIAN_TEST_VALUE"},
+                          {{"CASSIAN_TEST_VALUE", "42"}}, output_path.string());
+    REQUIRE(process->wait() == 0);
+
+    std::ifstream file(output_path);
+    const std::string output((std::istreambuf_iterator<char>(file)),
+                             std::istreambuf_iterator<char>());
+    file.close();
+    std::filesystem::remove(output_path);
+    REQUIRE(output == "42\n");
+  }
+
+  SECTION("overridden variable replaces inherited one") {
+    setenv("CASSIAN_TEST_VALUE", "parent", 1);
+    const auto output_path =
+        std::filesystem::temp_directory_path() /
+        ("cassian_test_process_" + std::to_string(std::random_device()()) +
+         ".txt");
+    auto process = ca::start_process(
+        {"/usr/bin/env"}, {{"CASSIAN_TEST_VALUE", "42"}}, output_path.string());
+    const int exit_code = process->wait();
+    unsetenv("CASSIAN_TEST_VALUE");
+    REQUIRE(exit_code == 0);
+
+    std::ifstream file(output_path);
+    std::vector<std::string> values;
+    for (std::string line; std::getline(file, line);) {
+      if (line.starts_with("CASSIAN_TEST_VALUE=")) {
+        values.push_back(line);
+      }
+    }
+    file.close();
+    std::filesystem::remove(output_path);
+    REQUIRE(values == std::vector<std::string>{"CASSIAN_TEST_VALUE=42"});
+  }
+
+  SECTION("terminated process is stopped") {
+    auto process = ca::start_process({"/bin/sh", "-c", "sleep 60"});
+    process->terminate();
+    REQUIRE(process->wait() != 0);
+    process->terminate();
+  }
+
+  SECTION("missing executable results in non-zero exit code") {
+    auto process = ca::start_process({"/INVALID_EXECUTABLE"});
+    REQUIRE(process->wait() != 0);
+  }
+}
+
+#endif
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <cassian/runtime/mocks/dummy_runtime.hpp>
+#include <cassian/test_harness/sharding.hpp>
+#include <catch2/catch.hpp>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace ca = cassian;
+
+namespace {
+
+TEST_CASE("split_test_cases") {
+  const std::vector<std::string> test_cases = {"a", "b", "c", "d", "e"};
+
+  SECTION("round-robin") {
+    const auto shards = ca::split_test_cases(test_cases, 2);
+    REQUIRE(shards.size() == 2);
+    REQUIRE(shards[0] == std::vector<std::string>{"a", "c", "e"});
+    REQUIRE(shards[1] == std::vector<std::string>{"b", "d"});
+  }
+
+  SECTION("more shards than test cases") {
+    const auto shards = ca::split_test_cases(test_cases, 7);
+    REQUIRE(shards.size() == 7);
+    REQUIRE(shards[4] == std::vector<std::string>{"e"});
+    REQUIRE(shards[6].empty());
+  }
+
+  SECTION("no shards") {
+    REQUIRE(ca::split_test_cases(test_cases, 0).empty());
+  }
+}
+
+class PartitionedRuntime : public ca::DummyRuntime {
+public:
+  int get_subdevice_count(int root_device) override {
+    return root_device == 1 ? 2 : 0;
+  }
+  int get_root_device_count() override { return 3; }
+};
+
+TEST_CASE("get_shard_devices") {
+  SECTION("single root device") {
+    ca::DummyRuntime runtime;
+    REQUIRE(ca::get_shard_devices(&runtime) == std::vector<std::string>{"0"});
+  }
+
+  SECTION("subdevices are queried per root device") {
+    PartitionedRuntime runtime;
+    REQUIRE(ca::get_shard_devices(&runtime) ==
+            std::vector<std::string>{"0", "1.0", "1.1", "2"});
+  }
+}
+
+TEST_CASE("get_shard_catch_arguments") {
+  SECTION("options are forwarded, test specs are dropped") {
+    const std::vector<std::string> arguments = {
+        "[tag]", "-r", "junit", "-c", "section", "-s", "~[slow]"};
+    REQUIRE(ca::get_shard_catch_arguments(arguments, 0) ==
+            std::vector<std::string>{"-r", "junit", "-c", "section", "-s"});
+  }
+
+  SECTION("output file is unique per shard") {
+    const std::vector<std::string> arguments = {"-o", "out/report.xml"};
+    const auto expected =
+        (std::filesystem::path("out") / "report_shard3.xml").string();
+    REQUIRE(ca::get_shard_catch_arguments(arguments, 3) ==
+            std::vector<std::string>{"-o", expected});
+    REQUIRE(ca::get_shard_catch_arguments({"--out=report.txt"}, 1) ==
+            std::vector<std::string>{"--out", "report_shard1.txt"});
+  }
+
+  SECTION("special output streams are kept") {
+    REQUIRE(ca::get_shard_catch_arguments({"-o", "%stderr"}, 0) ==
+            std::vector<std::string>{"-o", "%stderr"});
+  }
+
+  SECTION("input files are dropped") {
+    REQUIRE(ca::get_shard_catch_arguments({"-f", "tests.txt", "-s"}, 0) ==
+            std::vector<std::string>{"-s"});
+  }
+}
+
+} // namespace
@@ -12,6 +12,8 @@
 #include <catch2/catch.hpp>
 #include <cstdint>
 #include <limits>
+#include <span>
+#include <stdexcept>
 #include <vector>
 
 namespace {
@@ -23,6 +25,7 @@ using ca::calculate_ulp_distance;
 using ca::PrecisionComparator; // NOLINT(misc-unused-using-decls)
 using ca::PrecisionRequirement;
 using ca::PrecisionRequirementType;
+using ca::UlpAccumulator;
 using ca::UlpComparator; // NOLINT(misc-unused-using-decls)
 
 TEST_CASE("PrecisionComparator - scalar", "[PrecisionComparator]") {
@@ -622,4 +625,88 @@ TEST_CASE("Ulp Distance equals 0 when values are the same") {
 
   REQUIRE(0 == calculate_ulp_distance(result, reference));
 }
+
+TEST_CASE("UlpAccumulator", "[UlpAccumulator]") {
+  const double one_ulp = std::nextafter(1.0F, 2.0F);
+  const double three_ulp =
+      std::nextafter(std::nextafter(std::nextafter(1.0F, 2.0F), 2.0F), 2.0F);
+  const std::vector<float> result = {1.0F, 1.0F, 1.0F, 1.0F};
+  const std::vector<double> reference = {1.0, one_ulp, three_ulp, 1.0};
+
+  SECTION("statistics") {
+    UlpAccumulator<float, double> accumulator;
+    accumulator.accumulate(result, reference, 1.0);
+
+    REQUIRE_FALSE(accumulator.passed());
+    REQUIRE(accumulator.compared_count() == 4);
+    REQUIRE(accumulator.failure_count() == 1);
+    REQUIRE(accumulator.max_ulp() == 3.0);
+    REQUIRE(accumulator.mean_ulp() == 1.0);
+    REQUIRE(accumulator.histogram()[0] == 2);
+    REQUIRE(accumulator.histogram()[2] == 1);
+    REQUIRE(accumulator.histogram()[4] == 1);
+    REQUIRE(accumulator.failures().size() == 1);
+    REQUIRE(accumulator.failures()[0].index == 2);
+    REQUIRE(accumulator.failures()[0].ulp_distance == 3.0);
+  }
+
+  SECTION("chunks") {
+    UlpAccumulator<float, double> accumulator(1);
+    const std::span<const float> result_view = result;
+    const std::span<const double> reference_view = reference;
+    accumulator.accumulate(result_view.first(2), reference_view.first(2), 0.0);
+    accumulator.accumulate(result_view.last(2), reference_view.last(2), 0.0,
+                           2);
+
+    REQUIRE(accumulator.compared_count() == 4);
+    REQUIRE(accumulator.failure_count() == 2);
+    REQUIRE(accumulator.failures().size() == 1);
+    REQUIRE(accumulator.failures()[0].index == 1);
+  }
+
+  SECTION("nan") {
+    const std::vector<float> nan_result = {
+        std::numeric_limits<float>::quiet_NaN(), 1.0F};
+    const std::vector<double> nan_reference = {
+        std::numeric_limits<double>::quiet_NaN(),
+        std::numeric_limits<double>::quiet_NaN()};
+    UlpAccumulator<float, double> accumulator;
+    accumulator.accumulate(nan_result, nan_reference, 0.0);
+
+    REQUIRE(accumulator.failure_count() == 1);
+    REQUIRE(accumulator.failures()[0].index == 1);
+    REQUIRE(accumulator.histogram().back() == 1);
+  }
+
+  SECTION("nan distance followed by finite distance") {
+    const std::vector<float> nan_result = {1.0F, 1.0F};
+    const std::vector<double> nan_reference = {
+        std::numeric_limits<double>::quiet_NaN(), three_ulp};
+    UlpAccumulator<float, double> accumulator;
+    accumulator.accumulate(nan_result, nan_reference, 0.0);
+
+    REQUIRE(std::isnan(accumulator.max_ulp()));
+    REQUIRE(accumulator.mean_ulp() == 3.0);
+  }
+
+  SECTION("vector") {
+    const std::vector<ca::Vector<float, 2>> vector_result = {{1.0F, 1.0F}};
+    const std::vector<ca::Vector<double, 2>> vector_reference = {
+        {1.0, three_ulp}};
+    UlpAccumulator<ca::Vector<float, 2>, ca::Vector<double, 2>> accumulator;
+    accumulator.accumulate(vector_result, vector_reference, 2.0);
+
+    REQUIRE(accumulator.compared_count() == 2);
+    REQUIRE(accumulator.failures().size() == 1);
+    REQUIRE(accumulator.failures()[0].index == 0);
+    REQUIRE(accumulator.failures()[0].component == 1);
+  }
+
+  SECTION("size mismatch") {
+    UlpAccumulator<float, double> accumulator;
+    const std::vector<double> short_reference = {1.0};
+    REQUIRE_THROWS_AS(accumulator.accumulate(result, short_reference, 0.0),
+                      std::invalid_argument);
+  }
+}
 } // namespace
\ No newline at end of file
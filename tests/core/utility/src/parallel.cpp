@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <atomic>
+#include <cassian/utility/parallel.hpp>
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace ca = cassian;
+
+namespace {
+
+std::vector<size_t> square_indices(const size_t size) {
+  std::vector<size_t> output(size, 0);
+  ca::parallel_for(
+      size,
+      [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+          output[i] += i * i;
+        }
+      },
+      7);
+  return output;
+}
+
+TEST_CASE("parallel_for") {
+  const size_t size = 10000;
+
+  SECTION("results do not depend on thread count") {
+    ca::set_host_thread_count(1);
+    const auto serial = square_indices(size);
+    for (size_t i = 0; i < size; i++) {
+      REQUIRE(serial[i] == i * i);
+    }
+    for (const size_t thread_count : {2, 4, 0}) {
+      ca::set_host_thread_count(thread_count);
+      REQUIRE(square_indices(size) == serial);
+    }
+  }
+
+  SECTION("nested calls run serially") {
+    ca::set_host_thread_count(4);
+    std::atomic<size_t> count = 0;
+    ca::parallel_for(
+        8,
+        [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; i++) {
+            ca::parallel_for(size, [&](size_t b, size_t e) { count += e - b; });
+          }
+        },
+        1);
+    REQUIRE(count == 8 * size);
+  }
+
+  SECTION("exception is rethrown") {
+    ca::set_host_thread_count(4);
+    REQUIRE_THROWS_AS(ca::parallel_for(
+                          size,
+                          [](size_t begin, size_t /*end*/) {
+                            if (begin == 0) {
+                              throw std::runtime_error("error");
+                            }
+                          },
+                          16),
+                      std::runtime_error);
+  }
+
+  SECTION("empty range") {
+    bool called = false;
+    ca::parallel_for(0, [&](size_t, size_t) { called = true; });
+    REQUIRE_FALSE(called);
+  }
+
+  ca::set_host_thread_count(0);
+}
+
+} // namespace
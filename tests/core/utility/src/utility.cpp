@@ -6,10 +6,12 @@
  */
 
 #include <cassian/runtime/openclc_types.hpp>
+#include <cassian/testing/temporary_directory.hpp>
 #include <cassian/utility/utility.hpp>
 #include <cassian/vector/vector.hpp>
 #include <catch2/catch.hpp>
 #include <cstdint>
+#include <string>
 #include <vector>
 
 namespace ca = cassian;
@@ -389,4 +391,38 @@ TEST_CASE("convert_to_forward_slashes") {
   }
 }
 
+TEST_CASE("fnv1a_hash") {
+  REQUIRE(ca::fnv1a_hash("") == 0xcbf29ce484222325U);
+  REQUIRE(ca::fnv1a_hash("a") == 0xaf63dc4c8601ec8cU);
+  REQUIRE(ca::fnv1a_hash("foobar") == 0x85944171f73967e8U);
+  REQUIRE(ca::fnv1a_hash("foobar", 6) == 0x85944171f73967e8U);
+  REQUIRE(ca::fnv1a_hash("bar", 3, ca::fnv1a_hash("foo")) ==
+          0x85944171f73967e8U);
+}
+
+TEST_CASE("cache_entry") {
+  const ca::testing::TemporaryDirectory directory("cassian_test_cache_entry_");
+  fs::create_directories(directory.path());
+  const auto path = (directory.path() / "entry.bin").string();
+  const std::vector<uint8_t> data = {0x03, 0x02, 0x23, 0x07};
+
+  SECTION("save and load") {
+    REQUIRE(ca::save_cache_entry(path, "key", data));
+    const auto output = ca::load_cache_entry(path, "key");
+    REQUIRE(output.has_value());
+    REQUIRE(output.value() == data);
+  }
+
+  SECTION("different key") {
+    REQUIRE(ca::save_cache_entry(path, "key", data));
+    REQUIRE_FALSE(ca::load_cache_entry(path, "other").has_value());
+    REQUIRE_FALSE(ca::load_cache_entry(path, "ke").has_value());
+  }
+
+  SECTION("missing file") {
+    fs::remove(path);
+    REQUIRE_FALSE(ca::load_cache_entry(path, "key").has_value());
+  }
+}
+
 } // namespace